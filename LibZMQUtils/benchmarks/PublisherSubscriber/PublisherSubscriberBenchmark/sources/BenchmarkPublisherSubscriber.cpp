@@ -0,0 +1,546 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   ExamplesLibZMQUtils related project.                                                                              *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @example BenchmarkPublisherSubscriber.cpp
+ *
+ * @brief Throughput, fan-out and latency benchmark of the `PublisherBase` and `ClbkSubscriberBase` classes.
+ *
+ * The benchmark runs in a single host, without external services, and measures the following cases:
+ *   - payload: messages/s and MB/s for payloads from 0 B to 1 MB, using the tcp, ipc and inproc transports.
+ *   - fanout: delivery to 1, 8 and 64 subscribers.
+ *   - filters: subscribers with 1 to 10000 topic filters.
+ *   - priority: publication with each message priority.
+ *   - mode: queued publication against direct send (see PublisherBase::setDirectSendEnabled), for each transport.
+ *   - profile: the SocketOptions presets (default, low latency, bulk and constrained link) with small and big
+ *     payloads. The high water marks are kept unlimited in every case, so the presets only change the kernel buffers,
+ *     the TCP keepalive, the immediate mode and the TOS.
+ *   - udp (only with `--transport udp`): the UDP RADIO/DISH transport next to TCP for payloads that fit in a single
+ *     datagram. The UDP transport has no retransmissions, so these cases report the lost messages besides the
+ *     latency, and they finish when the subscriber stops receiving messages.
+ *
+ * Each message carries a steady clock time stamp (8 bytes) besides the payload, so the subscribers measure the exact
+ * end-to-end latency (from the enqueue in the publisher to the callback in the subscriber). The CPU per message is
+ * measured with the POSIX CPU clocks: the subscriber CPU is the CPU time of the subscriber threads (the callbacks run
+ * inline in them), and the publisher CPU is the rest of the process CPU time, that also includes the ZMQ I/O threads.
+ *
+ * The results are written as JSON to the standard output or to the file given with `--output <file>`. The `--quick`
+ * option reduces the number of messages of each case. The `--transport udp` option runs only the udp cases (it needs
+ * a LibZMQ build with the draft API).
+ *
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include <time.h>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/PublisherSubscriber>
+#include <LibZMQUtils/Modules/Utilities>
+// =====================================================================================================================
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ZMQ Utils Namsespaces.
+using zmqutils::pubsub::PublisherBase;
+using zmqutils::pubsub::ClbkSubscriberBase;
+using zmqutils::pubsub::MessagePriority;
+using zmqutils::pubsub::OperationResult;
+using zmqutils::SocketOptions;
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Benchmark configuration.
+constexpr unsigned kBenchmarkPort = 9997;
+const std::string kTcpEndpoint = "tcp://127.0.0.1:9997";
+const std::string kIpcEndpoint = "ipc:///tmp/libzmqutils_benchmark.ipc";
+const std::string kInprocEndpoint = "inproc://libzmqutils_benchmark";
+const std::string kUdpEndpoint = "udp://127.0.0.1:9997";
+const std::string kBenchmarkTopic = "BENCHMARK_TOPIC";
+constexpr std::chrono::seconds kWarmupTimeout(10);
+constexpr std::chrono::seconds kCaseTimeout(60);
+constexpr std::chrono::milliseconds kUdpDrainTimeout(500);
+
+// Helper for getting the CPU time of a POSIX clock.
+std::chrono::nanoseconds cpuTime(clockid_t clock)
+{
+    timespec ts;
+    clock_gettime(clock, &ts);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+}
+
+// Helper for getting the steady clock time stamp sent in each message.
+std::int64_t steadyStamp()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Benchmark case configuration.
+struct BenchmarkCase
+{
+    std::string group;          // Case group (payload, fanout, filters, priority, mode, profile or udp).
+    std::string transport;      // Transport (tcp, ipc, inproc or udp).
+    std::size_t payload_size;   // Payload size in bytes (without the time stamp).
+    unsigned subscribers;       // Number of subscribers.
+    unsigned filters;           // Number of topic filters of each subscriber.
+    MessagePriority priority;   // Priority of the messages.
+    unsigned messages;          // Number of messages.
+    bool direct = false;        // Direct send mode of the publisher.
+    std::string profile = "default";  // Socket options preset (default, low_latency, bulk or constrained_link).
+};
+
+// Helper for getting the socket options of a preset.
+SocketOptions socketOptionsForProfile(const std::string& profile)
+{
+    if (profile == "low_latency")
+        return SocketOptions::lowLatency();
+    if (profile == "bulk")
+        return SocketOptions::bulk();
+    if (profile == "constrained_link")
+        return SocketOptions::constrainedLink();
+    return SocketOptions();
+}
+
+// Benchmark case result.
+struct BenchmarkResult
+{
+    BenchmarkCase config;                      // Case configuration.
+    bool completed = false;                    // All the messages were received by every subscriber.
+    std::uint64_t received = 0;                // Messages received by all the subscribers.
+    std::uint64_t lost = 0;                    // Messages lost (only the UDP transport can lose messages).
+    double elapsed_s = 0;                      // Time from the first enqueue to the last reception.
+    double msgs_per_s = 0;                     // Published messages per second.
+    double deliveries_per_s = 0;               // Received messages per second (all the subscribers).
+    double mb_per_s = 0;                       // Published payload MB per second.
+    double pub_cpu_ns_per_msg = 0;             // Publisher CPU (including ZMQ I/O threads) per published message.
+    double sub_cpu_ns_per_msg = 0;             // Subscriber CPU per received message.
+    std::vector<std::int64_t> latencies_ns;    // Sorted end-to-end latencies.
+};
+
+// Benchmark subscriber. The callbacks are executed inline, in the subscriber thread.
+class BenchmarkSubscriber : public ClbkSubscriberBase
+{
+public:
+
+    BenchmarkSubscriber(unsigned expected) :
+        ClbkSubscriberBase("BENCHMARK SUBSCRIBER", "1.0.0", "LibZMQUtils benchmark subscriber."),
+        expected_(expected),
+        received_(0),
+        ready_(false),
+        future_(promise_.get_future())
+    {
+        this->latencies_.reserve(expected);
+    }
+
+    void handleMsg(const std::int64_t& stamp, const std::string&)
+    {
+        // Warmup messages (negative stamp). The CPU time is measured from the last one.
+        if (stamp < 0)
+        {
+            this->cpu_start_ = cpuTime(CLOCK_THREAD_CPUTIME_ID);
+            this->ready_ = true;
+            return;
+        }
+
+        // Benchmark messages. The end time is updated with each message, since the UDP cases can lose the last ones.
+        this->end_tp_ = std::chrono::steady_clock::now();
+        this->latencies_.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(this->end_tp_.time_since_epoch()).count() - stamp);
+        if (++this->received_ == this->expected_)
+        {
+            this->cpu_end_ = cpuTime(CLOCK_THREAD_CPUTIME_ID);
+            this->promise_.set_value();
+        }
+    }
+
+    bool isReady() const {return this->ready_;}
+    unsigned getReceived() const {return this->received_;}
+    std::chrono::nanoseconds getCpuTime() const {return this->cpu_end_ - this->cpu_start_;}
+    std::chrono::steady_clock::time_point getEndTime() const {return this->end_tp_;}
+    const std::vector<std::int64_t>& getLatencies() const {return this->latencies_;}
+    std::future<void>& getFuture() {return this->future_;}
+
+private:
+
+    void onSubscriberStart() override {}
+    void onSubscriberStop() override {}
+    void onSubscriberError(const zmq::error_t &error, const std::string &ext_info) override
+    {
+        std::cerr << "Subscriber error: " << error.what() << " " << ext_info << std::endl;
+    }
+
+    const unsigned expected_;
+    std::atomic<unsigned> received_;
+    std::atomic_bool ready_;
+    std::chrono::nanoseconds cpu_start_ {0};
+    std::chrono::nanoseconds cpu_end_ {0};
+    std::chrono::steady_clock::time_point end_tp_;
+    std::vector<std::int64_t> latencies_;
+    std::promise<void> promise_;
+    std::future<void> future_;
+};
+
+// Run a benchmark case.
+BenchmarkResult runCase(const BenchmarkCase& config)
+{
+    BenchmarkResult result;
+    result.config = config;
+
+    // Publisher. The high water marks are disabled (they have priority over the socket options presets), so the TCP
+    // transport never drops messages.
+    const SocketOptions socket_options = socketOptionsForProfile(config.profile);
+    PublisherBase publisher(kBenchmarkPort, "*", "BENCHMARK PUBLISHER", "1.0.0", "LibZMQUtils benchmark publisher.");
+    publisher.setSocketOptions(socket_options);
+    publisher.setSendHWM(0);
+    publisher.setDirectSendEnabled(config.direct);
+    if (config.transport == "udp" && !publisher.setUdpTransport(kUdpEndpoint))
+    {
+        std::cerr << "UDP transport not available (LibZMQ draft API needed)!!" << std::endl;
+        return result;
+    }
+    if (config.transport == "ipc" || config.transport == "inproc")
+        publisher.setLocalTransport(config.transport == "ipc" ? kIpcEndpoint : kInprocEndpoint);
+    const std::string endpoint = config.transport == "tcp" ? kTcpEndpoint :
+                                 config.transport == "udp" ? kUdpEndpoint :
+                                 config.transport == "ipc" ? kIpcEndpoint : kInprocEndpoint;
+    if (!publisher.startPublisher())
+    {
+        std::cerr << "Publisher start failed!!" << std::endl;
+        return result;
+    }
+
+    // Subscribers. The benchmark topic is the last filter, so the rest of filters are checked before.
+    std::vector<std::unique_ptr<BenchmarkSubscriber>> subscribers;
+    for (unsigned i = 0; i < config.subscribers; i++)
+    {
+        auto subscriber = std::make_unique<BenchmarkSubscriber>(config.messages);
+        subscriber->setSocketOptions(socket_options);
+        subscriber->setReceiveHWM(0);
+        subscriber->subscribe(endpoint);
+        for (unsigned f = 1; f < config.filters; f++)
+            subscriber->addTopicFilter("BENCHMARK_FILTER_" + std::to_string(f));
+        subscriber->addTopicFilter(kBenchmarkTopic);
+        subscriber->registerCbAndReqProcFunc<std::function<void(const std::int64_t&, const std::string&)>>(
+            kBenchmarkTopic, subscriber.get(), &BenchmarkSubscriber::handleMsg);
+        if (!subscriber->startSubscriber())
+        {
+            std::cerr << "Subscriber start failed!!" << std::endl;
+            return result;
+        }
+        subscribers.push_back(std::move(subscriber));
+    }
+
+    // Warmup until every subscriber is connected (avoiding the slow joiner problem). The warmup messages use the
+    // same priority than the benchmark, so they are always received before the benchmark messages.
+    const std::string payload(config.payload_size, 'x');
+    const std::int64_t warmup_stamp = -1;
+    auto warmup_limit = std::chrono::steady_clock::now() + kWarmupTimeout;
+    while (!std::all_of(subscribers.begin(), subscribers.end(), [](const auto& s){return s->isReady();}))
+    {
+        if (std::chrono::steady_clock::now() > warmup_limit)
+        {
+            std::cerr << "Warmup timeout!!" << std::endl;
+            return result;
+        }
+        publisher.enqueueMsg(kBenchmarkTopic, config.priority, warmup_stamp, payload);
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    // Publish the messages. If the sending queue is full, wait for the publisher worker.
+    auto cpu_start = cpuTime(CLOCK_PROCESS_CPUTIME_ID);
+    auto start_tp = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < config.messages; i++)
+    {
+        std::int64_t stamp = steadyStamp();
+        while (publisher.enqueueMsg(kBenchmarkTopic, config.priority, stamp, payload) ==
+               OperationResult::OVERFLOW_QUEUE)
+        {
+            std::this_thread::yield();
+            stamp = steadyStamp();
+        }
+    }
+
+    // Wait for all the subscribers. The UDP cases also finish when a subscriber stops receiving messages.
+    result.completed = true;
+    for (auto& subscriber : subscribers)
+    {
+        if (config.transport != "udp")
+        {
+            if (subscriber->getFuture().wait_until(start_tp + kCaseTimeout) != std::future_status::ready)
+                result.completed = false;
+            continue;
+        }
+        unsigned last_received = subscriber->getReceived();
+        auto last_change = std::chrono::steady_clock::now();
+        while (subscriber->getFuture().wait_for(std::chrono::milliseconds(10)) != std::future_status::ready)
+        {
+            auto now = std::chrono::steady_clock::now();
+            if (subscriber->getReceived() != last_received)
+            {
+                last_received = subscriber->getReceived();
+                last_change = now;
+            }
+            else if (now - last_change > kUdpDrainTimeout || now > start_tp + kCaseTimeout)
+            {
+                result.completed = false;
+                break;
+            }
+        }
+    }
+    auto cpu_end = cpuTime(CLOCK_PROCESS_CPUTIME_ID);
+
+    // Stop all.
+    for (auto& subscriber : subscribers)
+        subscriber->stopSubscriber();
+    publisher.stopPublisher();
+
+    // Get the results.
+    std::chrono::steady_clock::time_point end_tp = start_tp;
+    std::chrono::nanoseconds sub_cpu(0);
+    for (const auto& subscriber : subscribers)
+    {
+        result.received += subscriber->getReceived();
+        end_tp = std::max(end_tp, subscriber->getEndTime());
+        sub_cpu += subscriber->getCpuTime();
+        result.latencies_ns.insert(result.latencies_ns.end(), subscriber->getLatencies().begin(),
+                                   subscriber->getLatencies().end());
+    }
+    std::sort(result.latencies_ns.begin(), result.latencies_ns.end());
+    result.lost = static_cast<std::uint64_t>(config.messages) * config.subscribers - result.received;
+    if ((!result.completed && config.transport != "udp") || 0 == result.received)
+        return result;
+
+    // The CPU time of the subscribers is only measured if they received every message.
+    const double messages = static_cast<double>(config.messages);
+    result.elapsed_s = std::chrono::duration<double>(end_tp - start_tp).count();
+    result.msgs_per_s = messages / result.elapsed_s;
+    result.deliveries_per_s = static_cast<double>(result.received) / result.elapsed_s;
+    result.mb_per_s = messages * static_cast<double>(config.payload_size) / 1e6 / result.elapsed_s;
+    if (!result.completed)
+        return result;
+    result.sub_cpu_ns_per_msg = static_cast<double>(sub_cpu.count()) / static_cast<double>(result.received);
+    result.pub_cpu_ns_per_msg = static_cast<double>((cpu_end - cpu_start - sub_cpu).count()) / messages;
+    return result;
+}
+
+// Get a percentile of the sorted latencies, in microseconds.
+double percentileUs(const std::vector<std::int64_t>& sorted, double percentile)
+{
+    if (sorted.empty())
+        return 0;
+    std::size_t idx = static_cast<std::size_t>(percentile / 100.0 * static_cast<double>(sorted.size() - 1) + 0.5);
+    return static_cast<double>(sorted[idx]) / 1000.0;
+}
+
+// Convert a benchmark result to a JSON object.
+std::string resultToJson(const BenchmarkResult& result)
+{
+    static const char* const kPriorityNames[] = {"no", "low", "normal", "high", "critical"};
+    const BenchmarkCase& config = result.config;
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"group\": \"" << config.group << "\", "
+         << "\"transport\": \"" << config.transport << "\", "
+         << "\"payload_bytes\": " << config.payload_size << ", "
+         << "\"subscribers\": " << config.subscribers << ", "
+         << "\"filters\": " << config.filters << ", "
+         << "\"priority\": \"" << kPriorityNames[static_cast<std::size_t>(config.priority)] << "\", "
+         << "\"messages\": " << config.messages << ", "
+         << "\"publish_mode\": \"" << (config.direct ? "direct" : "queued") << "\", "
+         << "\"socket_profile\": \"" << config.profile << "\", "
+         << "\"completed\": " << (result.completed ? "true" : "false") << ", "
+         << "\"received\": " << result.received << ", "
+         << "\"lost\": " << result.lost << ", "
+         << "\"loss_pct\": " << (0 == config.messages ? 0.0 : 100.0 * static_cast<double>(result.lost) /
+                                  (static_cast<double>(config.messages) * config.subscribers)) << ", "
+         << "\"elapsed_s\": " << result.elapsed_s << ", "
+         << "\"msgs_per_s\": " << result.msgs_per_s << ", "
+         << "\"deliveries_per_s\": " << result.deliveries_per_s << ", "
+         << "\"mb_per_s\": " << result.mb_per_s << ", "
+         << "\"pub_cpu_ns_per_msg\": " << result.pub_cpu_ns_per_msg << ", "
+         << "\"sub_cpu_ns_per_msg\": " << result.sub_cpu_ns_per_msg << ", "
+         << "\"latency_us\": {"
+         << "\"p50\": " << percentileUs(result.latencies_ns, 50) << ", "
+         << "\"p90\": " << percentileUs(result.latencies_ns, 90) << ", "
+         << "\"p99\": " << percentileUs(result.latencies_ns, 99) << ", "
+         << "\"p99_9\": " << percentileUs(result.latencies_ns, 99.9) << ", "
+         << "\"max\": " << percentileUs(result.latencies_ns, 100) << "}}";
+    return json.str();
+}
+
+// Generate the benchmark cases.
+std::vector<BenchmarkCase> generateCases(bool quick, bool udp)
+{
+    std::vector<BenchmarkCase> cases;
+    const unsigned base_msgs = quick ? 10000 : 100000;
+    const std::size_t bytes_budget = quick ? (32u << 20) : (256u << 20);
+
+    // UDP against TCP, with payloads that fit in a single datagram.
+    if (udp)
+    {
+        for (std::size_t size : {0, 64, 1024, 4096})
+        {
+            for (const char* transport : {"tcp", "udp"})
+                cases.push_back({"udp", transport, size, 1, 1, MessagePriority::NormalPriority, base_msgs / 2});
+        }
+        return cases;
+    }
+
+    // Payload sizes for each transport. The number of messages is limited by the bytes budget.
+    for (const char* transport : {"tcp", "ipc", "inproc"})
+    {
+        for (std::size_t size : {0, 64, 1024, 16384, 262144, 1048576})
+        {
+            unsigned msgs = static_cast<unsigned>(std::clamp<std::size_t>(bytes_budget / std::max<std::size_t>(size, 1),
+                                                                          100, base_msgs));
+            cases.push_back({"payload", transport, size, 1, 1, MessagePriority::NormalPriority, msgs});
+        }
+    }
+
+    // Fan-out.
+    for (unsigned subscribers : {1, 8, 64})
+        cases.push_back({"fanout", "tcp", 64, subscribers, 1, MessagePriority::NormalPriority, base_msgs / 5});
+
+    // Topic filters.
+    for (unsigned filters : {1, 100, 1000, 10000})
+        cases.push_back({"filters", "tcp", 64, 1, filters, MessagePriority::NormalPriority, base_msgs / 2});
+
+    // Priorities.
+    for (MessagePriority priority : {MessagePriority::NoPriority, MessagePriority::LowPriority,
+                                     MessagePriority::NormalPriority, MessagePriority::HighPriority,
+                                     MessagePriority::CriticalPriority})
+        cases.push_back({"priority", "tcp", 64, 1, 1, priority, base_msgs / 2});
+
+    // Queued publication against direct send.
+    for (const char* transport : {"tcp", "ipc", "inproc"})
+    {
+        for (bool direct : {false, true})
+            cases.push_back({"mode", transport, 64, 1, 1, MessagePriority::NormalPriority, base_msgs / 2, direct});
+    }
+
+    // Socket options presets.
+    for (const char* profile : {"default", "low_latency", "bulk", "constrained_link"})
+    {
+        for (std::size_t size : {64, 65536})
+        {
+            unsigned msgs = static_cast<unsigned>(std::min<std::size_t>(bytes_budget / size, base_msgs / 2));
+            cases.push_back({"profile", "tcp", size, 1, 1, MessagePriority::NormalPriority, msgs, false, profile});
+        }
+    }
+
+    return cases;
+}
+
+/**
+ * Main entrypoint of the benchmark.
+ *
+ * Usage: Benchmark_PublisherSubscriber [--quick] [--transport udp] [--output <file>]
+ */
+int main(int argc, char**argv)
+{
+    // Parse the arguments.
+    bool quick = false;
+    bool udp = false;
+    std::string output;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--output" && i + 1 < argc)
+            output = argv[++i];
+        else if (arg == "--transport" && i + 1 < argc && std::string(argv[i + 1]) == "udp")
+        {
+            udp = true;
+            i++;
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--transport udp] [--output <file>]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Run the cases.
+    std::vector<BenchmarkCase> cases = generateCases(quick, udp);
+    std::ostringstream json;
+    json << "{\"benchmark\": \"PublisherSubscriber\", "
+         << "\"date\": \"" << zmqutils::utils::currentISO8601Date() << "\", "
+         << "\"hardware_threads\": " << std::thread::hardware_concurrency() << ", "
+         << "\"results\": [\n";
+    for (std::size_t i = 0; i < cases.size(); i++)
+    {
+        std::cerr << "Running case " << (i + 1) << "/" << cases.size() << " (" << cases[i].group << ", "
+                  << cases[i].transport << ", " << cases[i].payload_size << " B, " << cases[i].subscribers
+                  << " subs, " << cases[i].filters << " filters, " << cases[i].profile << " sockets)..." << std::endl;
+        json << "  " << resultToJson(runCase(cases[i])) << (i + 1 < cases.size() ? ",\n" : "\n");
+    }
+    json << "]}\n";
+
+    // Write the results.
+    if (output.empty())
+    {
+        std::cout << json.str();
+        return 0;
+    }
+    std::ofstream file(output);
+    if (!file)
+    {
+        std::cerr << "Unable to open the output file: " << output << std::endl;
+        return 1;
+    }
+    file << json.str();
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
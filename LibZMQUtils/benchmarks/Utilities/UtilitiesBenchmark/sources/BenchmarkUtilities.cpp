@@ -0,0 +1,360 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   ExamplesLibZMQUtils related project.                                                                              *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @example BenchmarkUtilities.cpp
+ *
+ * @brief Benchmark of the hot path utilities used for every message (ISO 8601 datetimes and UUID strings).
+ *
+ * Each case measures the nanoseconds per operation of the library implementation and of a reference implementation
+ * (the previous stream and regex based code), and the resulting speedup:
+ *   - iso8601_format: time point to ISO 8601 string, UTC and local time, with milliseconds and nanoseconds, into a
+ *     std::string (timePointToIso8601) and into a stack buffer (formatIso8601).
+ *   - iso8601_parse: ISO 8601 string to time point (parseIso8601Datetime) and validation (isValidIso8601Datetime).
+ *   - uuid: UUID to RFC 4122 string (toRFC4122String), into a buffer (toRFC4122Chars) and into a stream, and the
+ *     parsing of the string (fromRFC4122String, the reference parses each pair with std::stoul).
+ *
+ * The results are written as JSON to the standard output or to the file given with `--output <file>`. The `--quick`
+ * option reduces the number of iterations of each case.
+ *
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <regex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/Utilities>
+// =====================================================================================================================
+
+// ---------------------------------------------------------------------------------------------------------------------
+// ZMQ Utils Namsespaces.
+using zmqutils::utils::TimePointStd;
+using zmqutils::utils::HRTimePointStd;
+// ---------------------------------------------------------------------------------------------------------------------
+
+// Sink for avoiding the optimization of the benchmarked operations.
+volatile std::size_t g_sink = 0;
+
+// Reference ISO 8601 formatting (gmtime, put_time and ostringstream).
+std::string referenceIso8601(const TimePointStd& tp, bool add_ms, bool add_ns, bool utc)
+{
+    std::ostringstream ss;
+    const auto dur = tp.time_since_epoch();
+    const time_t secs = std::chrono::duration_cast<std::chrono::seconds>(dur).count();
+    const long long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(dur).count() - secs * 1000000000LL;
+    const std::tm *tm = utc ? std::gmtime(&secs) : std::localtime(&secs);
+    ss << std::put_time(tm, "%Y-%m-%dT%H:%M:%S");
+    if (add_ms && !add_ns)
+        ss << '.' << std::setw(3) << std::setfill('0') << ns / 1000000;
+    else if (add_ns)
+        ss << '.' << std::setw(9) << std::setfill('0') << ns;
+    ss << (utc ? "Z" : "+00:00");
+    return ss.str();
+}
+
+// Reference ISO 8601 validation (two regex built per call).
+bool referenceIsValidIso8601(const std::string& datetime)
+{
+    std::smatch match;
+    const std::regex iso8601_regex_extended(
+        R"(^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.(\d+))?(?:(Z)|((\+|\-)(\d{2}):(\d{2})))?$)");
+    const std::regex iso8601_regex_basic(
+        R"(^(\d{4})(\d{2})(\d{2})T(\d{2})(\d{2})(\d{2})(?:\.(\d+))?(?:(Z)|((\+|\-)(\d{2}):(\d{2})))?$)");
+    return std::regex_search(datetime, match, iso8601_regex_extended) ||
+           std::regex_search(datetime, match, iso8601_regex_basic);
+}
+
+// Reference RFC 4122 formatting (stringstream with setw and setfill for each byte).
+std::string referenceRFC4122(const zmqutils::utils::UUID& uuid)
+{
+    std::stringstream ss;
+    ss << std::hex << std::setfill('0');
+    for (std::size_t i = 0; i < zmqutils::utils::UUID::kUUIDSize; i++)
+    {
+        if (i == 4 || i == 6 || i == 8 || i == 10)
+            ss << '-';
+        ss << std::setw(2) << static_cast<int>(uuid.getBytes()[i]);
+    }
+    return ss.str();
+}
+
+// Reference RFC 4122 parsing (substrings and std::stoul for each byte).
+bool referenceParseRFC4122(const std::string& str, zmqutils::utils::UUID& uuid)
+{
+    if (str.size() != zmqutils::utils::UUID::kRFC4122StringSize)
+        return false;
+    std::string hex;
+    for (char c : str)
+        if (c != '-')
+            hex += c;
+    std::array<std::byte, zmqutils::utils::UUID::kUUIDSize> bytes;
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<std::byte>(std::stoul(hex.substr(i * 2, 2), nullptr, 16));
+    uuid = zmqutils::utils::UUID(bytes);
+    return true;
+}
+
+// Measure the nanoseconds per operation of a function.
+double measureNs(const std::function<void(unsigned)>& operation, unsigned iterations)
+{
+    // Warmup.
+    for (unsigned i = 0; i < iterations / 10 + 1; i++)
+        operation(i);
+
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < iterations; i++)
+        operation(i);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    return std::chrono::duration<double, std::nano>(elapsed).count() / iterations;
+}
+
+// Benchmark case result.
+struct BenchmarkResult
+{
+    std::string group;         // Case group (iso8601_format, iso8601_parse or uuid).
+    std::string name;          // Case name.
+    double reference_ns = 0;   // Reference implementation nanoseconds per operation.
+    double library_ns = 0;     // Library implementation nanoseconds per operation.
+};
+
+// Convert a benchmark result to a JSON object.
+std::string resultToJson(const BenchmarkResult& result)
+{
+    std::ostringstream json;
+    json << std::fixed << std::setprecision(3);
+    json << "{\"group\": \"" << result.group << "\", "
+         << "\"name\": \"" << result.name << "\", "
+         << "\"reference_ns_per_op\": " << result.reference_ns << ", "
+         << "\"library_ns_per_op\": " << result.library_ns << ", "
+         << "\"speedup\": " << (result.library_ns > 0 ? result.reference_ns / result.library_ns : 0) << "}";
+    return json.str();
+}
+
+// Run the ISO 8601 cases.
+std::vector<BenchmarkResult> runIso8601Cases(unsigned iterations)
+{
+    std::vector<BenchmarkResult> results;
+
+    // Time points spread over a few seconds, as in a stream of messages.
+    const TimePointStd base = std::chrono::system_clock::now();
+    auto tpAt = [base](unsigned i){return base + std::chrono::microseconds(i * 37);};
+
+    // Formatting.
+    for (bool utc : {true, false})
+    {
+        for (bool add_ns : {false, true})
+        {
+            const std::string name = std::string(utc ? "utc" : "local") + (add_ns ? "_ns" : "_ms");
+            BenchmarkResult string_result {"iso8601_format", name + "_string"};
+            string_result.reference_ns = measureNs([&](unsigned i)
+                {g_sink += referenceIso8601(tpAt(i), true, add_ns, utc).size();}, iterations);
+            string_result.library_ns = measureNs([&](unsigned i)
+                {g_sink += zmqutils::utils::timePointToIso8601(tpAt(i), true, add_ns, utc).size();}, iterations);
+            results.push_back(string_result);
+
+            BenchmarkResult buffer_result {"iso8601_format", name + "_buffer"};
+            buffer_result.reference_ns = string_result.reference_ns;
+            buffer_result.library_ns = measureNs([&](unsigned i)
+            {
+                char buffer[zmqutils::utils::kIso8601BufferSize];
+                g_sink += zmqutils::utils::formatIso8601(tpAt(i), buffer, sizeof(buffer), true, add_ns, utc);
+            }, iterations);
+            results.push_back(buffer_result);
+        }
+    }
+
+    // Parsing and validation. The reference parser used the same two regex than the validation.
+    for (const char* datetime : {"2025-01-09T18:58:41.870Z", "2025-01-09T18:58:41.870123456+02:00",
+                                 "20250109T185841.870Z"})
+    {
+        const std::string str(datetime);
+        const unsigned parse_iterations = iterations / 10 + 1;
+
+        BenchmarkResult parse_result {"iso8601_parse", "parse " + str};
+        parse_result.reference_ns = measureNs([&](unsigned){g_sink += referenceIsValidIso8601(str);},
+                                              parse_iterations);
+        parse_result.library_ns = measureNs([&](unsigned)
+        {
+            HRTimePointStd tp;
+            g_sink += zmqutils::utils::parseIso8601Datetime(str, tp);
+            g_sink += static_cast<std::size_t>(tp.time_since_epoch().count());
+        }, iterations);
+        results.push_back(parse_result);
+
+        BenchmarkResult valid_result {"iso8601_parse", "validate " + str};
+        valid_result.reference_ns = parse_result.reference_ns;
+        valid_result.library_ns = measureNs([&](unsigned)
+            {g_sink += zmqutils::utils::isValidIso8601Datetime(str);}, iterations);
+        results.push_back(valid_result);
+    }
+
+    return results;
+}
+
+// Run the UUID cases.
+std::vector<BenchmarkResult> runUUIDCases(unsigned iterations)
+{
+    std::vector<BenchmarkResult> results;
+
+    // UUIDs and their string representations.
+    std::vector<zmqutils::utils::UUID> uuids;
+    std::vector<std::string> strs;
+    for (unsigned i = 0; i < 1024; i++)
+    {
+        uuids.push_back(zmqutils::utils::UUIDGenerator::getInstance().generateUUIDv4());
+        strs.push_back(uuids.back().toRFC4122String());
+    }
+
+    BenchmarkResult string_result {"uuid", "to_string"};
+    string_result.reference_ns = measureNs([&](unsigned i){g_sink += referenceRFC4122(uuids[i % 1024]).size();},
+                                           iterations);
+    string_result.library_ns = measureNs([&](unsigned i){g_sink += uuids[i % 1024].toRFC4122String().size();},
+                                         iterations);
+    results.push_back(string_result);
+
+    BenchmarkResult chars_result {"uuid", "to_chars"};
+    chars_result.reference_ns = string_result.reference_ns;
+    chars_result.library_ns = measureNs([&](unsigned i)
+    {
+        char buffer[zmqutils::utils::UUID::kRFC4122StringSize];
+        uuids[i % 1024].toRFC4122Chars(buffer);
+        g_sink += static_cast<std::size_t>(buffer[i % sizeof(buffer)]);
+    }, iterations);
+    results.push_back(chars_result);
+
+    // Stream (as in the logs and the info dumps), reusing the stream.
+    std::ostringstream reference_stream, library_stream;
+    BenchmarkResult stream_result {"uuid", "to_stream"};
+    stream_result.reference_ns = measureNs([&](unsigned i)
+    {
+        reference_stream.seekp(0);
+        reference_stream << referenceRFC4122(uuids[i % 1024]);
+    }, iterations);
+    stream_result.library_ns = measureNs([&](unsigned i)
+    {
+        library_stream.seekp(0);
+        library_stream << uuids[i % 1024];
+    }, iterations);
+    results.push_back(stream_result);
+
+    BenchmarkResult parse_result {"uuid", "parse"};
+    parse_result.reference_ns = measureNs([&](unsigned i)
+    {
+        zmqutils::utils::UUID uuid;
+        g_sink += referenceParseRFC4122(strs[i % 1024], uuid);
+    }, iterations);
+    parse_result.library_ns = measureNs([&](unsigned i)
+    {
+        zmqutils::utils::UUID uuid;
+        g_sink += zmqutils::utils::UUID::fromRFC4122String(strs[i % 1024], uuid);
+    }, iterations);
+    results.push_back(parse_result);
+
+    return results;
+}
+
+/**
+ * Main entrypoint of the benchmark.
+ *
+ * Usage: Benchmark_Utilities [--quick] [--output <file>]
+ */
+int main(int argc, char**argv)
+{
+    // Parse the arguments.
+    bool quick = false;
+    std::string output;
+    for (int i = 1; i < argc; i++)
+    {
+        std::string arg = argv[i];
+        if (arg == "--quick")
+            quick = true;
+        else if (arg == "--output" && i + 1 < argc)
+            output = argv[++i];
+        else
+        {
+            std::cerr << "Usage: " << argv[0] << " [--quick] [--output <file>]" << std::endl;
+            return 1;
+        }
+    }
+
+    // Run the cases.
+    const unsigned iterations = quick ? 100000 : 1000000;
+    std::vector<BenchmarkResult> results = runIso8601Cases(iterations);
+    std::vector<BenchmarkResult> uuid_results = runUUIDCases(iterations);
+    results.insert(results.end(), uuid_results.begin(), uuid_results.end());
+    std::ostringstream json;
+    json << "{\"benchmark\": \"Utilities\", "
+         << "\"date\": \"" << zmqutils::utils::currentISO8601Date() << "\", "
+         << "\"hardware_threads\": " << std::thread::hardware_concurrency() << ", "
+         << "\"results\": [\n";
+    for (std::size_t i = 0; i < results.size(); i++)
+        json << "  " << resultToJson(results[i]) << (i + 1 < results.size() ? ",\n" : "\n");
+    json << "]}\n";
+
+    // Write the results.
+    if (output.empty())
+    {
+        std::cout << json.str();
+        return 0;
+    }
+    std::ofstream file(output);
+    if (!file)
+    {
+        std::cerr << "Unable to open the output file: " << output << std::endl;
+        return 1;
+    }
+    file << json.str();
+    return 0;
+}
+
+// ---------------------------------------------------------------------------------------------------------------------
@@ -85,19 +85,19 @@ private:
 };
 
 // Callback function type aliases
-using SetHomePositionFunction = std::function<AmelasError(const AltAzPos&)>;
-using GetHomePositionFunction = std::function<AmelasError(AltAzPos&)>;
-using DoOpenSearchTelescopeFunction = std::function<AmelasError()>;
+using SetHomePositionFunction = SetHomePositionSignature::CallbackType;
+using GetHomePositionFunction = GetHomePositionSignature::CallbackType;
+using DoOpenSearchTelescopeFunction = DoOpenSearchTelescopeSignature::CallbackType;
 
 // Callback function arguments type aliases
-using SetHomePositionFunctionInArgs = std::tuple<AltAzPos>;
-using SetHomePositionFunctionOutArgs = std::tuple<>;
+using SetHomePositionFunctionInArgs = SetHomePositionSignature::InputArgs;
+using SetHomePositionFunctionOutArgs = SetHomePositionSignature::OutputArgs;
 //
-using GetHomePositionFunctionInArgs = std::tuple<>;
-using GetHomePositionFunctionOutArgs = std::tuple<AltAzPos>;
+using GetHomePositionFunctionInArgs = GetHomePositionSignature::InputArgs;
+using GetHomePositionFunctionOutArgs = GetHomePositionSignature::OutputArgs;
 //
-using DoOpenSearchTelescopeFunctionInArgs = std::tuple<>;
-using DoOpenSearchTelescopeFunctionOutArgs = std::tuple<>;
+using DoOpenSearchTelescopeFunctionInArgs = DoOpenSearchTelescopeSignature::InputArgs;
+using DoOpenSearchTelescopeFunctionOutArgs = DoOpenSearchTelescopeSignature::OutputArgs;
 
 }} // END NAMESPACES.
 // =====================================================================================================================
@@ -54,6 +54,7 @@
 // ZMQUTILS INCLUDES
 // =====================================================================================================================
 #include <LibZMQUtils/Modules/Utilities>
+#include <LibZMQUtils/Modules/CommandServerClient>
 // =====================================================================================================================
 
 // AMELAS NAMESPACES
@@ -100,6 +101,14 @@ struct AltAzPos : public zmqutils::serializer::Serializable
     double el;
 };
 
+// Command signatures, shared by the server and the client.
+using SetHomePositionSignature =
+    zmqutils::reqrep::CommandSignature<std::function<AmelasError(const AltAzPos&)>, std::tuple<AltAzPos>>;
+using GetHomePositionSignature =
+    zmqutils::reqrep::CommandSignature<std::function<AmelasError(AltAzPos&)>, std::tuple<>, std::tuple<AltAzPos>>;
+using DoOpenSearchTelescopeSignature =
+    zmqutils::reqrep::CommandSignature<std::function<AmelasError()>>;
+
 // =====================================================================================================================
 
 }} // END NAMESPACES.
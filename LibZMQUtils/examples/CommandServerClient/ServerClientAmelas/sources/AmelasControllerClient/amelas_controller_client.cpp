@@ -72,19 +72,19 @@ bool AmelasControllerClient::validateCommand(zmqutils::reqrep::CommandType comma
 
 OperationResult AmelasControllerClient::getHomePosition(controller::AltAzPos &pos, controller::AmelasError &res)
 {    
-    return this->executeCommand(AmelasServerCommand::REQ_GET_HOME_POSITION, res, pos);
+    return this->call<controller::GetHomePositionSignature>(AmelasServerCommand::REQ_GET_HOME_POSITION, res, pos);
 }
 
 OperationResult AmelasControllerClient::setHomePosition(const controller::AltAzPos &pos,
                                                           controller::AmelasError &res)
 {
-    RequestData request = this->prepareRequestData(pos);
-    return this->executeCommand(AmelasServerCommand::REQ_SET_HOME_POSITION, request, res);
+    return this->call<controller::SetHomePositionSignature>(AmelasServerCommand::REQ_SET_HOME_POSITION, pos, res);
 }
 
 OperationResult AmelasControllerClient::doOpenSearchTelescope(controller::AmelasError &res)
 {
-    return this->executeCommand(AmelasServerCommand::REQ_DO_OPEN_SEARCH_TELESCOPE, res);
+    return this->call<controller::DoOpenSearchTelescopeSignature>(AmelasServerCommand::REQ_DO_OPEN_SEARCH_TELESCOPE,
+                                                                  res);
 }
 
 OperationResult AmelasControllerClient::doExampleNotImp(controller::AmelasError &res)
@@ -73,15 +73,9 @@ using amelas::communication::AmelasControllerServer;
 using amelas::communication::AmelasServerCommand;
 using amelas::controller::AmelasController;
 // Amelas Callbacks
-using amelas::controller::SetHomePositionFunction;
-using amelas::controller::SetHomePositionFunctionInArgs;
-using amelas::controller::SetHomePositionFunctionOutArgs;
-using amelas::controller::GetHomePositionFunction;
-using amelas::controller::GetHomePositionFunctionInArgs;
-using amelas::controller::GetHomePositionFunctionOutArgs;
-using amelas::controller::DoOpenSearchTelescopeFunction;
-using amelas::controller::DoOpenSearchTelescopeFunctionInArgs;
-using amelas::controller::DoOpenSearchTelescopeFunctionOutArgs;
+using amelas::controller::SetHomePositionSignature;
+using amelas::controller::GetHomePositionSignature;
+using amelas::controller::DoOpenSearchTelescopeSignature;
 // ---------------------------------------------------------------------------------------------------------------------
 
 /**
@@ -126,23 +120,17 @@ int main(int, char**)
 
     // Set the controller callbacks in the server.
 
-    amelas_server.registerCbAndReqProcFunc<SetHomePositionFunction,
-                                           SetHomePositionFunctionInArgs,
-                                           SetHomePositionFunctionOutArgs>
+    amelas_server.registerCbAndReqProcFunc<SetHomePositionSignature>
         (AmelasServerCommand::REQ_SET_HOME_POSITION,
          &amelas_controller,
          &AmelasController::setHomePosition);
 
-    amelas_server.registerCbAndReqProcFunc<GetHomePositionFunction,
-                                       GetHomePositionFunctionInArgs,
-                                       GetHomePositionFunctionOutArgs>
+    amelas_server.registerCbAndReqProcFunc<GetHomePositionSignature>
         (AmelasServerCommand::REQ_GET_HOME_POSITION,
          &amelas_controller,
          &AmelasController::getHomePosition);
 
-    amelas_server.registerCbAndReqProcFunc<DoOpenSearchTelescopeFunction,
-                                       DoOpenSearchTelescopeFunctionInArgs,
-                                       DoOpenSearchTelescopeFunctionOutArgs>
+    amelas_server.registerCbAndReqProcFunc<DoOpenSearchTelescopeSignature>
         (AmelasServerCommand::REQ_DO_OPEN_SEARCH_TELESCOPE,
          &amelas_controller,
          &AmelasController::doOpenSearchTelescope);
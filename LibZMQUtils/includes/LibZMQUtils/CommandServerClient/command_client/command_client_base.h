@@ -46,6 +46,7 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <future>
+#include <memory>
 #include <string>
 // =====================================================================================================================
 
@@ -53,9 +54,13 @@
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/Global/zmq_reactor.h"
+#include "LibZMQUtils/Global/zmq_socket_options.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
 #include "LibZMQUtils/CommandServerClient/data/command_server_client_data.h"
 #include "LibZMQUtils/CommandServerClient/data/command_server_client_info.h"
+#include "LibZMQUtils/CommandServerClient/data/command_signature.h"
 // =====================================================================================================================
 
 namespace zmq
@@ -158,6 +163,62 @@ public:
      */
     void disableAutoAlive();
 
+    /**
+     * @brief Set the configuration (name, CPU affinity and scheduling) of the auto alive worker thread. By default,
+     *        the thread is only named "zmq-alive".
+     * @param config The thread configuration.
+     * @note This value will only be modified if the auto alive worker is not running. It is not used with a reactor.
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the auto alive worker thread.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the auto alive worker thread (the last one, if it is not running).
+     * @return The CPU time of the worker thread.
+     * @note With a reactor, the alive messages are handled in the reactor loop and this time is not increased.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Sets the shared reactor used for the automatic alive messages, instead of a dedicated worker thread.
+     *
+     * With a reactor, the alive messages are sent by a reactor timer, their replies are received in the reactor loop
+     * and the server alive timeout is another reactor timer. The client doesn't create the auto alive thread.
+     *
+     * @param reactor The shared reactor, or nullptr for using a dedicated worker thread (the default).
+     *
+     * @note This value will only be modified if the client is stopped. The reactor must be running when the auto
+     *       alive starts (otherwise `onClientError` is called and the auto alive is not started), and the client
+     *       should be stopped before the reactor.
+     */
+    void setReactor(std::shared_ptr<ZMQReactor> reactor);
+
+    /**
+     * @brief Get the shared reactor used for the automatic alive messages.
+     * @return The reactor, or nullptr if the client uses a dedicated worker thread.
+     */
+    std::shared_ptr<ZMQReactor> getReactor() const;
+
+    /**
+     * @brief Set the tuning options (buffers, TCP keepalive, TOS...) of the client socket. See SocketOptions for the
+     *        available presets.
+     * @param options The socket options.
+     * @note This value will only be modified if the client is stopped. The `immediate` option is never applied to
+     *       the client socket, since a REQ socket with ZMQ_IMMEDIATE blocks the send while the server is down.
+     */
+    void setSocketOptions(const SocketOptions& options);
+
+    /**
+     * @brief Get the tuning options of the client socket.
+     * @return The socket options.
+     */
+    SocketOptions getSocketOptions() const;
+
     /**
      * @brief Checks if the server is considered currently connected.
      *
@@ -339,6 +400,12 @@ public:
 
 protected:
 
+    /**
+     * @brief Check if the client context is in use (the client is working).
+     * @return True if the client is working.
+     */
+    bool isContextInUse() const override;
+
     template <std::size_t N1>
     void registerCommandToStrLookup(const std::array<const char*, N1>& lookup_array)
     {
@@ -430,6 +497,73 @@ protected:
         return this->executeCommand(cmd, empty_data, std::forward<Args&>(args)...);
     }
 
+    /**
+     * @brief Execute a typed command, checked at compile time against a CommandSignature shared with the server.
+     *
+     * The arguments are the request inputs followed by the reply outputs, in the same order as the signature (first
+     * the `InputArgs`, then the callback return value if it is not void, and finally the `OutputArgs`). The inputs are
+     * serialized into a single buffer allocated with its exact size (known at compile time when all the input types
+     * have a fixed serialized size), and if the command is executed successfully (`COMMAND_OK`) the reply is
+     * deserialized directly into the output arguments. For example:
+     *
+     * @code
+     * AltAzPos pos;
+     * AmelasError res;
+     * OperationResult op_res = this->call<GetHomePositionSignature>(AmelasServerCommand::REQ_GET_HOME_POSITION,
+     *                                                               res, pos);
+     * @endcode
+     *
+     * @tparam Signature The CommandSignature of the command.
+     * @param cmd  The command to be executed.
+     * @param args The request inputs followed by the reply outputs.
+     * @return The OperationResult result of the command execution.
+     */
+    template <typename Signature, typename Cmd, typename... Args>
+    zmqutils::reqrep::OperationResult call(Cmd cmd, Args&&... args)
+    {
+        static_assert(is_command_signature_v<Signature>, "The Signature must be a CommandSignature.");
+
+        using InputArgs = typename Signature::InputArgs;
+        using ReplyArgs = typename Signature::ReplyArgs;
+        using CallArgs = decltype(std::tuple_cat(std::declval<InputArgs>(), std::declval<ReplyArgs>()));
+
+        static_assert(sizeof...(Args) == Signature::kNumInputs + Signature::kNumReplyValues,
+                      "The number of arguments does not match the command signature.");
+        static_assert(std::is_same_v<std::tuple<std::decay_t<Args>...>, CallArgs>,
+                      "The types of the arguments do not match the command signature.");
+
+        // References to all the arguments.
+        auto refs = std::forward_as_tuple(args...);
+
+        // Prepare the request with the inputs.
+        RequestData request = CommandClientBase::prepareRequestDataFrom(
+            refs, std::make_index_sequence<Signature::kNumInputs>());
+
+        // Send the command.
+        zmqutils::reqrep::CommandReply reply;
+        zmqutils::reqrep::OperationResult op_res = this->sendCommand(cmd, request, reply);
+
+        // Deserialize the reply directly into the outputs.
+        if constexpr (Signature::kNumReplyValues > 0)
+        {
+            if (zmqutils::reqrep::OperationResult::COMMAND_OK == op_res)
+            {
+                try
+                {
+                    CommandClientBase::deserializeReplyInto<Signature::kNumInputs>(
+                        reply, refs, std::make_index_sequence<Signature::kNumReplyValues>());
+                }
+                catch(...)
+                {
+                    op_res = zmqutils::reqrep::OperationResult::BAD_PARAMETERS;
+                }
+            }
+        }
+
+        // Return the operation result.
+        return op_res;
+    }
+
     /**
      * @brief Base client start callback. Subclasses must override this function.
      *
@@ -535,6 +669,9 @@ private:
     /// Internal function for receive from socket.
     void recvFromSocket(CommandReply&repl, zmq::socket_t *recv_socket, zmq::socket_t *close_socket);
 
+    /// Internal function for receiving and parsing a reply from a readable socket.
+    void recvReply(zmq::socket_t& recv_socket, CommandReply& reply);
+
     /// Internal function to delete the sockets.
     void deleteSockets();
 
@@ -553,10 +690,35 @@ private:
     /// Internal alive function that acts as a thread worker.
     void aliveWorker();
 
+    /// Internal functions of the auto alive functionality with a reactor (they run in the reactor loop).
+    void startReactorAlive();
+    void stopReactorAlive();
+    void sendReactorAlive();
+    void recvReactorAlive();
+    void reactorAliveTimeout();
+
     /// Internal function for preparing the messages with the request data.
     /// Be careful with this function, since it takes the ownership of the data.
     zmq::multipart_t prepareMessage(CommandRequest &command_request);
 
+    /// Internal helper for preparing the request data with the first elements of a tuple of references.
+    template <typename Tuple, std::size_t... I>
+    static RequestData prepareRequestDataFrom(const Tuple& refs, std::index_sequence<I...>)
+    {
+        return CommandClientBase::prepareRequestData(std::get<I>(refs)...);
+    }
+
+    /// Internal helper for deserializing the reply data into the tuple of references, starting at the Offset element.
+    template <std::size_t Offset, typename Tuple, std::size_t... I>
+    static void deserializeReplyInto(CommandReply& reply, Tuple& refs, std::index_sequence<I...>)
+    {
+        static_assert((!std::is_const_v<std::remove_reference_t<std::tuple_element_t<Offset + I, Tuple>>> && ...),
+                      "The reply outputs can not be const.");
+
+        zmqutils::serializer::BinarySerializer::fastDeserialization(
+            reply.data.bytes.get(), reply.data.size, std::get<Offset + I>(refs)...);
+    }
+
     // Internal client identification.
     CommandClientInfo client_info_;       ///< External client information for identification.
 
@@ -581,6 +743,13 @@ private:
     std::future<void> auto_alive_future_;     ///< Future for the auto alive worker.
     std::condition_variable auto_alive_cv_;   ///< Auto alive condition variable for check status.
 
+    // Auto alive functionality with a reactor (only used by the reactor loop).
+    std::shared_ptr<ZMQReactor> reactor_;      ///< Shared reactor (nullptr for using the auto alive thread).
+    zmq::socket_t *reactor_alive_socket_;      ///< Alive socket polled by the reactor.
+    ZMQReactor::HandlerId alive_socket_id_;    ///< Reactor registration of the alive socket.
+    ZMQReactor::HandlerId alive_timer_id_;     ///< Reactor timer for sending the alive messages.
+    ZMQReactor::HandlerId alive_timeout_id_;   ///< Reactor timer for the server alive timeout (0 if not waiting).
+
     // To string functions containers.
     CommandToStringFunction command_to_string_function_;  ///< Function to transform ServerCommand into strings.
 
@@ -595,6 +764,11 @@ private:
     // Configurable parameters.
     std::atomic_uint server_alive_timeout_;    ///< Tiemout for consider a server dead (in msec).
     std::atomic_uint send_alive_period_;       ///< Server reconnection number of attempts.
+    SocketOptions socket_options_;             ///< Tuning options of the client socket.
+
+    // Worker thread configuration.
+    utils::ThreadConfig thread_config_;        ///< Configuration of the auto alive worker thread.
+    utils::ThreadCpuClock worker_cpu_clock_;   ///< CPU time of the auto alive worker thread.
 
     /// Specific class scope (for debug purposes).
     inline static const std::string kScope = "[LibZMQUtils,CommandServerClient,CommandClientBase]";
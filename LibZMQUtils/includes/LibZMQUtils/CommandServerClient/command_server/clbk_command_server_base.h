@@ -46,12 +46,15 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <string>
+#include <set>
+#include <optional>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/CommandServerClient/command_server/command_server_base.h"
+#include "LibZMQUtils/CommandServerClient/data/command_signature.h"
 #include "LibZMQUtils/Utilities/callback_handler.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
 #include "LibZMQUtils/InternalHelpers/tuple_helpers.h"
@@ -111,7 +114,9 @@ public:
      * with the appropriate callback, thereby reducing manual boilerplate code and potential errors.
      *
      * @tparam CallbackType The type of the callback handler, usually determining how the callback will
-     *         be invoked and with what parameters.
+     *         be invoked and with what parameters. It can also be a CommandSignature shared with the clients. In
+     *         that case, the InputTuple and OutputTuple are taken from the signature and the callback method is
+     *         checked at compile time against it.
      * @tparam InputTuple A tuple describing the types of data expected as input from the request.
      *         Used to deserialize and pass data to the callback.
      * @tparam OutputTuple A tuple describing the types of data that will be output or modified by the
@@ -127,29 +132,56 @@ public:
      * @param object Pointer to the instance of the object on which the callback method will be called.
      * @param callback Member function pointer to the callback method that will be invoked to process
      *        the command.
+     * @return True if the callback was registered, false if the server is working.
      */
     template<typename CallbackType, typename InputTuple = std::tuple<>, typename OutputTuple = std::tuple<>,
              typename CmdId, typename ClassT, typename RetT = void, typename... Args>
-    void registerCbAndReqProcFunc(CmdId command, ClassT* object, RetT(ClassT::*callback)(Args...))
+    bool registerCbAndReqProcFunc(CmdId command, ClassT* object, RetT(ClassT::*callback)(Args...))
     {
-        // Register the callback.
-        this->registerCallback(command, object, callback);
+        // Bind the callback into the process function, so the requests do not look it up in the callback handler.
+        auto bound_callback = [object, callback](auto&&... args) -> RetT
+        {
+            return (object->*callback)(std::forward<decltype(args)>(args)...);
+        };
 
         // Process function lambda.
-        auto lambda_proc_func = [this](const CommandRequest& request, CommandReply& reply)
+        auto lambda_proc_func = [this, bound_callback](const CommandRequest& request, CommandReply& reply)
         {
-            this->processClbkRequest<CallbackType, RetT, InputTuple, OutputTuple>(request, reply);
+            if constexpr (is_command_signature_v<CallbackType>)
+            {
+                static_assert(std::is_same_v<typename CallbackType::CallbackType, std::function<RetT(Args...)>>,
+                              "The callback does not match the command signature.");
+
+                this->processBoundClbkRequest<RetT, typename CallbackType::InputArgs,
+                                              typename CallbackType::OutputArgs>(bound_callback, request, reply);
+            }
+            else
+            {
+                this->processBoundClbkRequest<RetT, InputTuple, OutputTuple>(bound_callback, request, reply);
+            }
         };
 
-        // Automatic command process function registration.
-        this->registerReqProcFunc(static_cast<zmqutils::reqrep::CommandType>(command), lambda_proc_func);
+        // Automatic command process function registration (only while the server is stopped).
+        if (!this->registerReqProcFunc(static_cast<zmqutils::reqrep::CommandType>(command), lambda_proc_func))
+            return false;
+
+        // Register the callback.
+        this->registerCallback(command, object, callback);
+        this->bound_clbk_cmds_.insert(static_cast<ServerCommand>(command));
+        return true;
     }
 
     /**
      * @brief Remove the registered callback for a specific command.
+     *
+     * If the callback was registered with `registerCbAndReqProcFunc`, the command will reply `EMPTY_EXT_CALLBACK`.
+     * In that case the callback is bound into the dispatch table of the server, so it can only be removed while the
+     * server is stopped.
+     *
      * @param command, the command whose callback will be erased.
+     * @return True if the callback was removed, false if it is bound and the server is working.
      */
-    void removeCallback(ServerCommand command);
+    bool removeCallback(ServerCommand command);
 
     /**
      * @brief Check if there is a registered callback for a specific command.
@@ -189,6 +221,114 @@ protected:
     template<typename CallbackType, typename RetT, typename InputTuple, typename OutputTuple>
     void processClbkRequest(const zmqutils::reqrep::CommandRequest& request,
                             zmqutils::reqrep::CommandReply& reply)
+    {
+        // Invoke the callback through the callback handler.
+        auto invoker = [this, &request, &reply](auto&&... args)
+        {
+            return this->invokeCallback<CallbackType, RetT>(request, reply, std::forward<decltype(args)>(args)...);
+        };
+
+        this->processClbkRequestWith<RetT, InputTuple, OutputTuple>(invoker, request, reply);
+    }
+
+    /**
+     * @brief Processes a callback request like `processClbkRequest`, but invoking a callback already bound to the
+     *        process function instead of looking it up in the callback handler (no locks nor casts per request).
+     *
+     * @tparam RetT The return type of the callback function.
+     * @tparam InputTuple A tuple containing types of the input parameters.
+     * @tparam OutputTuple A tuple containing types of the output parameters.
+     * @tparam BoundCallback The type of the bound callback.
+     * @param callback The bound callback.
+     * @param request A reference to the CommandRequest object containing input bytes and command details.
+     * @param reply A reference to the CommandReply object to store the results of the callback invocation.
+     */
+    template<typename RetT, typename InputTuple, typename OutputTuple, typename BoundCallback>
+    void processBoundClbkRequest(const BoundCallback& callback,
+                                 const zmqutils::reqrep::CommandRequest& request,
+                                 zmqutils::reqrep::CommandReply& reply)
+    {
+        // Invoke the bound callback, with the same error handling as `invokeCallback`.
+        auto invoker = [&callback, &reply](auto&&... args)
+            -> std::conditional_t<std::is_void_v<RetT>, void, std::optional<RetT>>
+        {
+            try
+            {
+                if constexpr (std::is_void_v<RetT>)
+                {
+                    callback(std::forward<decltype(args)>(args)...);
+                    return;
+                }
+                else
+                {
+                    return callback(std::forward<decltype(args)>(args)...);
+                }
+            }
+            catch(...)
+            {
+                reply.result = OperationResult::INVALID_EXT_CALLBACK;
+                return RetT();
+            }
+        };
+
+        this->processClbkRequestWith<RetT, InputTuple, OutputTuple>(invoker, request, reply);
+    }
+
+    /**
+     * @brief Parametric method for invoking a registered callback. If no callback is registered, an error is returned.
+     * @param msg, the received message.
+     * @param args, the args passed to the callback.
+     * @return the result of the callback inovocation.
+     */
+    template <typename CallbackType, typename RetT,  typename... Args>
+    std::conditional_t<std::is_void_v<RetT>, void, std::optional<RetT>>
+    invokeCallback(const CommandRequest& request, CommandReply& reply, Args&&... args)
+    {
+        // Get the command and prepare the return.
+        ServerCommand cmd = static_cast<ServerCommand>(request.command);
+
+        // Check the callback.
+        if(!this->hasCallback(cmd))
+        {
+            reply.result = OperationResult::EMPTY_EXT_CALLBACK;
+            return RetT();
+        }
+
+        //Invoke the callback.
+        try
+        {
+            if constexpr (std::is_void_v<RetT>)
+            {
+                CallbackHandler::invokeCallback<CallbackType, RetT>(
+                    static_cast<CallbackHandler::CallbackId>(cmd), std::forward<Args>(args)...);
+                return;
+            }
+            else
+            {
+                return CallbackHandler::invokeCallback<CallbackType, RetT>(
+                    static_cast<CallbackHandler::CallbackId>(cmd), std::forward<Args>(args)...);
+            }
+        }
+        catch(...)
+        {
+            reply.result = OperationResult::INVALID_EXT_CALLBACK;
+            return RetT();
+        }
+    }
+
+private:
+
+    // Hide the base functions.
+    using CallbackHandler::registerCallback;
+    using CallbackHandler::invokeCallback;
+    using CallbackHandler::removeCallback;
+    using CallbackHandler::hasCallback;
+
+    // Common callback request processing, where the invoker calls the callback with the inputs and outputs.
+    template<typename RetT, typename InputTuple, typename OutputTuple, typename Invoker>
+    void processClbkRequestWith(Invoker& invoker,
+                                const zmqutils::reqrep::CommandRequest& request,
+                                zmqutils::reqrep::CommandReply& reply)
     {
         // Prepare the input and output parameters
         InputTuple inputs;
@@ -224,12 +364,7 @@ protected:
         if constexpr (std::is_void_v<RetT>)
         {
             // Invoke the callback with parameters
-            std::apply([this, &request, &reply](auto&&... args)
-            {
-                return this->invokeCallback<CallbackType, RetT>(request,
-                                                                reply,
-                                                                std::forward<decltype(args)>(args)...);
-            }, args);
+            std::apply(invoker, args);
 
             // If there are output parameters, serialize them into the reply.
             if constexpr (std::tuple_size_v<OutputTuple> > 0)
@@ -245,79 +380,33 @@ protected:
         else
         {
             // Invoke the callback with parameters and handle return value
-            auto ret = std::apply([this, &request, &reply](auto&&... args)
-            {
-                return this->invokeCallback<CallbackType, RetT>(request, reply, std::forward<decltype(args)>(args)...);
-            }, args);
+            auto ret = std::apply(invoker, args);
 
-            // Serialize the return value.
-            zmqutils::serializer::BinarySerializer serializer;
-            serializer.write(ret.value());
+            // Calculate the reply size, so the serializer allocates its buffer only once.
+            zmqutils::serializer::SizeUnit capacity = zmqutils::serializer::BinarySerializer::serializedSize(*ret);
 
-            // If there are output parameters, serialize them.
+            // If there are output parameters, get them from the parameters tuple.
             if constexpr (std::tuple_size_v<OutputTuple> > 0)
             {
-                // Get the output parameters from the parameters tuple
                 internal_helpers::tuple::tuple_split(std::move(args), inputs, outputs);
+                capacity += zmqutils::serializer::BinarySerializer::serializedSize(outputs);
+            }
 
-                // Serialize the output parameters.
+            // Serialize the return value.
+            zmqutils::serializer::BinarySerializer serializer(capacity);
+            serializer.write(*ret);
+
+            // If there are output parameters, serialize them.
+            if constexpr (std::tuple_size_v<OutputTuple> > 0)
                 serializer.write(outputs);
-            }
 
             // Serialize the data and move the container.
             reply.data.size = serializer.moveUnique(reply.data.bytes);
         }
     }
 
-    /**
-     * @brief Parametric method for invoking a registered callback. If no callback is registered, an error is returned.
-     * @param msg, the received message.
-     * @param args, the args passed to the callback.
-     * @return the result of the callback inovocation.
-     */
-    template <typename CallbackType, typename RetT,  typename... Args>
-    std::conditional_t<std::is_void_v<RetT>, void, std::optional<RetT>>
-    invokeCallback(const CommandRequest& request, CommandReply& reply, Args&&... args)
-    {
-        // Get the command and prepare the return.
-        ServerCommand cmd = static_cast<ServerCommand>(request.command);
-
-        // Check the callback.
-        if(!this->hasCallback(cmd))
-        {
-            reply.result = OperationResult::EMPTY_EXT_CALLBACK;
-            return RetT();
-        }
-
-        //Invoke the callback.
-        try
-        {
-            if constexpr (std::is_void_v<RetT>)
-            {
-                CallbackHandler::invokeCallback<CallbackType, RetT>(
-                    static_cast<CallbackHandler::CallbackId>(cmd), std::forward<Args>(args)...);
-                return;
-            }
-            else
-            {
-                return CallbackHandler::invokeCallback<CallbackType, RetT>(
-                    static_cast<CallbackHandler::CallbackId>(cmd), std::forward<Args>(args)...);
-            }
-        }
-        catch(...)
-        {
-            reply.result = OperationResult::INVALID_EXT_CALLBACK;
-            return RetT();
-        }
-    }
-
-private:
-
-    // Hide the base functions.
-    using CallbackHandler::registerCallback;
-    using CallbackHandler::invokeCallback;
-    using CallbackHandler::removeCallback;
-    using CallbackHandler::hasCallback;
+    // Commands whose automatic process function has the callback bound.
+    std::set<ServerCommand> bound_clbk_cmds_;
 };
 
 }} // END NAMESPACES.
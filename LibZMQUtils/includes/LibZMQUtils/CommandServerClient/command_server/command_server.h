@@ -0,0 +1,189 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+
+/** ********************************************************************************************************************
+ * @file command_server.h
+ * @brief This file contains the CommandServer template, an adapter with a compile-time hook mask for the server bases.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/CommandServerClient/command_server/command_server_base.h"
+#include "LibZMQUtils/CommandServerClient/command_server/clbk_command_server_base.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace reqrep{
+// =====================================================================================================================
+
+/**
+ * @brief Compile-time configuration of a CommandServer.
+ * @tparam ClientStatusCheck Initial value for `setClientStatusCheck` (enabled by default, as in the base server).
+ * @tparam AliveCallbacks Initial value for `setAliveCallbacksEnabled` (enabled by default, as in the base server).
+ */
+template <bool ClientStatusCheck = true, bool AliveCallbacks = true>
+struct CommandServerPolicies
+{
+    static constexpr bool kClientStatusCheck = ClientStatusCheck;  ///< Check the alive status of the clients.
+    static constexpr bool kAliveCallbacks = AliveCallbacks;        ///< Call the internal callbacks for REQ_ALIVE.
+};
+
+/**
+ * @brief The CommandServer template is an adapter over CommandServerBase or ClbkCommandServerBase that builds the
+ *        hook mask of the server at compile time.
+ *
+ * The adapter implements every internal callback of the base server, so the subclass only defines the callbacks that
+ * it needs, with the same signatures as in CommandServerBase. The per request callbacks that the subclass doesn't
+ * define are detected at compile time and disabled in the hook mask (see `CommandServerBase::setEnabledHooks`), so
+ * the server worker skips them with a bit test instead of doing a virtual call to an empty function. The callbacks
+ * that the subclass defines are still called virtually from the server worker. If `validateCustomRequest` is not
+ * defined, every command outside the base commands range is accepted, and the commands without a process function
+ * are answered with NOT_IMPLEMENTED.
+ *
+ * @code
+ * class MyServer : public CommandServer<MyServer, CommandServerPolicies<false>, ClbkCommandServerBase>
+ * {
+ * public:
+ *     using CommandServer::CommandServer;
+ * private:
+ *     void onCommandReceived(const CommandRequest&) final;
+ * };
+ * @endcode
+ *
+ * @tparam Derived The subclass, used only to detect the callbacks that it defines.
+ * @tparam Policies The compile-time configuration (see CommandServerPolicies).
+ * @tparam Base The base server, CommandServerBase or ClbkCommandServerBase.
+ *
+ * @note The subclass callbacks can be public, protected or private. A callback that the adapter can't access is
+ *       considered defined, since the adapter defaults are accessible.
+ *
+ * @warning Only the callbacks defined in `Derived` itself are detected. If a class derived from `Derived` overrides
+ *          one of the per request callbacks that `Derived` doesn't define, that callback stays disabled and will
+ *          never be called. In that case, define the callback in `Derived` or enable it with `setEnabledHooks`.
+ */
+template <typename Derived, typename Policies = CommandServerPolicies<>, typename Base = CommandServerBase>
+class CommandServer : public Base
+{
+    static_assert(std::is_same_v<Base, CommandServerBase> || std::is_same_v<Base, ClbkCommandServerBase>,
+                  "The base of a CommandServer must be CommandServerBase or ClbkCommandServerBase.");
+
+public:
+
+    /**
+     * @brief Constructs the base server with the given arguments and applies the policies.
+     * @param args The arguments for the constructor of the base server.
+     */
+    template <typename... Args>
+    explicit CommandServer(Args&&... args) :
+        Base(std::forward<Args>(args)...)
+    {
+        this->setEnabledHooks(CommandServer::detectHooks());
+        this->setClientStatusCheck(Policies::kClientStatusCheck);
+        this->setAliveCallbacksEnabled(Policies::kAliveCallbacks);
+    }
+
+protected:
+
+    // Default empty callbacks (hidden by the subclass callbacks).
+    bool validateCustomRequest(const CommandRequest& request) const override
+    {
+        return static_cast<int>(request.command) > kMaxBaseCmdId;
+    }
+    void onServerStart() override {}
+    void onServerStop() override {}
+    void onWaitingCommand() override {}
+    void onConnected(const CommandClientInfo&) override {}
+    void onDisconnected(const CommandClientInfo&) override {}
+    void onDeadClient(const CommandClientInfo&) override {}
+    void onInvalidMsgReceived(const CommandRequest&) override {}
+    void onCommandReceived(const CommandRequest&) override {}
+    void onCustomCommandReceived(CommandRequest&) override {}
+    void onServerError(const zmq::error_t&, const std::string& = "") override {}
+    void onSendingResponse(const CommandReply&) override {}
+
+private:
+
+    // Pointers to the per request callbacks, named through a class.
+    template <typename T> using WaitingCommandPtr = decltype(&T::onWaitingCommand);
+    template <typename T> using CommandReceivedPtr = decltype(&T::onCommandReceived);
+    template <typename T> using CustomCommandReceivedPtr = decltype(&T::onCustomCommandReceived);
+    template <typename T> using SendingResponsePtr = decltype(&T::onSendingResponse);
+    template <typename T> using InvalidMsgReceivedPtr = decltype(&T::onInvalidMsgReceived);
+
+    // Check if a callback is defined in the subclass. If the adapter can't access it, the subclass declares it.
+    template <template <typename> class HookPtr, typename = void>
+    struct IsDefinedHook : std::true_type {};
+
+    template <template <typename> class HookPtr>
+    struct IsDefinedHook<HookPtr, std::void_t<HookPtr<Derived>>> :
+        std::bool_constant<!std::is_same_v<HookPtr<Derived>, HookPtr<CommandServer>>> {};
+
+    // Get the per request callbacks that are defined in the subclass.
+    static constexpr std::uint32_t detectHooks()
+    {
+        using Hook = typename Base::ServerHook;
+        std::uint32_t hooks = 0;
+        if (IsDefinedHook<WaitingCommandPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::WAITING_COMMAND);
+        if (IsDefinedHook<CommandReceivedPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::COMMAND_RECEIVED);
+        if (IsDefinedHook<CustomCommandReceivedPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::CUSTOM_COMMAND_RECEIVED);
+        if (IsDefinedHook<SendingResponsePtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::SENDING_RESPONSE);
+        if (IsDefinedHook<InvalidMsgReceivedPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::INVALID_MSG_RECEIVED);
+        return hooks;
+    }
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -48,14 +48,17 @@
 #include <future>
 #include <string>
 #include <map>
+#include <vector>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/Global/zmq_socket_options.h"
 #include "LibZMQUtils/InternalHelpers/network_helpers.h"
 #include "LibZMQUtils/InternalHelpers/common_aliases_macros.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
 #include "LibZMQUtils/Utilities/uuid_generator.h"
 #include "LibZMQUtils/CommandServerClient/data/command_server_client_data.h"
 #include "LibZMQUtils/CommandServerClient/data/command_server_client_info.h"
@@ -81,6 +84,7 @@ namespace reqrep{
 constexpr unsigned kDefaultClientAliveTimeoutMsec = 10000;    ///< Default timeout for consider a client dead (msec).
 constexpr unsigned kDefaultServerReconnAttempts = 5;          ///< Default server reconnection number of attempts.
 constexpr unsigned kDefaultMaxNumberOfClients = 1000;         ///< Default maximum number of connected clients.
+constexpr unsigned kMaxProcessFunctionsTableSize = 1024;      ///< Commands below this id use the flat dispatch table.
 // =====================================================================================================================
 
 // MACROS
@@ -425,12 +429,47 @@ public:
      */
     void setAliveCallbacksEnabled(bool);
 
+    /**
+     * @brief Sets the configuration (name, CPU affinity and scheduling) of the server worker thread. By default, the
+     *        thread is only named "zmq-server". This value will only be modified if the server is stopped.
+     * @param config The thread configuration.
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the server worker thread.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the server worker thread (the last one, if the server is stopped).
+     * @return The CPU time of the worker thread.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Sets the tuning options (buffers, TCP keepalive, TOS...) of the server socket. See SocketOptions for the
+     *        available presets. This value will only be modified if the server is stopped.
+     * @param options The socket options.
+     */
+    void setSocketOptions(const SocketOptions& options);
+
+    /**
+     * @brief Get the tuning options of the server socket.
+     * @return The socket options.
+     */
+    SocketOptions getSocketOptions() const;
+
     /**
      * @brief Starts the command server.
      *
      * If the server is already running, the function does nothing. Otherwise, it creates the ZMQ
      * context if it doesn't exist and launches the server worker in a separate thread.
      *
+     * The registered process functions are frozen into the dispatch table when the server starts, and they can't be
+     * registered while the server is running.
+     *
      * @return True if the server started, false otherwise.
      */
     bool startServer();
@@ -502,13 +541,50 @@ public:
 
 protected:
 
+    /**
+     * @brief Check if the server context is in use (the server is working).
+     * @return True if the server is working.
+     */
+    bool isContextInUse() const override;
+
     // -----------------------------------------------------------------------------------------------------------------
     /// Alias for a function that allows process a command request and to generate the reply.
     using ProcessFunction = std::function<void(const CommandRequest&, CommandReply&)>;
     ///< Alias for a map that associates commands with process functions.
     using ProcessFunctionsMap = std::unordered_map<ServerCommand, ProcessFunction>;
+    ///< Alias for a flat table of process functions indexed by the command identifier.
+    using ProcessFunctionsTable = std::vector<ProcessFunction>;
     // -----------------------------------------------------------------------------------------------------------------
 
+    /**
+     * @brief Bit flags of the internal callbacks that are called for each request.
+     *
+     * A subclass that doesn't implement some of these callbacks can disable them with `setEnabledHooks`, so the server
+     * worker skips them instead of doing a virtual call to an empty function (see the `CommandServer` template).
+     */
+    enum class ServerHook : std::uint32_t
+    {
+        WAITING_COMMAND         = 1u << 0,  ///< The `onWaitingCommand` callback.
+        COMMAND_RECEIVED        = 1u << 1,  ///< The `onCommandReceived` callback.
+        CUSTOM_COMMAND_RECEIVED = 1u << 2,  ///< The `onCustomCommandReceived` callback.
+        SENDING_RESPONSE        = 1u << 3,  ///< The `onSendingResponse` callback.
+        INVALID_MSG_RECEIVED    = 1u << 4,  ///< The `onInvalidMsgReceived` callback.
+        ALL_HOOKS               = 0x1Fu     ///< All the previous callbacks.
+    };
+
+    /**
+     * @brief Set the internal callbacks that are called for each request (all of them by default).
+     * @param hooks Bitwise OR of the enabled `ServerHook` flags.
+     * @note This value will only be modified if the server is stopped.
+     */
+    void setEnabledHooks(std::uint32_t hooks);
+
+    /**
+     * @brief Get the internal callbacks that are called for each request.
+     * @return Bitwise OR of the enabled `ServerHook` flags.
+     */
+    std::uint32_t getEnabledHooks() const;
+
     /**
      * @brief Register a function to process `CommandRequest` request from a custom server command.
      *
@@ -517,23 +593,25 @@ protected:
      * object and a reference to a `CommandReply` object.
      *
      * The registered function will be invoked automatically when a request for the specified command
-     * is received by the server.
+     * is received by the server. The functions are frozen into a flat table indexed by the command identifier when
+     * the server starts, so the command identifiers should be small and dense (as the ones just after
+     * `END_BASE_COMMANDS`). The identifiers outside `[0, kMaxProcessFunctionsTableSize)` are looked up in a map.
      *
      * @param command  The custom server command that the function will process replies for.
      * @param obj      A pointer to the instance of the object that contains the member function to be called.
      * @param function The member function to call when the server command receives a request.
+     * @return True if the function was registered, false if the server is working.
      *
      * @warning The `func` function must be a member function of the class pointed to by `obj` and take a constant
      * reference to a `CommandRequest` object and a reference to a `CommandReply` object as parameters.
      */
     template <typename Cmd, typename ClassT>
-    void registerReqProcFunc(Cmd command, ClassT* obj, void(ClassT::*func)(const CommandRequest&, CommandReply&))
+    bool registerReqProcFunc(Cmd command, ClassT* obj, void(ClassT::*func)(const CommandRequest&, CommandReply&))
     {
-        this->process_fnc_map_[static_cast<ServerCommand>(command)] =
-            [obj, func](const CommandRequest& request, CommandReply& reply)
+        return this->registerReqProcFunc(command, [obj, func](const CommandRequest& request, CommandReply& reply)
         {
             (obj->*func)(request, reply);
-        };
+        });
     }
 
     /**
@@ -547,16 +625,27 @@ protected:
      * member function, providing significant flexibility in how the request is processed.
      *
      * The registered function will be invoked automatically when a request for the specified command
-     * is received by the server.
+     * is received by the server. The functions are frozen into a flat table indexed by the command identifier when
+     * the server starts, so the command identifiers should be small and dense (as the ones just after
+     * `END_BASE_COMMANDS`). The identifiers outside `[0, kMaxProcessFunctionsTableSize)` are looked up in a map.
      *
      * @param command  The custom server command that the function will process requests for.
      * @param function The function object to call when the server command receives a request. This function
      *                    object must match the signature `void(const CommandRequest&, CommandReply&)`.
+     * @return True if the function was registered, false if the server is working.
      */
     template <typename Cmd>
-    void registerReqProcFunc(Cmd command, std::function<void(const CommandRequest&, CommandReply&)> function)
+    bool registerReqProcFunc(Cmd command, std::function<void(const CommandRequest&, CommandReply&)> function)
     {
-        this->process_fnc_map_[static_cast<ServerCommand>(command)] = function;
+        // Safe mutex lock
+        std::unique_lock<std::mutex> lock(this->mtx_);
+
+        // The worker dispatches from the frozen table, so the functions can only change while the server is stopped.
+        if (this->flag_server_working_)
+            return false;
+
+        this->process_fnc_map_[static_cast<ServerCommand>(command)] = std::move(function);
+        return true;
     }
 
     template <std::size_t N1>
@@ -785,6 +874,15 @@ private:
     /// Process custom command.
     void processCustomCommand(CommandRequest& request, CommandReply& reply);
 
+    /// Freeze the registered process functions into the dispatch table.
+    void buildProcessFunctionsTable();
+
+    /// Check if an internal callback is enabled (only changes while the server is stopped, so no lock is needed).
+    bool isHookEnabled(ServerHook hook) const
+    {
+        return (this->enabled_hooks_ & static_cast<std::uint32_t>(hook)) != 0;
+    }
+
     /// Client status checker.
     void checkClientsAliveStatus();
 
@@ -834,6 +932,9 @@ private:
 
     // Process functions containers.
     ProcessFunctionsMap process_fnc_map_;        ///< Container with the internal factory process function.
+    ProcessFunctionsTable process_fnc_table_;    ///< Dispatch table, frozen from the map when the server starts.
+    ProcessFunctionsMap process_fnc_overflow_;   ///< Frozen functions whose command id doesn't fit in the table.
+    std::uint32_t enabled_hooks_;                ///< Enabled internal callbacks (ServerHook flags).
 
     // To string functions containers.
     CommandToStringFunction command_to_string_function_;  ///< Function to transform ServerCommand into strings.
@@ -847,6 +948,11 @@ private:
     std::atomic_uint client_alive_timeout_;     ///< Tiemout for consider a client dead (in msec).
     std::atomic_uint server_reconn_attempts_;   ///< Server reconnection number of attempts.
     std::atomic_uint max_connected_clients_;    ///< Maximum number of connected clients.
+    SocketOptions socket_options_;              ///< Tuning options of the server socket.
+
+    // Worker thread configuration.
+    utils::ThreadConfig thread_config_;       ///< Configuration of the server worker thread.
+    utils::ThreadCpuClock worker_cpu_clock_;  ///< CPU time of the server worker thread.
 
     /// Specific class scope (for debug purposes).
     inline static const std::string kScope = "[LibZMQUtils,CommandServerClient,CommandServerBase]";
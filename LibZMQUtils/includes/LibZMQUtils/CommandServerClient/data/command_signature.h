@@ -0,0 +1,122 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file command_signature.h
+ * @brief This file contains the CommandSignature template, shared by command servers and clients.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <functional>
+#include <tuple>
+#include <type_traits>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace reqrep{
+// =====================================================================================================================
+
+/**
+ * @brief Describes the data exchanged by a command: the callback executed by the server, the inputs the client sends
+ *        and the outputs the server replies with.
+ *
+ * A single alias of this template can be used in both sides of the communication. The server uses it in
+ * `ClbkCommandServerBase::registerCbAndReqProcFunc` and the client uses it in `CommandClientBase::call`, so both
+ * serialize and deserialize exactly the same types in the same order, checked at compile time. For example:
+ *
+ * @code
+ * using GetHomePositionSignature = CommandSignature<std::function<AmelasError(AltAzPos&)>,
+ *                                                   std::tuple<>,
+ *                                                   std::tuple<AltAzPos>>;
+ * @endcode
+ *
+ * The reply of a command contains the callback return value (if it is not void) followed by the output parameters.
+ *
+ * @tparam CallbackT The callback type executed by the server, as a `std::function`.
+ * @tparam InputTuple A tuple with the types sent by the client in the request.
+ * @tparam OutputTuple A tuple with the types of the output parameters sent by the server in the reply.
+ */
+template<typename CallbackT, typename InputTuple = std::tuple<>, typename OutputTuple = std::tuple<>>
+struct CommandSignature;
+
+template<typename RetT, typename... CbArgs, typename... InArgs, typename... OutArgs>
+struct CommandSignature<std::function<RetT(CbArgs...)>, std::tuple<InArgs...>, std::tuple<OutArgs...>>
+{
+    using CallbackType = std::function<RetT(CbArgs...)>;  ///< Callback executed by the server.
+    using ReturnType = RetT;                              ///< Callback return type, sent first in the reply.
+    using InputArgs = std::tuple<InArgs...>;              ///< Types sent by the client in the request.
+    using OutputArgs = std::tuple<OutArgs...>;            ///< Output parameters sent by the server in the reply.
+
+    /// All the types sent in the reply, in order (the return value if it is not void, then the output parameters).
+    using ReplyArgs = std::conditional_t<std::is_void_v<RetT>, OutputArgs, std::tuple<RetT, OutArgs...>>;
+
+    static constexpr std::size_t kNumInputs = sizeof...(InArgs);                    ///< Number of request values.
+    static constexpr std::size_t kNumReplyValues = std::tuple_size_v<ReplyArgs>;   ///< Number of reply values.
+
+    /// True if the request size is known at compile time.
+    static constexpr bool kFixedRequestSize = serializer::has_fixed_serialized_size_v<InArgs...>;
+};
+
+/**
+ * @brief Type trait to check if a type is a CommandSignature.
+ */
+template<typename T>
+struct is_command_signature : std::false_type {};
+
+template<typename CallbackT, typename InputTuple, typename OutputTuple>
+struct is_command_signature<CommandSignature<CallbackT, InputTuple, OutputTuple>> : std::true_type {};
+
+template<typename T>
+inline constexpr bool is_command_signature_v = is_command_signature<T>::value;
+
+// =====================================================================================================================
+
+// =====================================================================================================================
+}} // END NAMESPACE
+// =====================================================================================================================
@@ -48,6 +48,7 @@
 #include <iostream>
 #include <vector>
 #include <functional>
+#include <memory>
 #include <mutex>
 // =====================================================================================================================
 
@@ -57,13 +58,82 @@
 #include <zmq_addon.hpp>
 // =====================================================================================================================
 
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+// =====================================================================================================================
+
 // ZMQUTILS NAMESPACES
 // =====================================================================================================================
 namespace zmqutils{
 // =====================================================================================================================
 
-class ZMQContextHandler
+/**
+ * @brief The ZMQContextConfig struct contains the configuration of a ZMQ context.
+ *
+ * The negative values (and the empty affinity list) keep the ZMQ defaults. The scheduling and affinity options are
+ * applied to the internal I/O threads of the context, and they are ignored if the ZMQ library doesn't support them.
+ */
+struct LIBZMQUTILS_EXPORT ZMQContextConfig
 {
+    int io_threads = 1;              ///< Number of I/O threads (ZMQ_IO_THREADS).
+    int max_sockets = -1;            ///< Maximum number of sockets (ZMQ_MAX_SOCKETS).
+    int sched_policy = -1;           ///< Scheduling policy of the I/O threads (ZMQ_THREAD_SCHED_POLICY).
+    int sched_priority = -1;         ///< Scheduling priority of the I/O threads (ZMQ_THREAD_PRIORITY).
+    std::vector<int> affinity_cpus;  ///< CPUs where the I/O threads can run (ZMQ_THREAD_AFFINITY_CPU_ADD).
+};
+
+/**
+ * @brief The ZMQContextHandler class manages the ZMQ context used by every component of the library.
+ *
+ * By default, every component (servers, clients, publishers, subscribers...) shares a global context, created with
+ * the first component and destroyed with the last one. The global context configuration can be changed while no
+ * component exists, for example, for using several I/O threads with many high-rate publishers. A component can also
+ * use its own dedicated context, so a heavy component can't starve the rest.
+ *
+ * @warning The in-process transport (inproc://) only works between sockets of the same context.
+ */
+class LIBZMQUTILS_EXPORT ZMQContextHandler
+{
+
+public:
+
+    /**
+     * @brief Sets the configuration of the global context. It is applied when the global context is created, so it
+     *        can only be changed while no component exists.
+     * @param config The context configuration.
+     * @return True if the configuration was stored, false if the global context already exists.
+     * @throw std::invalid_argument If the configuration is not valid.
+     */
+    static bool setGlobalContextConfig(const ZMQContextConfig& config);
+
+    /**
+     * @brief Get the configuration of the global context.
+     * @return The global context configuration.
+     */
+    static ZMQContextConfig getGlobalContextConfig();
+
+    /**
+     * @brief Makes this component use its own dedicated context instead of the global context.
+     * @param config The configuration of the dedicated context.
+     * @return True if the context was changed, false if the component is working.
+     * @throw std::invalid_argument If the configuration is not valid.
+     * @warning The component must not be started concurrently with this call.
+     */
+    bool setDedicatedContext(const ZMQContextConfig& config);
+
+    /**
+     * @brief Makes this component use the global context again.
+     * @return True if the context was changed, false if the component is working.
+     * @warning The component must not be started concurrently with this call.
+     */
+    bool clearDedicatedContext();
+
+    /**
+     * @brief Check if this component uses its own dedicated context.
+     * @return True if the component uses a dedicated context.
+     */
+    bool hasDedicatedContext() const;
 
 protected:
 
@@ -75,6 +145,13 @@ protected:
     virtual ~ZMQContextHandler();
 
     const std::unique_ptr<zmq::context_t>& getContext();
+
+    /**
+     * @brief Check if the component has sockets in its context, so the context can't be replaced. Subclasses must
+     *        override this function to report their working state.
+     * @return True if the context is in use. The base implementation returns false.
+     */
+    virtual bool isContextInUse() const;
     static ZMQContextHandler& getInstance();
 
 private:
@@ -83,10 +160,15 @@ private:
     ZMQContextHandler(const ZMQContextHandler&) = delete;
     ZMQContextHandler& operator=(const ZMQContextHandler&) = delete;
 
+    // Internal helper to create a context with a configuration.
+    static std::unique_ptr<zmq::context_t> createContext(const ZMQContextConfig& config);
+
     // Internal variables and containers.
     inline static std::mutex mtx_;                                  ///< Safety mutex.
     inline static std::unique_ptr<zmq::context_t> context_;         ///< ZMQ global context.
     inline static std::vector<ContextHandlerReference> instances_;  ///< Instances of the ContextHandler.
+    inline static ZMQContextConfig config_;                         ///< Configuration of the global context.
+    std::unique_ptr<zmq::context_t> dedicated_context_;             ///< ZMQ dedicated context (if used).
 };
 
 } // END NAMESPACES.
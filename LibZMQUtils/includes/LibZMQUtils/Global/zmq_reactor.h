@@ -0,0 +1,311 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file zmq_reactor.h
+ * @brief This file contains the declaration of the global `ZMQReactor` class.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQ INCLUDES
+// =====================================================================================================================
+#include <zmq.hpp>
+#include <zmq_addon.hpp>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+#include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+// =====================================================================================================================
+
+/**
+ * @brief The ZMQReactor class multiplexes the sockets of many components in a single poll loop.
+ *
+ * By default each publisher and subscriber owns a worker thread that polls its own sockets. With many components in
+ * the same process this means many threads mostly sleeping in `zmq_poll`. The reactor runs one loop thread that polls
+ * every registered socket and calls the handler of the readable ones, plus an optional pool of executor threads for
+ * the work that must not block the loop (for example, the user callbacks of the subscribers).
+ *
+ * The registered sockets are owned by the loop thread while the reactor is running. The handlers, the timers and the
+ * tasks sent with `execute` and `post` run in the loop thread, so they can use these sockets freely. The tasks sent
+ * with `submit` run in the executor pool, or in the loop thread if the reactor has no executors.
+ *
+ * The components are attached to a reactor with their `setReactor` function before starting them. The reactor must
+ * be running before starting the attached components, and the components should be stopped before the reactor.
+ *
+ * @note The registration functions are thread safe. When called from other threads, they wait until the loop has
+ *       applied the change, so after `removeSocket` returns the socket is no longer polled and can be closed.
+ */
+class LIBZMQUTILS_EXPORT ZMQReactor : public ZMQContextHandler
+{
+public:
+
+    // Aliases.
+    using HandlerId = std::uint64_t;
+    using Handler = std::function<void()>;
+    using Task = std::function<void()>;
+
+    /**
+     * @brief Constructs the reactor. The loop is not started until `start` is called.
+     * @param executor_threads Number of threads of the executor pool. With zero, the submitted tasks run in the loop.
+     */
+    explicit ZMQReactor(unsigned executor_threads = 0);
+
+    ZMQReactor(const ZMQReactor&) = delete;
+    ZMQReactor& operator=(const ZMQReactor&) = delete;
+
+    /**
+     * @brief Starts the loop thread and the executor pool.
+     * @return True if the reactor is running after the call.
+     */
+    bool start();
+
+    /**
+     * @brief Stops the loop thread and the executor pool. The pending tasks are run before returning.
+     * @note The registered sockets and timers are kept, but they are not polled until the reactor is started again.
+     * @warning This function must not be called from the loop thread or from the executor threads.
+     */
+    void stop();
+
+    /**
+     * @brief Check if the reactor is running.
+     * @return True if the loop thread is running.
+     */
+    bool isRunning() const;
+
+    /**
+     * @brief Check if the caller is the loop thread.
+     * @return True if the function is called from the loop thread (for example, from a handler or a task).
+     */
+    bool isLoopThread() const;
+
+    /**
+     * @brief Get the number of threads of the executor pool.
+     * @return The number of executor threads.
+     */
+    unsigned getExecutorThreads() const;
+
+    /**
+     * @brief Sets the configuration (name, CPU affinity and scheduling) of the loop and executor threads. The names
+     *        of the executors get the suffix "/<index>". By default, the threads are only named "zmq-reactor".
+     * @param config The thread configuration.
+     * @note This value will only be modified if the reactor is stopped.
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the loop and executor threads.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the loop thread (the last one, if the reactor is stopped).
+     * @return The CPU time of the loop thread.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Get the CPU time consumed by each executor thread (the last ones, if the reactor is stopped).
+     * @return The CPU time of each executor thread.
+     */
+    std::vector<std::chrono::nanoseconds> getExecutorsCpuTime() const;
+
+    /**
+     * @brief Registers a socket in the loop. The handler is called in the loop thread each time the socket is readable.
+     *
+     * The poll is level triggered, so a handler can receive a single message on each call. The loop will call it
+     * again while there are pending messages, interleaved with the rest of the sockets.
+     *
+     * @param socket The socket to poll. It must be valid until it is removed.
+     * @param handler The handler to call when the socket is readable.
+     * @return The identifier of the registration, always greater than zero.
+     */
+    HandlerId addSocket(zmq::socket_t& socket, Handler handler);
+
+    /**
+     * @brief Unregisters a socket. After returning, the socket is not polled anymore.
+     * @param id The identifier returned by `addSocket`. Unknown identifiers are ignored.
+     */
+    void removeSocket(HandlerId id);
+
+    /**
+     * @brief Registers a periodic timer. The handler is called in the loop thread.
+     * @param period The period of the timer. It must be greater than zero.
+     * @param handler The handler to call on each period.
+     * @return The identifier of the timer, always greater than zero.
+     * @throw std::invalid_argument If the period is not greater than zero.
+     */
+    HandlerId addTimer(std::chrono::milliseconds period, Handler handler);
+
+    /**
+     * @brief Unregisters a timer. After returning, the handler will not be called anymore.
+     * @param id The identifier returned by `addTimer`. Unknown identifiers are ignored.
+     */
+    void removeTimer(HandlerId id);
+
+    /**
+     * @brief Runs a task in the loop thread and waits for it. If the caller is the loop thread, or if the reactor is
+     *        not running, the task runs directly in the caller.
+     * @param task The task to run.
+     */
+    void execute(const Task& task);
+
+    /**
+     * @brief Queues a task to run in the loop thread, without waiting. The tasks run in the order in which they are
+     *        posted. If the reactor is not running, the task runs directly in the caller.
+     * @param task The task to run.
+     */
+    void post(Task task);
+
+    /**
+     * @brief Queues a task to run in the executor pool, without waiting. If the reactor has no executors, the task is
+     *        posted to the loop thread.
+     * @param task The task to run.
+     */
+    void submit(Task task);
+
+    /**
+     * @brief Virtual destructor. Stops the reactor.
+     */
+    virtual ~ZMQReactor() override;
+
+protected:
+
+    /**
+     * @brief Check if the reactor context is in use (the reactor is running).
+     * @return True if the reactor is running.
+     */
+    bool isContextInUse() const override;
+
+    /**
+     * @brief Base error callback. Called when the poll fails or when a handler or a task throws an exception.
+     * @param error The error message of the caught exception.
+     * @param ext_info Extended information about the error.
+     * @warning This function runs in the thread that caught the error, so it must be thread safe and fast.
+     */
+    virtual void onReactorError(const std::string& error, const std::string& ext_info);
+
+private:
+
+    // Registration of a polled socket.
+    struct SocketEntry
+    {
+        zmq::socket_t* socket;    ///< Polled socket.
+        Handler handler;          ///< Handler called when the socket is readable.
+        std::atomic_bool active;  ///< False once the socket has been removed.
+    };
+
+    // Registration of a periodic timer.
+    struct TimerEntry
+    {
+        std::chrono::milliseconds period;               ///< Period of the timer.
+        std::chrono::steady_clock::time_point next_tp;  ///< Next expiration time.
+        Handler handler;                                ///< Handler called on each expiration.
+        std::atomic_bool active;                        ///< False once the timer has been removed.
+    };
+
+    // Internal helper functions.
+    void loopWorker();
+    void executorWorker(std::size_t index);
+    void runLoopTasks();
+    void wakeUp();
+    void syncWithLoop();
+    void runSafe(const Task& task, const std::string& ext_info);
+
+    // Registered sockets and timers.
+    std::map<HandlerId, std::shared_ptr<SocketEntry>> sockets_;  ///< Registered sockets.
+    std::map<HandlerId, std::shared_ptr<TimerEntry>> timers_;    ///< Registered timers.
+    HandlerId last_id_;                                          ///< Last registration identifier.
+    mutable std::mutex reg_mtx_;                                 ///< Registrations mutex.
+
+    // Loop thread.
+    std::thread loop_th_;                              ///< Loop thread.
+    std::atomic<std::thread::id> loop_th_id_;          ///< Identifier of the loop thread while it is running.
+    std::deque<Task> loop_tasks_;                      ///< Tasks pending to run in the loop thread.
+    std::unique_ptr<zmq::socket_t> wake_recv_socket_;  ///< Wake-up socket (loop side).
+    std::unique_ptr<zmq::socket_t> wake_send_socket_;  ///< Wake-up socket (notifier side).
+    std::mutex loop_mtx_;                              ///< Loop tasks and wake-up socket mutex.
+    mutable std::mutex state_mtx_;                     ///< Start and stop mutex.
+    std::atomic_bool flag_running_;                    ///< Flag for check the running status.
+    std::atomic_bool flag_exit_;                       ///< Flag for exit the loop.
+
+    // Executor pool.
+    std::vector<std::thread> executors_;  ///< Executor threads.
+    std::deque<Task> exec_tasks_;         ///< Tasks pending to run in the executor pool.
+    std::mutex exec_mtx_;                 ///< Executor tasks mutex.
+    std::condition_variable exec_cv_;     ///< Condition variable to notify the executor threads.
+    unsigned executor_threads_;           ///< Configured number of executor threads.
+    bool exec_exit_;                      ///< Flag for exit the executor threads.
+
+    // Threads configuration.
+    utils::ThreadConfig thread_config_;                                    ///< Configuration of the threads.
+    utils::ThreadCpuClock loop_cpu_clock_;                                 ///< CPU time of the loop thread.
+    std::vector<std::unique_ptr<utils::ThreadCpuClock>> exec_cpu_clocks_;  ///< CPU time of each executor thread.
+
+    /// Specific class scope (for debug purposes).
+    inline static const std::string kScope = "[LibZMQUtils,ZMQReactor]";
+};
+
+} // END NAMESPACES.
+// =====================================================================================================================
@@ -0,0 +1,130 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file zmq_socket_options.h
+ * @brief This file contains the declaration of the global `SocketOptions` struct and its presets.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// ZMQ INCLUDES
+// =====================================================================================================================
+#include <zmq.hpp>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+// =====================================================================================================================
+
+/**
+ * @brief The SocketOptions struct contains the tuning options applied to the main socket of a component (server,
+ *        client, publisher or subscriber) every time the socket is created.
+ *
+ * The negative values keep the ZMQ (or operating system) defaults, so a default constructed struct doesn't change
+ * anything. The options that don't make sense for a socket type (for example, the backlog in a connecting socket)
+ * are simply ignored by ZMQ. The static functions return presets for the most common scenarios:
+ *
+ * - lowLatency: small queues, no queueing to incomplete connections and expedited forwarding TOS. Messages are dropped
+ *   (or the sender blocks) early instead of waiting in long queues.
+ * - bulk: big queues and kernel buffers for maximizing the throughput, at the cost of memory and latency.
+ * - constrainedLink: moderate queues, small kernel buffers and aggressive TCP keepalive for slow or unreliable links
+ *   (radio links, VPNs, NAT devices that drop idle connections...).
+ *
+ * @note The components that have their own high water mark setters (PublisherBase::setSendHWM and
+ *       SubscriberBase::setReceiveHWM) give priority to these values when they are configured.
+ */
+struct LIBZMQUTILS_EXPORT SocketOptions
+{
+    int snd_hwm = -1;              ///< Send high water mark in messages (ZMQ_SNDHWM, 0 means no limit).
+    int rcv_hwm = -1;              ///< Receive high water mark in messages (ZMQ_RCVHWM, 0 means no limit).
+    int snd_buf = -1;              ///< Kernel transmit buffer size in bytes (ZMQ_SNDBUF).
+    int rcv_buf = -1;              ///< Kernel receive buffer size in bytes (ZMQ_RCVBUF).
+    int tcp_keepalive = -1;        ///< TCP keepalive, 0 disabled or 1 enabled (ZMQ_TCP_KEEPALIVE).
+    int tcp_keepalive_idle = -1;   ///< Idle seconds before the first keepalive probe (ZMQ_TCP_KEEPALIVE_IDLE).
+    int tcp_keepalive_intvl = -1;  ///< Seconds between keepalive probes (ZMQ_TCP_KEEPALIVE_INTVL).
+    int tcp_keepalive_cnt = -1;    ///< Failed probes before dropping the connection (ZMQ_TCP_KEEPALIVE_CNT).
+    int immediate = -1;            ///< Queue only to completed connections, 0 or 1 (ZMQ_IMMEDIATE, not for clients).
+    int tos = -1;                  ///< IP type of service, DSCP in the upper 6 bits (ZMQ_TOS).
+    int backlog = -1;              ///< Maximum length of the pending connections queue (ZMQ_BACKLOG).
+
+    /**
+     * @brief Preset for latency sensitive traffic.
+     * @return The low latency options.
+     */
+    static SocketOptions lowLatency();
+
+    /**
+     * @brief Preset for high throughput bulk transfers.
+     * @return The bulk options.
+     */
+    static SocketOptions bulk();
+
+    /**
+     * @brief Preset for slow, lossy or intermittent links.
+     * @return The constrained link options.
+     */
+    static SocketOptions constrainedLink();
+};
+
+/**
+ * @brief Applies the configured (non negative) options to a socket.
+ * @param socket The socket. It should not be bound or connected yet, because some options only affect new
+ *               connections.
+ * @param options The options to apply.
+ * @throw zmq::error_t If ZMQ rejects an option.
+ */
+LIBZMQUTILS_EXPORT void applySocketOptions(zmq::socket_t& socket, const SocketOptions& options);
+
+/**
+ * @brief Reads the current options of a socket (getsockopt), for checking the values that ZMQ really applied.
+ * @param socket The socket.
+ * @return The options of the socket.
+ * @throw zmq::error_t If ZMQ can't read an option.
+ */
+LIBZMQUTILS_EXPORT SocketOptions readSocketOptions(zmq::socket_t& socket);
+
+} // END NAMESPACES.
+// =====================================================================================================================
@@ -47,6 +47,7 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <cstddef>
 #include <string>
 // =====================================================================================================================
 
@@ -65,5 +66,45 @@ std::string getCurrentDir();
 
 std::string getFileName(const std::string& filePath);
 
+bool fileExists(const std::string& file_path);
+
+/**
+ * @brief Minimal RAII wrapper of a memory-mapped file (POSIX mmap or Windows file mapping).
+ */
+class MemoryMappedFile
+{
+public:
+
+    MemoryMappedFile();
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    ~MemoryMappedFile();
+
+    // Creates (or overwrites) a file with the given size and maps it for writing. The file contents are zeros.
+    bool openWrite(const std::string& file_path, std::size_t size);
+
+    // Opens an existing file and maps it for reading.
+    bool openRead(const std::string& file_path);
+
+    // Unmaps and closes the file.
+    void close();
+
+    bool isOpen() const;
+
+    std::byte* data() const;
+
+    std::size_t size() const;
+
+private:
+
+    std::byte* data_;    ///< Mapped memory.
+    std::size_t size_;   ///< Mapped size.
+    void* file_;         ///< Native file handle (Windows).
+    void* mapping_;      ///< Native mapping handle (Windows).
+    int fd_;             ///< Native file descriptor (POSIX).
+};
+
 }}} // END NAMESPACES
 // =====================================================================================================================
@@ -0,0 +1,109 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file zmq_helpers.h
+ * @brief This file contains the declaration of several helper tools related with ZeroMQ messages and sockets.
+ * @warning Not exported. Only for internal library usage.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <string_view>
+// =====================================================================================================================
+
+// ZMQ INCLUDES
+// =====================================================================================================================
+#include <zmq.hpp>
+#include <zmq_addon.hpp>
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace internal_helpers{
+namespace zmq_helpers{
+// =====================================================================================================================
+
+/// Maximum size of a UDP (RADIO/DISH) datagram in LibZMQ, including the group.
+constexpr std::size_t kMaxUdpDatagramSize = 8192;
+
+/// Maximum length of a RADIO/DISH group.
+#ifdef ZMQ_GROUP_MAX_LENGTH
+constexpr std::size_t kMaxGroupLength = ZMQ_GROUP_MAX_LENGTH;
+#else
+constexpr std::size_t kMaxGroupLength = 15;
+#endif
+
+/// Check if the ZMQ draft API (RADIO/DISH sockets) is available in this build.
+#ifdef ZMQ_BUILD_DRAFT_API
+constexpr bool kDraftApiAvailable = true;
+#else
+constexpr bool kDraftApiAvailable = false;
+#endif
+
+// Check if an endpoint uses the UDP transport.
+bool isUdpEndpoint(const std::string& endpoint);
+
+// Check if an endpoint uses a local transport (IPC or in-process).
+bool isLocalEndpoint(const std::string& endpoint);
+
+// Get the port of an endpoint, or 0 if the endpoint has no numeric port (IPC or in-process transports).
+unsigned endpointPort(const std::string& endpoint);
+
+// Get the RADIO/DISH group for a topic (truncated to the maximum group length).
+std::string topicToGroup(std::string_view topic);
+
+// Pack a multipart message into a single message (for single part sockets like RADIO/DISH). Each part is stored
+// as a 4 bytes big endian size followed by the part data.
+zmq::message_t packMultipart(const zmq::multipart_t& multipart);
+
+// Unpack a message packed with packMultipart. Returns false if the message is malformed.
+bool unpackMultipart(const zmq::message_t& packed, zmq::multipart_t& multipart);
+
+// Create a zero-copy message that holds a reference to a shared buffer. The reference is released by ZMQ when the
+// message has been sent, so the same buffer can be used by several messages at the same time.
+zmq::message_t makeSharedMessage(const std::shared_ptr<const std::byte[]>& bytes, std::size_t size);
+
+}}} // END NAMESPACES.
+// =====================================================================================================================
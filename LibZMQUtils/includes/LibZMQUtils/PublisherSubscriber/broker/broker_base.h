@@ -0,0 +1,314 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file broker_base.h
+ * @brief This file contains the declaration of the BrokerBase class and related.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+#include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_data.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+/**
+ * @brief The BrokerBase class implements a XSUB/XPUB forwarding broker for the publisher-subscriber pattern.
+ *
+ * The broker connects to several publishers (XSUB side) and binds a single endpoint for the subscribers (XPUB side),
+ * so each subscriber only needs one connection instead of one per publisher. The subscriptions of the subscribers
+ * are forwarded upstream incrementally: only the first subscription and the last unsubscription of each topic reach
+ * the publishers. The messages are forwarded frame by frame without copies.
+ *
+ * The broker also keeps per topic traffic statistics (see `getStats`) and provides internal callbacks for capturing
+ * the forwarded messages and the subscription changes.
+ */
+class LIBZMQUTILS_EXPORT BrokerBase : public ZMQContextHandler
+{
+
+public:
+
+    /**
+     * @brief Constructs a ZeroMQ-based broker with specific parameters.
+     *
+     * @param broker_port    The port on which the broker will listen for the subscribers connections.
+     * @param broker_iface   The interface address on which the broker will accept connections. By default, it listens
+     *                       on all available interfaces ("*").
+     * @param broker_name    Optional parameter to specify the broker name. By default is empty.
+     *
+     * @throws std::invalid_argument If the port is zero.
+     */
+    BrokerBase(unsigned broker_port,
+               const std::string& broker_iface = "*",
+               const std::string& broker_name = "");
+
+    /**
+     * @brief Start the broker, binding the subscribers endpoint and connecting to the added publishers.
+     * @return true if it was started successfully. False otherwise.
+     */
+    bool startBroker();
+
+    /**
+     * @brief Stops the broker and cleans the sockets. The added publishers are kept for the next start.
+     */
+    void stopBroker();
+
+    /**
+     * @brief Check if the broker is working.
+     * @return True if the broker is working, false otherwise.
+     */
+    bool isWorking() const;
+
+    /**
+     * @brief Get the endpoint that this broker is bound to (subscribers side).
+     * @return the URL of the endpoint that this broker is bound to.
+     */
+    const std::string& getEndpoint() const;
+
+    /**
+     * @brief Get the name of the broker.
+     * @return The name of the broker.
+     */
+    const std::string& getName() const;
+
+    /**
+     * @brief Add a publisher whose messages will be forwarded. If the broker is working, the change is applied
+     *        incrementally to the running socket.
+     * @param pub_endpoint, the endpoint URL of the publisher.
+     * @throw std::invalid_argument If the endpoint is empty.
+     */
+    void addPublisher(const std::string& pub_endpoint);
+
+    /**
+     * @brief Remove a publisher. If the broker is working, the change is applied incrementally to the running socket.
+     * @param pub_endpoint, the endpoint URL of the publisher.
+     */
+    void removePublisher(const std::string& pub_endpoint);
+
+    /**
+     * @brief Get the endpoints of the added publishers.
+     * @return A set with the endpoints of the publishers.
+     */
+    std::set<std::string> getPublishers() const;
+
+    /**
+     * @brief Enables the capture callback (`onMsgCaptured`). It is disabled by default, since the message must be
+     *        fully received before forwarding it.
+     * @param enabled, true for enabling the capture.
+     */
+    void setCaptureEnabled(bool enabled);
+
+    /**
+     * @brief Check if the capture callback is enabled.
+     * @return True if the capture is enabled, false otherwise.
+     */
+    bool getCaptureEnabled() const;
+
+    /**
+     * @brief Get a snapshot of the forwarding statistics.
+     * @return The broker statistics.
+     */
+    BrokerStats getStats() const;
+
+    /**
+     * @brief Resets the forwarding statistics.
+     */
+    void resetStats();
+
+    /**
+     * @brief Sets the configuration (name, CPU affinity and scheduling) of the broker worker thread. By default, the
+     *        thread is only named "zmq-broker".
+     * @param config The thread configuration.
+     * @note This value will only be modified if the broker is stopped.
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the broker worker thread.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the broker worker thread (the last one, if the broker is stopped).
+     * @return The CPU time of the worker thread.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Virtual destructor. The broker will stop if is running but in this case the `onBrokerStop` callback
+     *        can't be executed.
+     */
+    virtual ~BrokerBase() override;
+
+protected:
+
+    /**
+     * @brief Check if the broker context is in use (the broker is working).
+     * @return True if the broker is working.
+     */
+    bool isContextInUse() const override;
+
+    /**
+     * @brief Base broker start callback. Subclasses can override this function.
+     */
+    virtual void onBrokerStart();
+
+    /**
+     * @brief Base broker stop callback. Subclasses can override this function.
+     */
+    virtual void onBrokerStop();
+
+    /**
+     * @brief Base message captured callback (only if the capture is enabled). Subclasses can override this function.
+     *
+     * @param topic The topic (first frame) of the message.
+     * @param msg The complete message, before forwarding it.
+     *
+     * @warning The callback is executed in the broker worker thread, so it must be non-blocking and have minimal
+     *          computation time. Otherwise, the forwarding of every message will be delayed.
+     */
+    virtual void onMsgCaptured(std::string_view topic, const zmq::multipart_t& msg);
+
+    /**
+     * @brief Base subscription change callback. Subclasses can override this function.
+     *
+     * @param topic The topic of the subscription.
+     * @param subscribed True for a new subscription, false for an unsubscription.
+     *
+     * @warning The callback is executed in the broker worker thread, so it must be non-blocking.
+     */
+    virtual void onSubscriptionChanged(const TopicType& topic, bool subscribed);
+
+    /**
+     * @brief Base broker error callback. Subclasses can override this function.
+     */
+    virtual void onBrokerError(const zmq::error_t&, const std::string&);
+
+private:
+
+    // Forward declaration of the control commands.
+    enum class ControlCommand : std::uint8_t;
+
+    // Broker worker (will be executed asynchronously).
+    void brokerWorker();
+
+    // Function for forwarding a message from the publishers to the subscribers (only in the worker thread).
+    void forwardMessage();
+
+    // Function for forwarding a subscription from the subscribers to the publishers (only in the worker thread).
+    void forwardSubscription();
+
+    // Function for storing the topic identifiers announced by a publisher (only in the worker thread).
+    void processTopicIdsAnnouncement(zmq::multipart_t& frames);
+
+    // Internal helper for stopping the broker.
+    void internalStopBroker();
+
+    // Internal helper to delete the ZMQ sockets.
+    void deleteSockets();
+
+    // Function for sending a control command to the worker (and wait for the result).
+    bool sendCtrlCommand(ControlCommand command, const std::string& arg);
+
+    // Function for receiving and executing a control command in the worker. Returns true for the exit command.
+    bool processCtrlCommand();
+
+    // Function for applying a control command to the publishers socket (only in the worker thread).
+    bool applyCtrlCommand(ControlCommand command, const std::string& arg);
+
+    // ZMQ sockets.
+    zmq::socket_t* xsub_socket_;         ///< ZMQ XSUB socket (publishers side).
+    zmq::socket_t* xpub_socket_;         ///< ZMQ XPUB socket (subscribers side).
+    zmq::socket_t* recv_ctrl_socket_;    ///< ZMQ control socket (worker side).
+    zmq::socket_t* req_ctrl_socket_;     ///< ZMQ control socket (requester side).
+
+    // Broker info.
+    std::string endpoint_;               ///< Endpoint for the subscribers.
+    std::string name_;                   ///< Broker name.
+    std::set<std::string> publishers_;   ///< Endpoints of the publishers.
+
+    // Mutex.
+    mutable std::shared_mutex broker_mtx_;  ///< Safety mutex.
+    mutable std::mutex ctrl_mtx_;           ///< Control mutex (publishers and control socket).
+
+    // Statistics.
+    BrokerStats stats_;                  ///< Forwarding statistics.
+    std::string topic_buffer_;           ///< Reusable buffer for the topic of the forwarded message (worker only).
+    std::string uuid_buffer_;            ///< Reusable buffer for the publisher UUID frame (worker only).
+    std::map<std::string, std::vector<TopicType>, std::less<>> topic_ids_;  ///< Announced topic names (worker only).
+    mutable std::mutex stats_mtx_;       ///< Statistics mutex.
+
+    // Worker thread.
+    std::thread worker_th_;                   ///< Broker worker thread.
+    utils::ThreadConfig thread_config_;       ///< Configuration of the worker thread.
+    utils::ThreadCpuClock worker_cpu_clock_;  ///< CPU time of the worker thread.
+
+    // Useful flags.
+    std::atomic_bool flag_working_;      ///< Flag for check the worker active status.
+    std::atomic_bool flag_capture_;      ///< Flag for enabling the capture callback.
+
+    /// Specific class scope (for debug purposes).
+    inline static const std::string kScope = "[LibZMQUtils,PublisherSubscriber,BrokerBase]";
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -45,7 +45,13 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <array>
 #include <string>
+#include <string_view>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <vector>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
@@ -65,6 +71,9 @@ namespace pubsub{
 // =====================================================================================================================
 using ResultType = std::int32_t;    ///< Type used for the BaseServerResult enumeration.
 using TopicType = std::string;      ///< Type used for representing the publisher-subscriber topics.
+using TopicId = std::uint16_t;      ///< Type used for the interned numeric topic identifiers.
+using SequenceType = std::uint64_t; ///< Type used for the message sequence numbers.
+using StampTimePoint = std::chrono::system_clock::time_point;  ///< Type used for the binary latency time stamps.
 using PriorityType = std::uint8_t;  ///< Type used for the BaseServerResult enumeration.
 // =====================================================================================================================
 
@@ -92,9 +101,21 @@ enum class OperationResult : ResultType
     INVALID_PUB_UUID       = 18,  ///< The publisher UUID is invalid (could be invalid, missing or empty).
     PUBLISHER_STOPPED      = 19,  ///< The publisher is stopped.
     OVERFLOW_QUEUE         = 20,  ///< The selected msg queue is overflown. You must wait or select another priority.
+    UNKNOWN_TOPIC_ID       = 21,  ///< The topic identifier has not been announced by the publisher yet.
     END_BASE_RESULTS       = 50   ///< Sentinel value indicating the end of the base server results.
 };
 
+/**
+ * @enum DispatchQueuePolicy
+ * @brief Enumerates the policies of the subscriber dispatch queues when the process functions can't keep up.
+ */
+enum class DispatchQueuePolicy : std::uint8_t
+{
+    UNBOUNDED   = 0,  ///< The dispatch queues grow without limit (default).
+    DROP_OLDEST = 1,  ///< When a dispatch queue is full, the oldest pending message is dropped.
+    CONFLATE    = 2   ///< Only the newest pending message of each topic is kept (full queues also drop the oldest).
+};
+
 enum class MessagePriority : PriorityType
 {
     NoPriority       = 0,
@@ -108,6 +129,26 @@ enum class MessagePriority : PriorityType
 /// overflows.
 constexpr std::size_t kMaxSendingQueueSize = 100000;
 
+/// Maximum number of topics with traffic statistics in a broker. The messages and subscriptions of the new topics
+/// beyond this limit are only accounted in the totals.
+constexpr std::size_t kMaxBrokerTopicStats = 10000;
+
+/// Reserved topic used by the publishers to announce the table of interned topic identifiers.
+constexpr std::string_view kReservedTopicTopicIds = "RESERVED_TOPIC_TOPICIDS";
+
+/// First byte of the topic frames that carry an interned topic identifier instead of the topic name.
+constexpr char kTopicIdMarker = '\0';
+
+/// Size of the topic frames that carry an interned topic identifier (marker plus big endian identifier).
+constexpr std::size_t kTopicIdFrameSize = 1 + sizeof(TopicId);
+
+/// Period for announcing the table of interned topic identifiers (for late joining subscribers).
+constexpr std::chrono::milliseconds kTopicIdsAnnouncePeriod{1000};
+
+/// Number of sequences (up to the last one) tracked for detecting late and duplicated messages. An older sequence is
+/// considered a restart of the publisher sequence.
+constexpr SequenceType kSequenceWindow = 64;
+
 /// Minimum valid base enum result identifier (related to OperationResult enum).
 constexpr int kMinBaseResultId = static_cast<int>(OperationResult::INVALID_RESULT) + 1;
 
@@ -141,7 +182,7 @@ static constexpr std::array<const char*, kMaxBaseResultSrings>  OperationResultS
     "INVALID_PUB_UUID - The publisher UUID is invalid (could be invalid, missing or empty).",
     "PUBLISHER_STOPPED - The publisher is stopped.",
     "OVERFLOW QUEUE - The selected priority queue is overflown. Wait or select another priority.",
-    "RESERVED_BASE_RESULT",
+    "UNKNOWN_TOPIC_ID - The topic identifier has not been announced by the publisher yet.",
     "RESERVED_BASE_RESULT",
     "RESERVED_BASE_RESULT",
     "RESERVED_BASE_RESULT",
@@ -183,6 +224,57 @@ static constexpr std::array<const char*, kMaxBaseResultSrings>  OperationResultS
  */
 using PublishedData = serializer::BinarySerializedData;
 
+/**
+ * @brief The SharedPublishedData contains a reference counted and immutable published data.
+ *
+ * It is used for publishing the same payload (for example, a big image or data block) on several topics, or for
+ * publishing it several times, without copying or serializing it again. The data is serialized only once and each
+ * enqueued message holds a reference to the same buffer, that is sent by ZMQ without copies (zero-copy messages).
+ * The buffer is released when the last message that uses it has been sent.
+ */
+struct LIBZMQUTILS_EXPORT SharedPublishedData
+{
+    /**
+     * @brief Default constructor for creating an empty shared data.
+     */
+    SharedPublishedData();
+
+    /**
+     * @brief Constructor that takes the ownership of a published data buffer (no copies are made).
+     * @param data The published data.
+     */
+    SharedPublishedData(PublishedData&& data);
+
+    /**
+     * @brief Creates a shared data serializing the arguments (only once).
+     * @param args The arguments to serialize.
+     * @return The shared data.
+     */
+    template <typename... Args>
+    static SharedPublishedData create(const Args&... args)
+    {
+        PublishedData data;
+        if constexpr (sizeof...(args) > 0)
+            data.size = serializer::BinarySerializer::fastSerialization(data.bytes, args...);
+        return SharedPublishedData(std::move(data));
+    }
+
+    /**
+     * @brief Checks if the shared data is empty.
+     * @return True if there is no binary data or if the binary data size is zero, false otherwise.
+     */
+    bool isEmpty() const;
+
+    /**
+     * @brief Releases the reference to the buffer.
+     */
+    void clear();
+
+    // Struct data.
+    std::shared_ptr<const std::byte[]> bytes;  ///< Shared serialized data buffer.
+    serializer::SizeUnit size;                 ///< Total binary serialized data size.
+};
+
 /**
  * @brief The PublishedMessage struct represents a message exchanged between publisher and subscribers.
  *        It includes data and publisher info.
@@ -234,11 +326,17 @@ struct LIBZMQUTILS_EXPORT PublishedMessage
     void clear();
 
     // Struct data.
-    TopicType topic;             ///< Topic associated to the published message.
-    MessagePriority priority;    ///< Priority associated to the published message.
-    utils::UUID publisher_uuid;  ///< Publisher UUID unique identification.
-    PublishedData data;          ///< Original binary serialized published data.
-    std::string timestamp;       ///< ISO8601 string timestamp that represents the time when the message was created.
+    TopicType topic;                 ///< Topic associated to the published message.
+    MessagePriority priority;        ///< Priority associated to the published message.
+    utils::UUID publisher_uuid;      ///< Publisher UUID unique identification.
+    PublishedData data;              ///< Original binary serialized published data.
+    SharedPublishedData shared_data; ///< Shared published data (only in publishers, used instead of the data).
+    std::string timestamp;           ///< ISO8601 string timestamp that represents the time when the msg was created.
+    SequenceType sequence;           ///< Sequence number of the message for its publisher (starts at 1).
+    SequenceType topic_sequence;     ///< Sequence number of the message for its topic (0 if it is not enabled).
+    StampTimePoint enqueue_tp;       ///< Time when the message was enqueued in the publisher.
+    StampTimePoint send_tp;          ///< Time when the message was sent by the publisher worker.
+    StampTimePoint recv_tp;          ///< Time when the message was received by the subscriber (only in subscribers).
 };
 
 // TODO: This is not fully functional
@@ -254,7 +352,9 @@ struct LIBZMQUTILS_EXPORT PublishedMessageDeserialized
         topic(std::move(msg.topic)),
         priority(std::move(msg.priority)),
         publisher_uuid(std::move(msg.publisher_uuid)),
-        timestamp(std::move(msg.timestamp))
+        timestamp(std::move(msg.timestamp)),
+        sequence(msg.sequence),
+        topic_sequence(msg.topic_sequence)
     {}
 
     void clear()
@@ -264,6 +364,8 @@ struct LIBZMQUTILS_EXPORT PublishedMessageDeserialized
         this->data = T();
         this->timestamp.clear();
         this->priority = MessagePriority::NormalPriority;
+        this->sequence = 0;
+        this->topic_sequence = 0;
     }
 
     // Struct data
@@ -272,6 +374,236 @@ struct LIBZMQUTILS_EXPORT PublishedMessageDeserialized
     utils::UUID publisher_uuid;  ///< Publisher UUID unique identification.
     T data;                      ///< Deserialized published data.
     std::string timestamp;       ///< ISO8601 string timestamp that represents the time when the message was created.
+    SequenceType sequence;       ///< Sequence number of the message for its publisher (starts at 1).
+    SequenceType topic_sequence; ///< Sequence number of the message for its topic (0 if it is not enabled).
+};
+
+/**
+ * @brief Builds the topic frame for an interned topic identifier. This frame can be used as ZMQ subscription filter.
+ * @param id, the topic identifier.
+ * @return The topic frame (marker plus big endian identifier).
+ */
+LIBZMQUTILS_EXPORT TopicType makeTopicIdFrame(TopicId id);
+
+/**
+ * @brief Checks if a topic frame carries an interned topic identifier and extracts it.
+ * @param frame, the received topic frame.
+ * @param id, the output topic identifier.
+ * @return True if the frame carries a topic identifier, false if it is a plain topic.
+ */
+LIBZMQUTILS_EXPORT bool parseTopicIdFrame(std::string_view frame, TopicId& id);
+
+/**
+ * @brief Builds the data of a topic identifiers announcement, with a range of consecutive identifiers.
+ * @param first_id, the identifier of the first announced name.
+ * @param names, the announced topic names (the identifier of each name is `first_id` plus its position).
+ * @return The announcement data.
+ */
+LIBZMQUTILS_EXPORT PublishedData makeTopicIdsAnnouncement(TopicId first_id, const std::vector<TopicType>& names);
+
+/**
+ * @brief Parses the data of a topic identifiers announcement.
+ * @param msg, the announcement message (topic `kReservedTopicTopicIds`).
+ * @param first_id, the identifier of the first announced name.
+ * @param names, the announced topic names (the identifier of each name is `first_id` plus its position).
+ * @return True if the announcement is valid, false otherwise.
+ */
+LIBZMQUTILS_EXPORT bool parseTopicIdsAnnouncement(const PublishedMessage& msg, TopicId& first_id,
+                                                  std::vector<TopicType>& names);
+
+/**
+ * @brief Merges a topic identifiers announcement into a table of topic names indexed by identifier.
+ *
+ * The identifiers that were never announced (for example, if an announcement was lost) are stored as empty names. The
+ * identifiers are immutable for each publisher, so the already known names are not modified.
+ *
+ * @param msg, the announcement message (topic `kReservedTopicTopicIds`).
+ * @param table, the table of topic names to update.
+ * @return True if the announcement is valid, false otherwise.
+ */
+LIBZMQUTILS_EXPORT bool mergeTopicIdsAnnouncement(const PublishedMessage& msg, std::vector<TopicType>& table);
+
+/**
+ * @brief The TopicDispatchStats struct contains the dispatch statistics of the messages received for a specific topic.
+ */
+struct LIBZMQUTILS_EXPORT TopicDispatchStats
+{
+    /**
+     * @brief TopicDispatchStats default constructor.
+     */
+    TopicDispatchStats();
+
+    /**
+     * @brief Get the mean time spent in the process function (callback) of the topic.
+     * @return The mean callback time, or zero if no message has been processed.
+     */
+    std::chrono::nanoseconds meanClbkTime() const;
+
+    // Struct data.
+    std::uint64_t processed_msgs;              ///< Number of messages processed for the topic.
+    std::uint64_t dropped_msgs;                ///< Number of messages dropped or conflated by the dispatch queue.
+    std::chrono::nanoseconds total_clbk_time;  ///< Accumulated time spent in the topic callback.
+    std::chrono::nanoseconds last_clbk_time;   ///< Time spent in the last topic callback.
+    std::chrono::nanoseconds max_clbk_time;    ///< Maximum time spent in the topic callback.
+};
+
+/**
+ * @brief The SubscriberDispatchStats struct contains a snapshot of the subscriber dispatch stage statistics.
+ */
+struct LIBZMQUTILS_EXPORT SubscriberDispatchStats
+{
+    // Struct data.
+    std::vector<std::size_t> queue_depths;              ///< Current queue depth of each dispatch worker.
+    std::vector<std::size_t> max_queue_depths;          ///< Maximum queue depth reached by each dispatch worker.
+    std::vector<std::uint64_t> dropped_msgs;            ///< Messages dropped or conflated by each dispatch worker.
+    std::vector<std::chrono::nanoseconds> queue_lags;   ///< Age of the oldest pending message of each worker.
+    std::vector<std::chrono::nanoseconds> cpu_times;    ///< CPU time consumed by each dispatch worker thread.
+    std::map<TopicType, TopicDispatchStats> topics;     ///< Dispatch statistics for each processed topic.
+};
+
+/**
+ * @brief The LatencyHistogram struct contains a logarithmic histogram of latency samples.
+ *
+ * The bucket 0 contains the samples under 1 microsecond, and the bucket `i` contains the samples in the range
+ * [2^(i-1), 2^i) microseconds. The last bucket also contains every bigger sample.
+ */
+struct LIBZMQUTILS_EXPORT LatencyHistogram
+{
+    /// Number of buckets of the histogram.
+    static constexpr std::size_t kBuckets = 32;
+
+    /**
+     * @brief LatencyHistogram default constructor.
+     */
+    LatencyHistogram();
+
+    /**
+     * @brief Adds a new sample to the histogram. Negative samples (clock skew) are stored as zero.
+     * @param sample The latency sample.
+     */
+    void addSample(std::chrono::nanoseconds sample);
+
+    /**
+     * @brief Adds the samples of other histogram to this one.
+     * @param other The histogram to merge.
+     */
+    void merge(const LatencyHistogram& other);
+
+    /**
+     * @brief Get the mean latency.
+     * @return The mean latency, or zero if there are no samples.
+     */
+    std::chrono::nanoseconds mean() const;
+
+    /**
+     * @brief Get an approximation of a percentile (the upper limit of the bucket that contains it).
+     * @param percentile The percentile, in the range [0, 100].
+     * @return The approximated percentile, limited to the maximum sample, or zero if there are no samples.
+     */
+    std::chrono::nanoseconds percentile(double percentile) const;
+
+    // Struct data.
+    std::uint64_t count;                            ///< Number of samples.
+    std::chrono::nanoseconds total;                 ///< Sum of all the samples.
+    std::chrono::nanoseconds min;                   ///< Minimum sample.
+    std::chrono::nanoseconds max;                   ///< Maximum sample.
+    std::array<std::uint64_t, kBuckets> buckets;    ///< Number of samples in each bucket.
+};
+
+/**
+ * @brief The TopicLatencyStats struct contains the end-to-end latency histograms of a topic.
+ *
+ * The latency is split in three stages: queueing (from the publisher enqueue to the send), wire (from the send to the
+ * reception in the subscriber) and dispatch (from the reception to the process function call). The wire stage uses
+ * clocks of different hosts, so it is only meaningful if the clocks are synchronized.
+ */
+struct LIBZMQUTILS_EXPORT TopicLatencyStats
+{
+    // Struct data.
+    LatencyHistogram queueing;  ///< Latency between the enqueue and the send in the publisher.
+    LatencyHistogram wire;      ///< Latency between the send in the publisher and the reception in the subscriber.
+    LatencyHistogram dispatch;  ///< Latency between the reception and the process function call.
+};
+
+/**
+ * @brief The SequenceStats struct contains the sequence tracking statistics of a publisher or a topic.
+ */
+struct LIBZMQUTILS_EXPORT SequenceStats
+{
+    /**
+     * @brief SequenceStats default constructor.
+     */
+    SequenceStats();
+
+    /**
+     * @brief Updates the statistics with a received sequence number.
+     *
+     * A gap counts the missing sequences as lost. If a missing sequence arrives later (inside the `kSequenceWindow`),
+     * it counts as reordered and it is no longer lost. A sequence older than the window starts the tracking again.
+     *
+     * @param seq, the received sequence number.
+     * @return The number of new lost messages (gap before this sequence).
+     */
+    std::uint64_t track(SequenceType seq);
+
+    // Struct data.
+    std::uint64_t received_msgs;    ///< Number of tracked messages.
+    std::uint64_t lost_msgs;        ///< Number of messages lost (gaps in the sequence not filled later).
+    std::uint64_t duplicated_msgs;  ///< Number of messages received twice.
+    std::uint64_t reordered_msgs;   ///< Number of messages received after a newer one.
+    std::uint64_t restarts;         ///< Number of restarts of the sequence (older than the tracking window).
+    SequenceType last_sequence;     ///< Last (highest) sequence number received.
+    std::uint64_t recv_window;      ///< Received sequences up to the last one (bit N is `last_sequence - N`).
+};
+
+/**
+ * @brief The PublisherSequenceStats struct contains the sequence tracking statistics of a publisher.
+ */
+struct LIBZMQUTILS_EXPORT PublisherSequenceStats
+{
+    // Struct data.
+    SequenceStats publisher;                    ///< Statistics of the publisher sequence.
+    std::map<TopicType, SequenceStats> topics;  ///< Statistics of each topic sequence (if enabled in the publisher).
+};
+
+/**
+ * @brief The TopicTrafficStats struct contains the traffic statistics of a topic forwarded by a broker.
+ */
+struct LIBZMQUTILS_EXPORT TopicTrafficStats
+{
+    /**
+     * @brief TopicTrafficStats default constructor.
+     */
+    TopicTrafficStats();
+
+    // Struct data.
+    std::uint64_t msgs;           ///< Number of forwarded messages.
+    std::uint64_t bytes;          ///< Number of forwarded bytes (all the message parts).
+    std::uint64_t subscriptions;  ///< Number of subscriptions to the topic received from the subscribers side.
+};
+
+/**
+ * @brief The BrokerStats struct contains a snapshot of the broker forwarding statistics.
+ *
+ * The topics sent as interned identifiers (see PublisherBase::setTopicIdsEnabled) are resolved using the
+ * announcements of each publisher. The messages whose identifier is not announced yet and the messages of the new
+ * topics beyond `kMaxBrokerTopicStats` are only accounted in the totals (see `untracked_msgs`). The subscriptions to
+ * the identifier frames are only accounted in the totals, since the same identifier can be used by several publishers.
+ */
+struct LIBZMQUTILS_EXPORT BrokerStats
+{
+    /**
+     * @brief BrokerStats default constructor.
+     */
+    BrokerStats();
+
+    // Struct data.
+    std::uint64_t msgs;                                         ///< Total number of forwarded messages.
+    std::uint64_t bytes;                                        ///< Total number of forwarded bytes.
+    std::uint64_t subscriptions;                                ///< Total number of forwarded subscriptions.
+    std::uint64_t unsubscriptions;                              ///< Total number of forwarded unsubscriptions.
+    std::uint64_t untracked_msgs;                               ///< Forwarded messages not accounted in the topics.
+    std::map<TopicType, TopicTrafficStats, std::less<>> topics; ///< Traffic statistics of each topic.
 };
 
 // =====================================================================================================================
@@ -0,0 +1,113 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file typed_topic.h
+ * @brief This file contains the declaration of the Topic template, used for compile-time typed topics.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <string_view>
+#include <type_traits>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_data.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+/**
+ * @brief The Topic template is a compile-time descriptor that binds a topic name with its payload type.
+ *
+ * A typed topic is shared by the publishers and the subscribers, so the payload type is checked by the compiler in
+ * both sides (see PublisherBase::enqueueTypedMsg and ClbkSubscriberBase::registerTypedCallback), instead of failing
+ * in runtime with a BAD_PARAMETERS error. The payload is serialized as in the untyped functions, so typed and untyped
+ * publishers and subscribers can be mixed.
+ *
+ * In C++17 the name must be a character array with static storage duration. The `M_DECLARE_PUBSUB_TOPIC` macro
+ * declares both the array and the topic alias:
+ *
+ * @code
+ * M_DECLARE_PUBSUB_TOPIC(AmelasPosTopic, "amelas/pos", AltAzPos)
+ * @endcode
+ *
+ * @tparam Name The topic name.
+ * @tparam Payload The payload type. It must be serializable by the BinarySerializer.
+ */
+template <const char* Name, typename Payload>
+struct Topic
+{
+    static_assert(!std::is_reference_v<Payload> && !std::is_const_v<Payload>,
+                  "The payload type of a topic must be a plain value type.");
+
+    using PayloadType = Payload;                         ///< Payload type of the topic.
+    static constexpr std::string_view kName = Name;      ///< Name of the topic.
+};
+
+/// Trait for checking if a type is a Topic descriptor.
+template <typename T>
+struct IsTopic : std::false_type {};
+
+template <const char* Name, typename Payload>
+struct IsTopic<Topic<Name, Payload>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool kIsTopic = IsTopic<T>::value;
+
+}} // END NAMESPACES.
+// =====================================================================================================================
+
+/**
+ * @brief Declares a typed topic descriptor (see Topic) at namespace scope.
+ * @param TopicAlias The name of the topic alias that will be declared.
+ * @param TopicName The topic name (a string literal).
+ * @param PayloadType The payload type.
+ */
+#define M_DECLARE_PUBSUB_TOPIC(TopicAlias, TopicName, PayloadType)                      \
+    inline constexpr char TopicAlias##_kTopicName[] = TopicName;                         \
+    using TopicAlias = zmqutils::pubsub::Topic<TopicAlias##_kTopicName, PayloadType>;
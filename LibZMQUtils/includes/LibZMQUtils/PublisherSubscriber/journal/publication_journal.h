@@ -0,0 +1,267 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file publication_journal.h
+ * @brief This file contains the declaration of the PublicationJournalWriter and PublicationJournalReader classes.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQ INCLUDES
+// =====================================================================================================================
+#include <zmq.hpp>
+#include <zmq_addon.hpp>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+#include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_data.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace internal_helpers{
+namespace files{
+class MemoryMappedFile;
+}}
+namespace pubsub{
+// =====================================================================================================================
+
+// FORWARD DECLARATIONS
+// =====================================================================================================================
+class SubscriberBase;
+// =====================================================================================================================
+
+/// Default size of each journal segment file (64 MB).
+constexpr std::size_t kDefaultJournalSegmentSize = 64 * 1024 * 1024;
+
+/// Default maximum number of records pending to be written to the journal.
+constexpr std::size_t kDefaultJournalMaxPending = 100000;
+
+/// Extension of the journal segment files.
+constexpr std::string_view kJournalSegmentExtension = ".zmqj";
+
+/**
+ * @brief The PublicationJournalWriter class writes the published messages to an append-only journal.
+ *
+ * The journal is a sequence of memory-mapped segment files named `<prefix>_<index>.zmqj` (the index has 6 digits)
+ * in an existing directory. Each record stores the publisher sequence number, the sending time and every frame of the
+ * message as it was sent (topic, publisher uuid, timestamp, header and data), so the journal can be replayed exactly.
+ *
+ * The `append` function only takes references to the message frames (the ZMQ messages are reference counted, and the
+ * small frames are copied) and hands them to an internal writer thread. So the writing to the files happens off the
+ * sending path of the publisher.
+ *
+ * @note The data is written in the mapped memory, so it survives a crash of the process, but not a crash of the
+ *       operating system. The records use the host byte order.
+ */
+class LIBZMQUTILS_EXPORT PublicationJournalWriter
+{
+public:
+
+    /**
+     * @brief Constructs a journal writer. The segments are created after the last existing segment of the journal.
+     * @param directory The existing directory where the segment files will be stored.
+     * @param prefix The prefix of the segment files.
+     * @param segment_size The size of each segment file. The records bigger than this size use a bigger segment.
+     * @param max_pending The maximum number of records pending to be written. If the writer thread can't keep up
+     *                    with the publisher, the new records are dropped and accounted as failed records.
+     */
+    PublicationJournalWriter(const std::string& directory, const std::string& prefix,
+                             std::size_t segment_size = kDefaultJournalSegmentSize,
+                             std::size_t max_pending = kDefaultJournalMaxPending);
+
+    PublicationJournalWriter(const PublicationJournalWriter&) = delete;
+    PublicationJournalWriter& operator=(const PublicationJournalWriter&) = delete;
+
+    /**
+     * @brief Appends a message to the journal. The frames are shared, not consumed, so the message can be sent later.
+     *        If there are too many pending records, the message is dropped (see `getFailedRecords`).
+     * @param sequence The publisher sequence number of the message.
+     * @param send_tp The sending time of the message.
+     * @param msg The message frames.
+     */
+    void append(SequenceType sequence, const StampTimePoint& send_tp, zmq::multipart_t& msg);
+
+    /**
+     * @brief Waits until every appended message has been written to the journal.
+     */
+    void flush();
+
+    /**
+     * @brief Get the number of records written to the journal.
+     * @return The number of written records.
+     */
+    std::uint64_t getWrittenRecords() const;
+
+    /**
+     * @brief Get the number of records that could not be written (for example, if a segment can't be created or if
+     *        there were too many pending records).
+     * @return The number of failed records.
+     */
+    std::uint64_t getFailedRecords() const;
+
+    /**
+     * @brief Destructor. The pending records are written before finishing.
+     */
+    ~PublicationJournalWriter();
+
+private:
+
+    // Pending record.
+    struct PendingRecord
+    {
+        SequenceType sequence;               ///< Publisher sequence number.
+        std::int64_t send_ns;                ///< Sending time (nanoseconds since epoch).
+        std::vector<zmq::message_t> frames;  ///< Shared message frames.
+    };
+
+    // Writer worker (will be executed asynchronously).
+    void writerWorker();
+
+    // Function for writing a record (only in the writer thread).
+    bool writeRecord(const PendingRecord& record);
+
+    // Function for opening the next segment file (only in the writer thread).
+    bool openNextSegment(std::size_t min_size);
+
+    // Configuration.
+    std::string directory_;                  ///< Journal directory.
+    std::string prefix_;                     ///< Segment files prefix.
+    std::size_t segment_size_;               ///< Size of each segment.
+    std::size_t max_pending_;                ///< Maximum number of pending records.
+
+    // Current segment.
+    std::unique_ptr<internal_helpers::files::MemoryMappedFile> segment_;  ///< Current mapped segment.
+    std::size_t segment_index_;              ///< Index of the current segment.
+    std::size_t segment_offset_;             ///< Write offset in the current segment.
+
+    // Pending records.
+    std::vector<PendingRecord> pending_;     ///< Records pending to be written.
+    std::size_t in_progress_;                ///< Records being written by the worker.
+    std::mutex mtx_;                         ///< Pending records mutex.
+    std::condition_variable cv_;             ///< Condition variable for new records.
+    std::condition_variable cv_flush_;       ///< Condition variable for the flush function.
+    bool stop_;                              ///< Flag for stopping the writer.
+    std::thread writer_th_;                  ///< Writer thread.
+
+    // Statistics.
+    std::atomic<std::uint64_t> written_records_;  ///< Number of written records.
+    std::atomic<std::uint64_t> failed_records_;   ///< Number of failed records.
+};
+
+/**
+ * @brief The JournalReplayConfig struct contains the configuration of a journal replay.
+ */
+struct LIBZMQUTILS_EXPORT JournalReplayConfig
+{
+    /**
+     * @brief JournalReplayConfig default constructor (replays everything as fast as possible).
+     */
+    JournalReplayConfig();
+
+    // Struct data.
+    SequenceType first_sequence;  ///< First publisher sequence number to replay.
+    SequenceType last_sequence;   ///< Last publisher sequence number to replay.
+    StampTimePoint from;          ///< Minimum sending time to replay.
+    StampTimePoint to;            ///< Maximum sending time to replay.
+    double speed;                 ///< Replay speed (1 is the original speed, 2 is twice as fast, 0 is no waits).
+};
+
+/**
+ * @brief The PublicationJournalReader class replays the messages stored by a PublicationJournalWriter.
+ *
+ * The replayed messages are decoded like in a subscriber (the interned topic identifiers are resolved with the
+ * announcements stored in the journal, that are not replayed), and they keep the original sequence numbers and time
+ * stamps. So the replay of an observing session is deterministic.
+ */
+class LIBZMQUTILS_EXPORT PublicationJournalReader
+{
+public:
+
+    /// Function that receives the replayed messages.
+    using ReplayFunction = std::function<void(PublishedMessage&&)>;
+
+    /**
+     * @brief Constructs a journal reader.
+     * @param directory The directory where the segment files are stored.
+     * @param prefix The prefix of the segment files.
+     */
+    PublicationJournalReader(const std::string& directory, const std::string& prefix);
+
+    /**
+     * @brief Replays the messages of the journal that are in the configured range.
+     * @param config The replay configuration (sequence and time ranges, and speed).
+     * @param func The function that receives the replayed messages.
+     * @return The number of replayed messages.
+     */
+    std::size_t replay(const JournalReplayConfig& config, const ReplayFunction& func) const;
+
+    /**
+     * @brief Replays the messages of the journal that are in the configured range into a subscriber. The messages
+     *        are injected in the subscriber (see SubscriberBase::injectMsg), so they are processed by its callbacks.
+     * @param config The replay configuration (sequence and time ranges, and speed).
+     * @param subscriber The subscriber.
+     * @return The number of replayed messages.
+     */
+    std::size_t replay(const JournalReplayConfig& config, SubscriberBase& subscriber) const;
+
+private:
+
+    std::string directory_;  ///< Journal directory.
+    std::string prefix_;     ///< Segment files prefix.
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -51,15 +51,22 @@
 #include <atomic>
 #include <shared_mutex>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 // =====================================================================================================================
 
 // LIBZMQUTILS INCLUDES
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/Global/zmq_reactor.h"
+#include "LibZMQUtils/Global/zmq_socket_options.h"
 #include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_data.h"
 #include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_info.h"
+#include "LibZMQUtils/PublisherSubscriber/data/typed_topic.h"
+#include "LibZMQUtils/PublisherSubscriber/journal/publication_journal.h"
 #include "LibZMQUtils/InternalHelpers/network_helpers.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
 // =====================================================================================================================
 
@@ -168,6 +175,233 @@ public:
      */
     bool isWorking() const;
 
+    /**
+     * @brief Enables or disables the interned numeric topic identifiers.
+     *
+     * When enabled, each topic gets a compact identifier the first time it is published, and the messages carry a
+     * small identifier frame instead of the full topic name. The identifiers are announced to the subscribers using
+     * the reserved topic `kReservedTopicTopicIds`: each new identifier when its topic is registered, and the whole
+     * table periodically (each `kTopicIdsAnnouncePeriod`) for late joining subscribers. The subscribers resolve the
+     * identifiers automatically, apply their topic filters to the resolved names and subscribe to the identifier
+     * frames of the allowed topics, so the messages are still filtered in the publisher side.
+     *
+     * A new identifier is only used in the topic frames after one announcement period. Meanwhile, the messages of the
+     * new topic carry the plain topic name, so the subscribers have time to subscribe to the identifier frame.
+     *
+     * @param enabled, true for enabling the topic identifiers, false for sending the plain topics.
+     * @note Subscribers that receive an identifier before its announcement report `UNKNOWN_TOPIC_ID`.
+     */
+    void setTopicIdsEnabled(bool enabled);
+
+    /**
+     * @brief Check if the interned numeric topic identifiers are enabled.
+     * @return true if the topic identifiers are enabled, false otherwise.
+     */
+    bool getTopicIdsEnabled() const;
+
+    /**
+     * @brief Enables or disables the per topic sequence numbers.
+     *
+     * Every message always carries a sequence number that increases monotonically for the publisher, so the
+     * subscribers can detect lost messages (for example, dropped at the high water mark). Subscribers that filter
+     * topics only receive part of the sequence, so they can't detect losses with it. In that case, the per topic
+     * sequence numbers should be enabled.
+     *
+     * @param enabled, true for stamping also the per topic sequence numbers, false otherwise.
+     */
+    void setTopicSequencesEnabled(bool enabled);
+
+    /**
+     * @brief Check if the per topic sequence numbers are enabled.
+     * @return true if the per topic sequence numbers are enabled, false otherwise.
+     */
+    bool getTopicSequencesEnabled() const;
+
+    /**
+     * @brief Enables or disables the direct send mode, for the lowest publication latency.
+     *
+     * By default, every message is enqueued and sent by the queue worker thread, so each publication pays a context
+     * switch (and its scheduling jitter). In the direct send mode, the calling thread sends the message synchronously
+     * when the sending queues are empty and the worker is not using the socket. Otherwise, the message is enqueued as
+     * usual, so the order of the messages is always preserved. With a single producer thread that doesn't outpace
+     * the socket, every message is sent directly and the priorities have no effect.
+     *
+     * @param enabled, true for enabling the direct send mode, false for always using the sending queues.
+     * @note In direct mode, the enqueue functions block the caller while the message is prepared and handed to ZMQ
+     *       (the network transfer is still done by the ZMQ I/O threads), and `onSendingMsg` is called from the
+     *       caller thread.
+     */
+    void setDirectSendEnabled(bool enabled);
+
+    /**
+     * @brief Check if the direct send mode is enabled.
+     * @return true if the direct send mode is enabled, false otherwise.
+     */
+    bool getDirectSendEnabled() const;
+
+    /**
+     * @brief Enables the UDP RADIO transport instead of the default TCP PUB transport.
+     *
+     * In this mode the publisher uses a RADIO socket that sends each message as a single UDP datagram to the given
+     * endpoint, using the topic as RADIO/DISH group. The endpoint can be a multicast group (for example
+     * "udp://239.192.0.1:9999") for fan-out to every consumer in a LAN segment, or the unicast address of a
+     * subscriber (for example "udp://127.0.0.1:9999"). The subscribers must subscribe to the same endpoint.
+     *
+     * Compared with the TCP PUB transport, the UDP transport avoids the per-subscriber TCP streams and the kernel
+     * buffering, so the latency is lower and does not grow with the number of subscribers. On the other hand:
+     *   - There are no retransmissions, so the messages can be lost (or reordered) under load. The sequence numbers
+     *     of each message allow measuring the losses in the subscribers (see SubscriberBase::getSequenceStats).
+     *   - Each message must fit in a single datagram (kMaxUdpDatagramSize bytes, including the headers).
+     *   - The topic filters are exact groups (no prefix filtering) and the groups are truncated to kMaxGroupLength.
+     *
+     * @param udp_endpoint The UDP destination endpoint. An empty endpoint restores the TCP PUB transport.
+     * @return True if the transport was set, false if the publisher is working or the ZMQ draft API is not available
+     *         in this build (the RADIO/DISH sockets are part of the draft API).
+     */
+    bool setUdpTransport(const std::string& udp_endpoint);
+
+    /**
+     * @brief Get the UDP destination endpoint.
+     * @return The UDP destination endpoint, or an empty string if the TCP PUB transport is used.
+     */
+    const std::string& getUdpTransport() const;
+
+    /**
+     * @brief Sets a local transport (IPC or in-process) for the publisher, instead of the TCP transport.
+     *
+     * In this mode the PUB socket is bound to the given endpoint (for example "ipc:///tmp/publisher.ipc" or
+     * "inproc://publisher") instead of the TCP endpoint. The subscribers must subscribe to the same endpoint. The
+     * in-process transport only works for subscribers in the same process, and it avoids the network stack (and
+     * the ZMQ I/O threads) completely.
+     *
+     * @param local_endpoint The local bind endpoint. An empty endpoint restores the TCP transport.
+     * @return True if the transport was set, false if the publisher is working or the endpoint is not local.
+     */
+    bool setLocalTransport(const std::string& local_endpoint);
+
+    /**
+     * @brief Get the local bind endpoint.
+     * @return The local bind endpoint, or an empty string if the TCP transport is used.
+     */
+    const std::string& getLocalTransport() const;
+
+    /**
+     * @brief Sets the ZMQ send high water mark (ZMQ_SNDHWM) of the publisher socket.
+     *
+     * The PUB socket never blocks the publisher. When the queue of a subscriber reaches the high water mark (because
+     * the subscriber or the network is slower than the publisher), the new messages for that subscriber are dropped,
+     * while the rest of subscribers keep receiving them. The losses can be measured in the subscribers using the
+     * sequence numbers (see SubscriberBase::getSequenceStats).
+     *
+     * @param hwm The maximum number of messages queued for each subscriber (0 means no limit). A negative value keeps
+     *            the ZMQ default (1000 messages).
+     *
+     * @note This value will only be modified if the publisher is stopped.
+     */
+    void setSendHWM(int hwm);
+
+    /**
+     * @brief Get the ZMQ send high water mark.
+     * @return The send high water mark, or a negative value for the ZMQ default.
+     */
+    int getSendHWM() const;
+
+    /**
+     * @brief Sets the tuning options (buffers, TCP keepalive, TOS...) of the publisher socket. See SocketOptions for
+     *        the available presets.
+     * @param options The socket options. The send high water mark configured with setSendHWM has priority.
+     * @note This value will only be modified if the publisher is stopped.
+     */
+    void setSocketOptions(const SocketOptions& options);
+
+    /**
+     * @brief Get the tuning options of the publisher socket.
+     * @return The socket options.
+     */
+    SocketOptions getSocketOptions() const;
+
+    /**
+     * @brief Get the options read back from the publisher socket when it was created (including the send high
+     *        water mark configured with setSendHWM).
+     * @return The applied socket options, or the default (negative) values if the socket was never created.
+     */
+    SocketOptions getAppliedSocketOptions() const;
+
+    /**
+     * @brief Sets the shared reactor used for sending the queued messages, instead of a dedicated worker thread.
+     *
+     * With a reactor, the queued messages are sent by tasks in the reactor loop (in batches, so the loop is shared
+     * with the rest of components), and the periodic announcement of the topic identifiers uses a reactor timer. The
+     * publisher doesn't create any thread.
+     *
+     * @param reactor The shared reactor, or nullptr for using a dedicated worker thread (the default).
+     *
+     * @note This value will only be modified if the publisher is stopped. The reactor must be running when the
+     *       publisher is started (otherwise the start fails and `onPublisherError` is called), and the publisher
+     *       should be stopped before the reactor.
+     */
+    void setReactor(std::shared_ptr<ZMQReactor> reactor);
+
+    /**
+     * @brief Get the shared reactor used for sending the queued messages.
+     * @return The shared reactor, or nullptr if the publisher uses a dedicated worker thread.
+     */
+    std::shared_ptr<ZMQReactor> getReactor() const;
+
+    /**
+     * @brief Sets the configuration (name, CPU affinity and scheduling) of the queue worker thread. By default, the
+     *        thread is only named "zmq-pub".
+     * @param config The thread configuration.
+     * @note This value will only be modified if the publisher is stopped. It is not used with a reactor.
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the queue worker thread.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the queue worker thread (the last one, if the publisher is stopped).
+     * @return The CPU time of the worker thread.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Enables the publication journal, that stores every published message (with its header) in a segmented
+     *        memory-mapped file for post-mortem analysis and replay (see PublicationJournalReader).
+     *
+     * The messages are written by a journal thread, so the sending path only takes references to the message frames.
+     *
+     * @param directory The existing directory where the journal segment files will be stored.
+     * @param prefix The prefix of the journal segment files.
+     * @param segment_size The size of each journal segment file.
+     * @param max_pending The maximum number of messages pending to be written. The messages beyond this limit are
+     *                    not written to the journal (see PublicationJournalWriter::getFailedRecords).
+     * @return True if the journal was enabled, false if the publisher is working.
+     */
+    bool enableJournal(const std::string& directory, const std::string& prefix,
+                       std::size_t segment_size = kDefaultJournalSegmentSize,
+                       std::size_t max_pending = kDefaultJournalMaxPending);
+
+    /**
+     * @brief Disables the publication journal. The pending messages are written before.
+     * @return True if the journal was disabled, false if the publisher is working.
+     */
+    bool disableJournal();
+
+    /**
+     * @brief Check if the publication journal is enabled.
+     * @return True if the journal is enabled, false otherwise.
+     */
+    bool isJournalEnabled() const;
+
+    /**
+     * @brief Waits until every sent message has been written to the publication journal (if it is enabled).
+     */
+    void flushJournal();
+
     /**
      * @brief Enqueues a messgae to be sent by the publisher worker.
      * @param topic, the topic associated to the message that will be sent.
@@ -210,6 +444,57 @@ public:
         return this->enqueueMsg(static_cast<TopicType>(topic), priority, std::move(data));
     }
 
+    /**
+     * @brief Sends a message of a typed topic (see Topic), serializing the payload.
+     *
+     * The payload type is checked in compile time against the payload type of the topic, so the subscribers that use
+     * the same topic descriptor can't receive an unexpected payload.
+     *
+     * @tparam TopicT The typed topic descriptor.
+     * @param priority, the message priority.
+     * @param payload, the payload of the message.
+     * @return the result of the sending operation.
+     */
+    template <typename TopicT>
+    OperationResult enqueueTypedMsg(MessagePriority priority, const typename TopicT::PayloadType& payload)
+    {
+        static_assert(kIsTopic<TopicT>, "The TopicT parameter must be a Topic descriptor.");
+
+        PublishedData data;
+        data.size = zmqutils::serializer::BinarySerializer::fastSerialization(data.bytes, payload);
+
+        return this->enqueueMsg(TopicType(TopicT::kName), priority, std::move(data));
+    }
+
+    /**
+     * @brief Enqueues a message with a shared data to be sent by the publisher worker.
+     *
+     * The data is not copied or serialized again, so the same SharedPublishedData can be enqueued several times (or
+     * on several topics) with a cost independent of the data size.
+     *
+     * @param topic, the topic associated to the message that will be sent.
+     * @param priority, the message priority.
+     * @param data, the shared data that will be sent in the message.
+     * @return The result of sending operation as an OperationResult enum.
+     */
+    OperationResult enqueueSharedMsg(const TopicType& topic, MessagePriority priority,
+                                     const SharedPublishedData& data);
+
+    /**
+     * @brief Enqueues a message with a shared data for each topic (fan-out of the same payload).
+     *
+     * Every message shares the same data buffer and the same timestamp. The memory and the serialization cost are
+     * independent of the number of topics.
+     *
+     * @param topics, the topics of the messages that will be sent.
+     * @param priority, the messages priority.
+     * @param data, the shared data that will be sent in the messages.
+     * @return The result of sending operation as an OperationResult enum. If some message can't be enqueued, the
+     *         result will be OVERFLOW_QUEUE.
+     */
+    OperationResult enqueueSharedMsg(const std::vector<TopicType>& topics, MessagePriority priority,
+                                     const SharedPublishedData& data);
+
     /**
      * @brief Get the network adapter information of interfaces that this publisher is bound to.
      *
@@ -231,6 +516,12 @@ public:
 
 protected:
 
+    /**
+     * @brief Check if the publisher context is in use (the publisher is working).
+     * @return True if the publisher is working.
+     */
+    bool isContextInUse() const override;
+
     /**
      * @brief Base publisher start callback. Subclasses can override this function.
      */
@@ -259,9 +550,27 @@ private:
     /// Internal method for the queue worker thread.
     void messageQueueWorker();
 
+    /// Internal method for sending the queued messages in the reactor loop.
+    void reactorQueueWorker();
+
+    /// Internal method for scheduling the reactor queue worker (if there are pending messages).
+    void scheduleReactorWorker();
+
+    /// Internal method for stopping the queue worker (the thread or the reactor tasks).
+    void stopQueueWorker();
+
+    /// Internal method for sending the next queued message. The queue lock is released while sending.
+    bool sendNextQueuedMsg(std::unique_lock<std::mutex>& lock);
+
     /// Internal method for enqueue messages.
     bool internalEnqueueMsg(PublishedMessage &&msg);
 
+    /// Internal method for publishing messages (direct send if possible, enqueue otherwise).
+    OperationResult internalPublishMsg(PublishedMessage &&msg);
+
+    /// Internal method for releasing the socket after a send.
+    void releaseSocket();
+
     /// Internal helper to delete the ZMQ sockets.
     void deleteSockets();
 
@@ -278,12 +587,33 @@ private:
     /// Be careful with this function, since it takes the ownership of the data.
     zmq::multipart_t prepareMessage(PublishedMessage &publication);
 
+    /// Internal function to get (or register) the identifier of a topic. Returns false while the identifier can't be
+    /// used in the topic frames yet (or if there are no free identifiers). Only for the socket owner.
+    bool internalGetTopicId(const TopicType& topic, TopicId& id);
+
+    /// Internal function to send a prepared message (transport selection and journal).
+    bool sendPreparedMsg(zmq::multipart_t& multipart_msg, const PublishedMessage& msg);
+
+    /// Internal function to send a message through the RADIO socket (UDP transport).
+    bool sendRadioMsg(zmq::multipart_t& multipart_msg, const TopicType& topic);
+
+    /// Internal function to publish a range of the table of topic identifiers. Only for the socket owner.
+    void announceTopicIds(TopicId first_id, std::size_t count);
+
     // Endpoint data and publisher info.
     NetworkAdapterInfoV publisher_adapters_;  ///< Interfaces bound by publisher.
     PublisherInfo pub_info_;                  ///< Publisher information.
 
     // ZMQ sockets and endpoint.
     zmq::socket_t *publisher_socket_;       ///< ZMQ publisher socket.
+    std::string udp_endpoint_;              ///< UDP destination endpoint (RADIO transport).
+    std::string local_endpoint_;            ///< Local bind endpoint (IPC or in-process transport).
+    int snd_hwm_;                           ///< Configured send high water mark.
+    SocketOptions socket_options_;          ///< Tuning options of the publisher socket.
+    SocketOptions applied_socket_options_;  ///< Options read back from the last created publisher socket.
+
+    // Publication journal.
+    std::unique_ptr<PublicationJournalWriter> journal_;  ///< Publication journal (if enabled).
     zmq::error_t last_zmq_error_;    ///< Last ZMQ error.
 
     // Mutex.
@@ -306,6 +636,32 @@ private:
     std::atomic_bool stop_queue_worker_;
     std::thread queue_worker_th_;
 
+    // Reactor integration. The scheduled flag is protected by the queue mutex.
+    std::shared_ptr<ZMQReactor> reactor_;      ///< Shared reactor (if null, the publisher uses its own worker thread).
+    ZMQReactor::HandlerId announce_timer_id_;  ///< Reactor registration of the topic identifiers announcement timer.
+    bool reactor_worker_scheduled_;            ///< True while a reactor queue worker task is pending or running.
+
+    // Worker thread configuration.
+    utils::ThreadConfig thread_config_;       ///< Configuration of the queue worker thread.
+    utils::ThreadCpuClock worker_cpu_clock_;  ///< CPU time of the queue worker thread.
+
+    // Direct send mode. The socket owner (the queue worker or a direct sender) is protected by the queue mutex.
+    std::atomic_bool flag_direct_send_;      ///< Flag for enabling the direct send mode.
+    bool socket_busy_;                       ///< The socket is being used by the worker or a direct sender.
+
+    // Interned topic identifiers (only used by the socket owner).
+    std::atomic_bool flag_topic_ids_;                                  ///< Flag for enabling the topic identifiers.
+    std::unordered_map<TopicType, TopicId> topic_ids_;                 ///< Registered topic identifiers.
+    std::vector<TopicType> topic_names_;                               ///< Topic names, indexed by id (queue mutex).
+    std::vector<std::chrono::steady_clock::time_point> topic_ids_tps_; ///< Time from which each identifier is used.
+    std::size_t active_topic_ids_;                                     ///< Identifiers already used in the frames.
+    std::chrono::steady_clock::time_point next_ids_announce_;          ///< Next periodic identifiers announcement.
+
+    // Sequence numbers (only used by the socket owner).
+    std::atomic_bool flag_topic_seqs_;                                 ///< Flag for enabling the topic sequences.
+    SequenceType pub_seq_;                                             ///< Last publisher sequence number.
+    std::unordered_map<TopicType, SequenceType> topic_seqs_;           ///< Last sequence number of each topic.
+
     // Specific class scope (for debug purposes).
     inline static const std::string kClassScope = "[LibZMQUtils,PublisherSubscriber,PublisherBase]";
 };
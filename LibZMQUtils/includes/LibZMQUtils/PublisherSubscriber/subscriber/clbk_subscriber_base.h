@@ -47,6 +47,7 @@
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/PublisherSubscriber/subscriber/subscriber_base.h"
+#include "LibZMQUtils/PublisherSubscriber/data/typed_topic.h"
 #include "LibZMQUtils/Utilities/callback_handler.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
 // =====================================================================================================================
@@ -81,6 +82,10 @@ public:
 
     /**
      * @brief Template function for registering a callback. This callback will be registered for a specific topic.
+     *
+     * The topic can be a pattern with wildcards (see TopicDispatchTrie). In that case, the callback will be invoked
+     * for every topic that is dispatched to the pattern.
+     *
      * @tparam ClassT, the class of the object that contains the callback.
      * @tparam RetT, the return type of the callback function.
      * @tparam Args, variadic template parameters passed to the callback function.
@@ -129,36 +134,105 @@ public:
      * @param object Pointer to the instance of the object on which the callback method will be called.
      * @param callback Member function pointer to the callback method that will be invoked to process
      *        the message.
+     * @return True if the callback was registered, false if the subscriber is working.
      */
     template<typename CallbackType, typename ClassT, typename RetT = void, typename... Args>
-    void registerCbAndReqProcFunc(const TopicType& topic, ClassT* object, RetT(ClassT::*callback)(Args...))
+    bool registerCbAndReqProcFunc(const TopicType& topic, ClassT* object, RetT(ClassT::*callback)(Args...))
     {
+        // Process function lambda. The callback is identified by the registered topic (it can be a pattern).
+        auto lambdaProcFunc = [this, clbk_id = std::hash<TopicType>{}(topic)](const PublishedMessage& msg)
+        {
+            this->processClbkRequest<CallbackType, RetT, Args...>(msg, clbk_id);
+        };
+
+        // Automatic command process function registration.
+        if (!this->registerRequestProcFunc(topic, lambdaProcFunc))
+            return false;
+
         // Register the callback.
         this->registerCallback(topic, object, callback);
+        return true;
+    }
 
-        // Process function lambda.
-        auto lambdaProcFunc = [this](const PublishedMessage& msg)
+    /**
+     * @brief Registers a callback for a typed topic (see Topic).
+     *
+     * The callback is bound in compile time, so the process function deserializes the payload and calls the
+     * member function directly, without the type-erased callback storage (and its lookup and cast) used by
+     * `registerCbAndReqProcFunc`. The callback signature is checked against the payload type of the topic.
+     *
+     * @code
+     * subscriber.registerTypedCallback<AmelasPosTopic, &PosProcessor::processPos>(&processor);
+     * @endcode
+     *
+     * @tparam TopicT The typed topic descriptor.
+     * @tparam Callback Member function pointer that will be called with a `const TopicT::PayloadType&`.
+     * @tparam ClassT The class type on which the member function callback is defined.
+     * @param object Pointer to the instance of the object on which the callback method will be called.
+     * @return True if the callback was registered, false if the subscriber is working.
+     */
+    template<typename TopicT, auto Callback, typename ClassT>
+    bool registerTypedCallback(ClassT* object)
+    {
+        using PayloadType = typename TopicT::PayloadType;
+        static_assert(kIsTopic<TopicT>, "The TopicT parameter must be a Topic descriptor.");
+        static_assert(std::is_default_constructible_v<PayloadType>, "The payload type must be default constructible.");
+        static_assert(std::is_invocable_v<decltype(Callback), ClassT*, const PayloadType&>,
+                      "The callback must accept the payload type of the topic.");
+
+        // Process function lambda. The callback is called directly.
+        auto lambdaProcFunc = [this, object](const PublishedMessage& msg)
         {
-            this->processClbkRequest<CallbackType, RetT, Args...>(msg);
+            // If there are no parameters, but they are required, execute error callback
+            if (0 == msg.data.size)
+            {
+                this->invokeErrorCallback(msg, OperationResult::EMPTY_PARAMS);
+                return;
+            }
+
+            // Deserialize the payload.
+            PayloadType payload;
+            try
+            {
+                zmqutils::serializer::BinarySerializer::fastDeserialization(msg.data.bytes.get(), msg.data.size,
+                                                                            payload);
+            }
+            catch(...)
+            {
+                this->invokeErrorCallback(msg, OperationResult::BAD_PARAMETERS);
+                return;
+            }
+
+            // Invoke the callback.
+            try
+            {
+                std::invoke(Callback, object, static_cast<const PayloadType&>(payload));
+            }
+            catch(...)
+            {
+                this->invokeErrorCallback(msg, OperationResult::INVALID_EXT_CALLBACK);
+            }
         };
 
-        // Automatic command process function registration.
-        this->registerRequestProcFunc(topic, lambdaProcFunc);
+        // Automatic process function registration.
+        return this->registerRequestProcFunc(TopicType(TopicT::kName), lambdaProcFunc);
     }
 
     template<typename T, typename ClassT, typename RetT = void>
-    void registerDeserializedCallback(const TopicType& topic, ClassT* object,
+    bool registerDeserializedCallback(const TopicType& topic, ClassT* object,
                                       RetT(ClassT::*callback)(const PublishedMessageDeserialized<T>&))
     {
         using CallbackType = std::function<RetT(const PublishedMessageDeserialized<T>&)>;
 
-        this->registerCallback(topic, object, callback);
-
         // Register a processing function to deserialize and invoke the callback
-        auto lambdaProcFunc = [this](const PublishedMessage& msg) {
-            this->processClbkRequest<CallbackType, RetT, const PublishedMessageDeserialized<T>&>(msg);
+        auto lambdaProcFunc = [this, clbk_id = std::hash<TopicType>{}(topic)](const PublishedMessage& msg) {
+            this->processClbkRequest<CallbackType, RetT, const PublishedMessageDeserialized<T>&>(msg, clbk_id);
         };
-        this->registerRequestProcFunc(topic, lambdaProcFunc);
+        if (!this->registerRequestProcFunc(topic, lambdaProcFunc))
+            return false;
+
+        this->registerCallback(topic, object, callback);
+        return true;
     }
 
 
@@ -166,6 +240,8 @@ public:
     /**
      * @brief Remove the registered callback for a specific topic.
      * @param topic, the topic whose callback will be erased.
+     * @warning A message that is being processed can still call the removed callback after this function returns
+     *          (see `CallbackHandler`). Stop the subscriber before destroying the object of the callback.
      */
     void removeCallback(const TopicType &topic);
 
@@ -208,19 +284,17 @@ protected:
      * @tparam RetT The return type of the callback function.
      * @tparam Args Variadic template parameters passed to the callback function.
      * @param msg, the received message.
+     * @param clbk_id, the identifier of the callback (obtained from the registered topic or topic pattern).
      * @param res, the subscriber result associated with callback invocation
      * @param args, the args passed to the callback.
      * @return the result of the callback inovocation or nothing, if callback was not invoked or has void return.
      */
     template <typename CallbackType, typename RetT = void,  typename... Args>
     std::conditional_t<std::is_void_v<RetT>, void, std::optional<RetT>>
-    invokeCallback(const PublishedMessage& msg, OperationResult& res, Args&&... args)
+    invokeCallback(const PublishedMessage& msg, CallbackId clbk_id, OperationResult& res, Args&&... args)
     {
-        // Get the topic.
-        TopicType topic = msg.topic;
-
         // Check the callback.
-        if(!this->hasCallback(topic))
+        if(!CallbackHandler::hasCallback(clbk_id))
         {
             // If there is no callback, try to execute error callback.
             res = OperationResult::EMPTY_EXT_CALLBACK;
@@ -234,14 +308,14 @@ protected:
             if constexpr (std::is_void_v<RetT>)
             {
                 CallbackHandler::invokeCallback<CallbackType, RetT>(
-                    std::hash<TopicType>{}(topic), std::forward<Args>(args)...);
+                    clbk_id, std::forward<Args>(args)...);
                 return;
             }
 
             else
             {
                 return CallbackHandler::invokeCallback<CallbackType, RetT>(
-                    std::hash<TopicType>{}(topic), std::forward<Args>(args)...);
+                    clbk_id, std::forward<Args>(args)...);
             }
         }
         catch(...)
@@ -265,9 +339,10 @@ protected:
      * @tparam RetT The return type of the callback function.
      * @tparam Args Variadic template parameters passed to the callback function.
      * @param msg A reference to the PublishedMessage object containing the received message.
+     * @param clbk_id The identifier of the callback that will be invoked.
      */
     template<typename CallbackType, typename RetT, typename ...Args>
-    void processClbkRequest(const PublishedMessage& msg)
+    void processClbkRequest(const PublishedMessage& msg, CallbackId clbk_id)
     {
 
         OperationResult res;
@@ -298,16 +373,16 @@ protected:
             }
 
             // Invoke the callback with unpacked parameters
-            std::apply([this, &msg, &res](auto&&... args)
+            std::apply([this, &msg, clbk_id, &res](auto&&... args)
             {
-                this->invokeCallback<CallbackType, RetT>(msg, res, std::forward<decltype(args)>(args)...);
+                this->invokeCallback<CallbackType, RetT>(msg, clbk_id, res, std::forward<decltype(args)>(args)...);
             }, args);
 
         }
         else
         {
             // Invoke the callback that do not require input parameters
-            this->invokeCallback<CallbackType, RetT>(msg, res);
+            this->invokeCallback<CallbackType, RetT>(msg, clbk_id, res);
         }
     }
 
@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+
+/** ********************************************************************************************************************
+ * @file subscriber.h
+ * @brief This file contains the Subscriber template, an adapter with a compile-time hook mask for the subscriber bases.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <chrono>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/PublisherSubscriber/subscriber/subscriber_base.h"
+#include "LibZMQUtils/PublisherSubscriber/subscriber/clbk_subscriber_base.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+/**
+ * @brief Compile-time configuration of a Subscriber.
+ * @tparam DispatchWorkers Initial value for `setDispatchWorkers`. With one or more workers the callbacks are executed
+ *                         concurrently for different topics, so the subclass must be thread-safe.
+ * @tparam LatencyStats Enables the end-to-end latency statistics (see `setLatencyStatsEnabled`).
+ * @tparam LatencyStatsPeriodMs Period of the `onLatencyStats` callback in milliseconds (0 disables the callback).
+ */
+template <unsigned DispatchWorkers = 0, bool LatencyStats = false, unsigned LatencyStatsPeriodMs = 0>
+struct SubscriberPolicies
+{
+    static constexpr unsigned kDispatchWorkers = DispatchWorkers;          ///< Number of dispatch workers.
+    static constexpr bool kLatencyStats = LatencyStats;                    ///< Enable the latency statistics.
+    static constexpr unsigned kLatencyStatsPeriodMs = LatencyStatsPeriodMs; ///< Latency statistics callback period.
+};
+
+/**
+ * @brief The Subscriber template is an adapter over SubscriberBase or ClbkSubscriberBase that builds the hook mask
+ *        of the subscriber at compile time.
+ *
+ * The adapter implements every pure internal callback of the base subscriber, so the subclass only defines the
+ * callbacks that it needs, with the same signatures as in SubscriberBase. The per message callbacks that neither the
+ * subclass nor the base define are detected at compile time and disabled in the hook mask (see
+ * `SubscriberBase::setEnabledHooks`), so the subscriber skips them with a bit test instead of doing a virtual call to
+ * an empty function. The callbacks that are defined are still called virtually.
+ *
+ * @code
+ * class MySubscriber : public Subscriber<MySubscriber, SubscriberPolicies<2>, ClbkSubscriberBase>
+ * {
+ * public:
+ *     using Subscriber::Subscriber;
+ * private:
+ *     void onMessagesLost(const utils::UUID&, const TopicType&, std::uint64_t) final;
+ * };
+ * @endcode
+ *
+ * @tparam Derived The subclass, used only to detect the callbacks that it defines.
+ * @tparam Policies The compile-time configuration (see SubscriberPolicies).
+ * @tparam Base The base subscriber, SubscriberBase or ClbkSubscriberBase.
+ *
+ * @note The subclass callbacks can be public, protected or private. A callback that the adapter can't access is
+ *       considered defined, since the base and adapter ones are accessible.
+ *
+ * @warning Only the callbacks defined in `Derived` (or in the base) are detected. A per message callback overridden
+ *          in a class derived from `Derived` stays disabled, unless it is enabled with `setEnabledHooks`.
+ */
+template <typename Derived, typename Policies = SubscriberPolicies<>, typename Base = SubscriberBase>
+class Subscriber : public Base
+{
+    static_assert(std::is_same_v<Base, SubscriberBase> || std::is_same_v<Base, ClbkSubscriberBase>,
+                  "The base of a Subscriber must be SubscriberBase or ClbkSubscriberBase.");
+
+public:
+
+    /**
+     * @brief Constructs the base subscriber with the given arguments and applies the policies.
+     * @param args The arguments for the constructor of the base subscriber.
+     */
+    template <typename... Args>
+    explicit Subscriber(Args&&... args) :
+        Base(std::forward<Args>(args)...)
+    {
+        this->setEnabledHooks(Subscriber::detectHooks());
+        this->setDispatchWorkers(Policies::kDispatchWorkers);
+        this->setLatencyStatsEnabled(Policies::kLatencyStats,
+                                     std::chrono::milliseconds(Policies::kLatencyStatsPeriodMs));
+    }
+
+protected:
+
+    // Default callbacks (hidden by the subclass callbacks).
+    void onSubscriberStart() override {}
+    void onSubscriberStop() override {}
+    void onSubscriberError(const zmq::error_t&, const std::string& = "") override {}
+    void onInvalidMsgReceived(const PublishedMessage& msg, OperationResult res) override
+    {
+        // The callback subscriber calls the error callback.
+        if constexpr (kClbkBase)
+            Base::onInvalidMsgReceived(msg, res);
+    }
+
+private:
+
+    static constexpr bool kClbkBase = std::is_same_v<Base, ClbkSubscriberBase>;  ///< The base has callbacks.
+
+    // Pointers to the per message callbacks, named through a class.
+    template <typename T> using MsgReceivedPtr = decltype(&T::onMsgReceived);
+    template <typename T> using InvalidMsgReceivedPtr = decltype(&T::onInvalidMsgReceived);
+    template <typename T> using MessagesLostPtr = decltype(&T::onMessagesLost);
+
+    // Check if a callback is not the default one. If the adapter can't access it, the subclass declares it.
+    template <template <typename> class HookPtr, typename DefaultPtr, typename = void>
+    struct IsDefinedHook : std::true_type {};
+
+    template <template <typename> class HookPtr, typename DefaultPtr>
+    struct IsDefinedHook<HookPtr, DefaultPtr, std::void_t<HookPtr<Derived>>> :
+        std::bool_constant<!std::is_same_v<HookPtr<Derived>, DefaultPtr>> {};
+
+    // Get the per message callbacks that are defined in the subclass or in the base.
+    static constexpr std::uint32_t detectHooks()
+    {
+        using Hook = typename Base::SubscriberHook;
+        using DefaultMsgReceivedPtr = void (SubscriberBase::*)(const PublishedMessage&, OperationResult);
+        using DefaultMessagesLostPtr = void (SubscriberBase::*)(const utils::UUID&, const TopicType&, std::uint64_t);
+        std::uint32_t hooks = 0;
+        if (IsDefinedHook<MsgReceivedPtr, DefaultMsgReceivedPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::MSG_RECEIVED);
+        if (kClbkBase || IsDefinedHook<InvalidMsgReceivedPtr, InvalidMsgReceivedPtr<Subscriber>>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::INVALID_MSG_RECEIVED);
+        if (IsDefinedHook<MessagesLostPtr, DefaultMessagesLostPtr>::value)
+            hooks |= static_cast<std::uint32_t>(Hook::MESSAGES_LOST);
+        return hooks;
+    }
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -45,18 +45,28 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <atomic>
+#include <deque>
 #include <future>
 #include <string>
 #include <map>
+#include <set>
+#include <memory>
+#include <vector>
 #include <shared_mutex>
+#include <thread>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
 // =====================================================================================================================
 #include "LibZMQUtils/Global/libzmqutils_global.h"
 #include "LibZMQUtils/Global/zmq_context_handler.h"
+#include "LibZMQUtils/Global/zmq_reactor.h"
+#include "LibZMQUtils/Global/zmq_socket_options.h"
 #include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_data.h"
 #include "LibZMQUtils/PublisherSubscriber/data/publisher_subscriber_info.h"
+#include "LibZMQUtils/PublisherSubscriber/subscriber/topic_dispatch_trie.h"
+#include "LibZMQUtils/Utilities/thread_utils.h"
 #include "LibZMQUtils/Utilities/uuid_generator.h"
 // =====================================================================================================================
 
@@ -70,6 +80,7 @@ namespace pubsub{
 // =====================================================================================================================
 constexpr std::string_view kReservedTopicExit = "RESERVED_TOPIC_EXIT";
 constexpr std::string_view kReservedTopicPubinfo = "RESERVED_TOPIC_PUBINFO";
+constexpr int kSubscriberCtrlTimeoutMsec = 5000;  ///< Timeout for the replies of the worker control commands (msec).
 // =====================================================================================================================
 
 /**
@@ -154,7 +165,23 @@ public:
 
     /**
      * @brief Subscribe to a publisher defined by its endpoint.
+     *
+     * If the subscriber is working, the change is applied incrementally to the running socket (no reconnection of
+     * the rest of publishers). The same applies to the unsubscribe and topic filter functions. These functions can
+     * also be called from the process functions and the internal callbacks of the subscriber.
+     *
+     * The UDP endpoints (for example "udp://239.192.0.1:9999" or "udp://127.0.0.1:9999") are used for receiving the
+     * messages of publishers with the UDP RADIO transport (see PublisherBase::setUdpTransport). In this case, each
+     * topic filter is joined as a RADIO/DISH group truncated to `kMaxGroupLength` characters (the publishers truncate
+     * the topics in the same way), and the prefix of the received topics is checked again locally. So a filter
+     * shorter than the limit only receives its exact topic, a longer filter is a coarser group filter (the topics
+     * that share the truncated group are received and then discarded locally), and the empty filter can't be used
+     * for receiving every topic.
+     *
      * @param pub_endpoint, the endpoint URL of the publisher to subscribe.
+     *
+     * @throw std::invalid_argument If the endpoint is empty, or if it is a UDP endpoint and the ZMQ draft API is not
+     *        available in this build.
      */
     void subscribe(const std::string &pub_endpoint);
 
@@ -183,6 +210,228 @@ public:
      */
     void cleanTopicFilters();
 
+    /**
+     * @brief Sets the number of dispatch worker threads used for processing the received messages.
+     *
+     * By default (0 workers) each message is processed in the same thread that receives it from the socket, so a slow
+     * process function delays the reception of every other topic. With one or more workers, the receiving thread only
+     * decodes the frames and hands the message to a worker selected by the hash of its topic. Messages of the same
+     * topic are always processed by the same worker, so the order per topic is preserved.
+     *
+     * @param workers The number of dispatch workers. A value of 0 disables the dispatch stage.
+     *
+     * @note This value will only be modified if the subscriber is stopped.
+     *
+     * @warning When the dispatch stage is enabled, the `onMsgReceived` and `onInvalidMsgReceived` callbacks, as well
+     *          as the process functions, are executed in the dispatch workers. Different topics can be processed
+     *          concurrently, so the user code must be thread-safe.
+     */
+    void setDispatchWorkers(unsigned workers);
+
+    /**
+     * @brief Get the number of dispatch worker threads.
+     * @return The number of dispatch workers. A value of 0 means that the dispatch stage is disabled.
+     */
+    unsigned getDispatchWorkers() const;
+
+    /**
+     * @brief Sets the policy of the dispatch queues, used for containing slow consumers.
+     *
+     * With the default policy (UNBOUNDED) the dispatch queues grow while the process functions can't keep up. With a
+     * bounded policy, each dispatch queue keeps at most `max_depth` pending messages, dropping the oldest one when it
+     * is full (DROP_OLDEST), or keeping only the newest pending message of each topic (CONFLATE). The dropped messages
+     * are counted in the dispatch statistics. In every case, the receiving thread never waits for the process
+     * functions, so the socket is always drained and the slow consumer doesn't push the loss back to the publisher.
+     *
+     * @param policy The dispatch queue policy.
+     * @param max_depth The maximum depth of each dispatch queue (0 means no limit, only valid for CONFLATE).
+     *
+     * @note This value will only be modified if the subscriber is stopped. It only has effect if the dispatch stage
+     *       is enabled (see `setDispatchWorkers`). Otherwise, the only queue is the ZMQ reception queue (see
+     *       `setReceiveHWM`).
+     */
+    void setDispatchQueuePolicy(DispatchQueuePolicy policy, std::size_t max_depth = 0);
+
+    /**
+     * @brief Get the policy of the dispatch queues.
+     * @return The dispatch queue policy.
+     */
+    DispatchQueuePolicy getDispatchQueuePolicy() const;
+
+    /**
+     * @brief Get the maximum depth of each dispatch queue.
+     * @return The maximum depth (0 means no limit).
+     */
+    std::size_t getDispatchQueueMaxDepth() const;
+
+    /**
+     * @brief Sets the ZMQ reception high water mark (ZMQ_RCVHWM) of the subscriber sockets.
+     *
+     * When a ZMQ reception queue is full, the new messages of that publisher are dropped by ZMQ. The publisher is
+     * never blocked by the subscribers.
+     *
+     * @param hwm The maximum number of messages queued by ZMQ (0 means no limit). A negative value keeps the ZMQ
+     *            default (1000 messages).
+     *
+     * @note This value will only be modified if the subscriber is stopped.
+     */
+    void setReceiveHWM(int hwm);
+
+    /**
+     * @brief Get the ZMQ reception high water mark.
+     * @return The reception high water mark, or a negative value for the ZMQ default.
+     */
+    int getReceiveHWM() const;
+
+    /**
+     * @brief Sets the tuning options (buffers, TCP keepalive, TOS...) of the subscriber sockets. See SocketOptions for
+     *        the available presets.
+     * @param options The socket options. The reception high water mark configured with setReceiveHWM has priority.
+     * @note This value will only be modified if the subscriber is stopped.
+     */
+    void setSocketOptions(const SocketOptions& options);
+
+    /**
+     * @brief Get the tuning options of the subscriber sockets.
+     * @return The socket options.
+     */
+    SocketOptions getSocketOptions() const;
+
+    /**
+     * @brief Get the options read back from the subscriber socket when it was created (including the reception high
+     *        water mark configured with setReceiveHWM).
+     * @return The applied socket options, or the default (negative) values if the socket was never created.
+     */
+    SocketOptions getAppliedSocketOptions() const;
+
+    /**
+     * @brief Sets the shared reactor used for polling the subscriber sockets, instead of a dedicated worker thread.
+     *
+     * With a reactor, the sockets of the subscriber are created and polled in the reactor loop, together with the
+     * sockets of every other component attached to it. The received messages are processed by the dispatch workers
+     * if they are enabled (see `setDispatchWorkers`). Otherwise, if the reactor has executor threads, they are
+     * processed in the executor pool, one at a time and in order for this subscriber, so the user callbacks never
+     * block the loop. Without executors, they are processed directly in the loop thread.
+     *
+     * @param reactor The shared reactor, or nullptr for using a dedicated worker thread (the default).
+     *
+     * @note This value will only be modified if the subscriber is stopped. The reactor must be running when the
+     *       subscriber is started (otherwise the start fails and `onSubscriberError` is called), and the subscriber
+     *       should be stopped before the reactor.
+     *
+     * @warning When processing the messages in the executor pool, the subscriber can't be stopped from its own
+     *          callbacks.
+     */
+    void setReactor(std::shared_ptr<ZMQReactor> reactor);
+
+    /**
+     * @brief Get the shared reactor used for polling the subscriber sockets.
+     * @return The shared reactor, or nullptr if the subscriber uses a dedicated worker thread.
+     */
+    std::shared_ptr<ZMQReactor> getReactor() const;
+
+    /**
+     * @brief Sets the configuration (name, CPU affinity and scheduling) of the subscriber worker threads.
+     *
+     * The configuration is applied to the subscriber worker and to the dispatch workers (their names get the suffix
+     * "/<index>"). By default, the threads are only named "zmq-sub".
+     *
+     * @param config The thread configuration.
+     *
+     * @note This value will only be modified if the subscriber is stopped. When using a reactor, the configuration
+     *       is applied only to the dispatch workers (the reactor threads have their own configuration).
+     */
+    void setWorkerThreadConfig(const utils::ThreadConfig& config);
+
+    /**
+     * @brief Get the configuration of the subscriber worker threads.
+     * @return The thread configuration.
+     */
+    utils::ThreadConfig getWorkerThreadConfig() const;
+
+    /**
+     * @brief Get the CPU time consumed by the subscriber worker thread (the last one, if the subscriber is stopped).
+     *        The CPU time of the dispatch workers is available in the dispatch statistics.
+     * @return The CPU time of the worker thread.
+     */
+    std::chrono::nanoseconds getWorkerCpuTime() const;
+
+    /**
+     * @brief Get a snapshot of the dispatch stage statistics.
+     *
+     * The snapshot contains the current and maximum queue depth of each dispatch worker, the number of messages
+     * dropped by the dispatch queue policy, the age of the oldest pending message (how far behind each worker is) and
+     * the callback latency statistics of each processed topic. The statistics are only collected when the dispatch
+     * stage is enabled, and they remain available after stopping the subscriber until it is started again.
+     *
+     * @return A SubscriberDispatchStats struct with the dispatch statistics.
+     */
+    SubscriberDispatchStats getDispatchStats() const;
+
+    /**
+     * @brief Get a snapshot of the sequence tracking statistics of each publisher.
+     *
+     * The sequence of each publisher is only tracked when the subscriber receives every topic (empty topic filter),
+     * since otherwise the filtered messages would be seen as lost. The per topic sequences (if the publisher enables
+     * them) are always tracked. The statistics are kept until `resetSequenceStats` is called.
+     *
+     * @return A map with the sequence statistics of each publisher, using the publisher UUID as key.
+     */
+    std::map<utils::UUID, PublisherSequenceStats> getSequenceStats() const;
+
+    /**
+     * @brief Clears the sequence tracking statistics.
+     */
+    void resetSequenceStats();
+
+    /**
+     * @brief Enables or disables the end-to-end latency statistics.
+     *
+     * When enabled, the subscriber uses the binary time stamps of each message to update the per topic latency
+     * histograms (see TopicLatencyStats). The statistics are cleared each time the subscriber is started.
+     *
+     * @param enabled True for enabling the latency statistics, false otherwise.
+     * @param period Period for calling the `onLatencyStats` callback. A zero period disables the periodic callback.
+     *
+     * @note This value will only be modified if the subscriber is stopped.
+     */
+    void setLatencyStatsEnabled(bool enabled, std::chrono::milliseconds period = std::chrono::milliseconds(0));
+
+    /**
+     * @brief Get a snapshot of the end-to-end latency statistics of each topic.
+     *
+     * Each thread that processes messages (subscriber worker or dispatch worker) keeps its own histograms, so the
+     * reception path is not serialized. This function merges them.
+     *
+     * @return A map with the latency statistics of each topic.
+     */
+    std::map<TopicType, TopicLatencyStats> getLatencyStats() const;
+
+    /**
+     * @brief Injects a message as if it had been received from a publisher (for example, a message replayed from a
+     *        publication journal, see PublicationJournalReader).
+     *
+     * The message is processed by the internal callbacks and the registered process functions. If the subscriber is
+     * working with dispatch workers, it is handed to them. Otherwise, it is processed in the calling thread. The topic
+     * filters and the sequence tracking are not applied, and the messages without reception time are not accounted
+     * in the latency statistics.
+     *
+     * @param msg The message to inject.
+     */
+    void injectMsg(PublishedMessage&& msg);
+
+    /**
+     * @brief Decodes the frames of a published message (topic, publisher uuid, timestamp, header and optional data).
+     *
+     * @param frames The message frames. They are consumed.
+     * @param msg The decoded message. If the topic frame is an interned topic identifier, the topic is left empty.
+     * @param is_topic_id Set to true if the topic frame is an interned topic identifier.
+     * @param topic_id The interned topic identifier (only if `is_topic_id` is true).
+     * @return The result of the decoding.
+     */
+    static OperationResult decodeMessage(zmq::multipart_t& frames, PublishedMessage& msg, bool& is_topic_id,
+                                         TopicId& topic_id);
+
     static std::string operationResultToString(OperationResult result);
 
     static std::string operationResultToString(ResultType result);
@@ -196,41 +445,85 @@ public:
 
 protected:
 
+    /**
+     * @brief Check if the subscriber context is in use (the subscriber is working).
+     * @return True if the subscriber is working.
+     */
+    bool isContextInUse() const override;
+
     // -----------------------------------------------------------------------------------------------------------------
     using ProcessFunction = std::function<void(const PublishedMessage&)>;        ///< Process function alias.
-    using ProcessFunctionsMap = std::unordered_map<TopicType, ProcessFunction>;  ///< Process function map alias.
+    using ProcessFunctionsMap = TopicDispatchTrie<ProcessFunction>;             ///< Process function trie alias.
     // -----------------------------------------------------------------------------------------------------------------
 
+    /**
+     * @brief Bit flags of the internal callbacks that are called for each received message.
+     *
+     * A subclass that doesn't implement some of these callbacks can disable them with `setEnabledHooks`, so the
+     * subscriber skips them instead of doing a virtual call to an empty function (see the `Subscriber` template).
+     */
+    enum class SubscriberHook : std::uint32_t
+    {
+        MSG_RECEIVED         = 1u << 0,  ///< The `onMsgReceived` callback.
+        INVALID_MSG_RECEIVED = 1u << 1,  ///< The `onInvalidMsgReceived` callback.
+        MESSAGES_LOST        = 1u << 2,  ///< The `onMessagesLost` callback.
+        ALL_HOOKS            = 0x07u     ///< All the previous callbacks.
+    };
+
+    /**
+     * @brief Set the internal callbacks that are called for each received message (all of them by default).
+     * @param hooks Bitwise OR of the enabled `SubscriberHook` flags.
+     * @note This value will only be modified if the subscriber is stopped.
+     */
+    void setEnabledHooks(std::uint32_t hooks);
+
     /**
      * @brief Register a function to process a PublishedMessage object.
      *
+     * The topic can be a pattern with wildcards (see TopicDispatchTrie), for example "amelas/mount/#" for
+     * processing every topic under "amelas/mount".
+     *
      * @tparam ClassT The class type of the object that contains the member function to be called.
      *
-     * @param topic The topic that the function will process replies for.
+     * @param topic The topic (or topic pattern) that the function will process replies for.
      * @param obj A pointer to the object that contains the member function to be called.
      * @param func The member function to call when the msg is received.
+     * @return True if the function was registered, false if the subscriber is working.
      *
      */
     template <typename ClassT>
-    void registerRequestProcFunc(const TopicType &topic, ClassT* obj,
+    bool registerRequestProcFunc(const TopicType &topic, ClassT* obj,
                                  void(ClassT::*func)(const PublishedMessage&))
     {
-        this->process_fnc_map_[topic] = [obj, func](const PublishedMessage& msg)
+        return this->registerRequestProcFunc(topic, [obj, func](const PublishedMessage& msg)
         {
             return (obj->*func)(msg);
-        };
+        });
     }
 
     /**
      * @brief Register a function to process a `PubSubMsg` object.
      *
-     * @param topic The topic that the function will process replies for.
+     * The resolved functions are cached by the worker and the queued messages as pointers to the trie nodes, so the
+     * functions can only be registered while the subscriber is stopped.
+     *
+     * @param topic The topic (or topic pattern) that the function will process replies for.
      * @param func The member function to call when the msg is received.
+     * @return True if the function was registered, false if the subscriber is working.
      *
      */
-    void registerRequestProcFunc(const TopicType &topic, std::function<void(const PublishedMessage&)> func)
+    bool registerRequestProcFunc(const TopicType &topic, std::function<void(const PublishedMessage&)> func)
     {
-        this->process_fnc_map_[topic] = func;
+        // Safe mutex lock
+        std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+        // An insertion can move the trie nodes, so only register while no message is routed.
+        if (this->flag_working_)
+            return false;
+
+        this->process_fnc_map_.insert(topic, std::move(func));
+        this->process_fnc_gen_++;
+        return true;
     }
 
     /**
@@ -281,6 +574,32 @@ protected:
      */
     virtual void onMsgReceived(const PublishedMessage&, OperationResult res);
 
+    /**
+     * @brief Base messages lost callback. Subclasses may override this function.
+     *
+     * This callback is called when a gap is detected in the sequence numbers of a publisher (or of a topic).
+     *
+     * @param publisher_uuid The UUID of the publisher that sent the lost messages.
+     * @param topic The topic of the gap, or an empty topic if the gap is in the publisher sequence.
+     * @param lost The number of lost messages.
+     *
+     * @warning The overrided callback must be non-blocking and have minimal computation time. It is executed in the
+     *          thread that receives the messages from the socket.
+     */
+    virtual void onMessagesLost(const utils::UUID& publisher_uuid, const TopicType& topic, std::uint64_t lost);
+
+    /**
+     * @brief Base periodic latency statistics callback. Subclasses may override this function.
+     *
+     * This callback is called periodically (see `setLatencyStatsEnabled`) with a snapshot of the latency statistics.
+     *
+     * @param stats The latency statistics of each topic.
+     *
+     * @warning The overrided callback must be non-blocking and have minimal computation time. It is executed in the
+     *          thread that receives the messages from the socket.
+     */
+    virtual void onLatencyStats(const std::map<TopicType, TopicLatencyStats>& stats);
+
     /**
      * @brief Base subscriber error callback. Subclasses must override this function.
      *
@@ -304,24 +623,127 @@ protected:
 
 private:
 
+    // Forward declarations of the control commands and the dispatch worker data.
+    enum class ControlCommand : std::uint8_t;
+    struct DispatchShard;
+
     // Internal helper for stopping the subscriber.
     void internalStopSubscriber();
 
+    // Check if an internal callback is enabled (only changes while the subscriber is stopped, so no lock is needed).
+    bool isHookEnabled(SubscriberHook hook) const
+    {
+        return (this->enabled_hooks_ & static_cast<std::uint32_t>(hook)) != 0;
+    }
+
+    // Route of a received message, resolved once for each topic identifier instead of for each message. The function
+    // pointer stays valid while the subscriber works, because the process functions can't be registered meanwhile.
+    struct MsgRoute
+    {
+        const ProcessFunction* func = nullptr;  ///< Process function of the topic (only if resolved).
+        std::size_t topic_hash = 0;             ///< Hash of the topic, which selects the dispatch worker.
+        bool resolved = false;                  ///< True if the route was resolved using a topic identifier.
+    };
+
+    // Message pending in the dispatch workers or in the reactor executors.
+    struct PendingMsg
+    {
+        PublishedMessage msg;    ///< Received message.
+        OperationResult result;  ///< Result of the reception.
+        MsgRoute route;          ///< Route of the message.
+    };
+
+    // Latency statistics of the messages processed by one thread (merged when they are requested).
+    struct LatencySink
+    {
+        std::map<TopicType, TopicLatencyStats> stats;  ///< Latency statistics of each topic.
+        std::mutex mtx;                                ///< Sink mutex (only shared with the statistics merge).
+    };
+
+    // Internal helpers for starting and stopping the dispatch workers.
+    void startDispatchWorkers();
+    void stopDispatchWorkers();
+
+    // Dispatch worker (will be executed asynchronously for each shard).
+    void dispatchWorker(DispatchShard& shard, std::size_t index);
+
+    // Function for handing a received message to the dispatch workers.
+    void dispatchMsg(PublishedMessage&& msg, OperationResult result, const MsgRoute& route);
+
+    // Function for processing a received message (calls the internal callbacks and the process function). The
+    // latency sink 0 is used by the subscriber worker, the reactor executors and the injected messages, and the sink
+    // `i + 1` is used by the dispatch worker `i`.
+    void processMsg(const PublishedMessage& msg, OperationResult result, const MsgRoute& route,
+                    std::size_t latency_sink);
+
     // Subscriber worker (will be executed asynchronously).
     void subscriberWorker();
 
-    // Function for receiving data from the socket.
-    OperationResult recvFromSocket(PublishedMessage&);
+    // Function for receiving and processing the data of a readable socket (only in the worker or the reactor loop).
+    void processSocketData(zmq::socket_t& socket);
+
+    // Internal helpers for registering and unregistering the sockets in the reactor loop (only in the reactor loop).
+    void attachToReactor();
+    void detachFromReactor();
+
+    // Function for handing a received message to the reactor executors, keeping the order of this subscriber.
+    void strandMsg(PublishedMessage&& msg, OperationResult result, const MsgRoute& route);
+
+    // Strand worker (will be executed in the reactor executors while there are pending messages).
+    void strandWorker();
+
+    // Function for receiving data from the socket. The internal messages (topic identifiers announcements or
+    // identifiers discarded by the topic filters) are marked to be discarded. The route is resolved for the topic
+    // identifiers messages.
+    OperationResult recvFromSocket(zmq::socket_t& socket, PublishedMessage&, bool& discard, MsgRoute& route);
+
+    // Function for tracking the sequence numbers of a received message (only in the worker thread).
+    void trackSequences(const PublishedMessage& msg);
+
+    // Function for storing the topic identifiers announced by a publisher (only in the worker thread).
+    void processTopicIdsAnnouncement(const PublishedMessage& msg);
+
+    // Function for applying the topic filters to the known topic identifiers, subscribing the socket to the frames of
+    // the allowed identifiers (only in the worker thread).
+    void updateTopicIdFilters();
 
     // Function for resetting the socket.
     void resetSocket();
 
+    // Internal helper to delete the ZMQ sockets.
+    void deleteSockets();
+
+    // Internal helper to create the ZMQ dish socket (UDP transport) and join the filters groups (only in the worker).
+    void createDishSocket();
+
+    // Internal helper to join or leave the dish group of a topic filter (only in the worker thread).
+    void updateDishGroup(const TopicType& filter, bool join);
+
+    // Check if the caller is the worker thread (or the reactor loop), which owns the sockets.
+    bool isWorkerThread() const;
+
+    // Lock the control requests. The worker thread never waits for this lock, since it applies the changes directly.
+    std::unique_lock<std::mutex> lockCtrlRequests();
+
+    // Function for sending a control command to the worker (and wait for the result). In the worker thread, the
+    // command is applied directly. In other threads, the caller must hold the control requests lock.
+    bool sendCtrlCommand(ControlCommand command, const std::string& arg);
+
+    // Function for receiving and executing a control command in the worker. Returns true for the exit command.
+    bool processCtrlCommand();
+
+    // Function for applying a control command to the subscriber socket (only in the worker thread).
+    bool applyCtrlCommand(ControlCommand command, const std::string& arg);
+
     // -----------------------------------------------------
 
     // ZMQ socket.
     zmq::socket_t* socket_;              ///< ZMQ subscriber socket.
-    zmq::socket_t* socket_pub_close_;    ///< ZMQ close publisher socket.
-    utils::UUID socket_close_uuid_;      ///< UUID for close publisher.
+    zmq::socket_t* dish_socket_;         ///< ZMQ dish socket (UDP transport, created only if necessary).
+    zmq::socket_t* recv_ctrl_socket_;    ///< ZMQ control socket (worker side).
+    zmq::socket_t* req_ctrl_socket_;     ///< ZMQ control socket (requester side).
+    std::atomic<std::thread::id> worker_th_id_;  ///< Identifier of the worker thread, which owns the sockets.
+    std::uint64_t ctrl_req_id_;                  ///< Identifier of the last control request.
 
     // Subscriber info
     SubscriberInfo sub_info_;
@@ -329,6 +751,8 @@ private:
     // Mutex.
     mutable std::shared_mutex sub_mtx_;  ///< Safety mutex.
     mutable std::mutex depl_mtx_;        ///< Worker deploy mutex.
+    mutable std::mutex ctrl_mtx_;        ///< Control mutex (publishers and filters, never held while waiting).
+    mutable std::mutex ctrl_req_mtx_;    ///< Control requests mutex (requester side of the control socket).
 
     // Future and condition variable for the worker.
     std::future<void> fut_worker_;            ///< Future that stores the worker status.
@@ -342,6 +766,56 @@ private:
 
     // Process functions container.
     ProcessFunctionsMap process_fnc_map_;        ///< Container with the internal factory process function.
+    std::uint64_t process_fnc_gen_;              ///< Generation of the process functions (changes on register).
+    std::uint32_t enabled_hooks_;                ///< Enabled internal callbacks (SubscriberHook flags).
+
+    // Interned topic identifiers (only used by the worker thread).
+    struct TopicIdEntry
+    {
+        TopicType name;                         ///< Topic name associated to the identifier (empty if unknown).
+        bool allowed = false;                   ///< True if the topic passes the topic filters.
+        std::size_t topic_hash = 0;             ///< Hash of the topic name.
+        const ProcessFunction* func = nullptr;  ///< Cached process function of the topic.
+        std::uint64_t func_gen = 0;             ///< Generation of the process functions when the cache was resolved.
+    };
+    std::map<utils::UUID, std::vector<TopicIdEntry>> topic_ids_cache_;  ///< Announced identifiers of each publisher.
+    std::set<TopicId> subscribed_topic_ids_;                            ///< Identifier frames subscribed in the socket.
+    std::set<TopicType> worker_filters_;                                ///< Topic filters applied to the socket.
+
+    // Sequence tracking.
+    std::map<utils::UUID, PublisherSequenceStats> seq_stats_;  ///< Sequence statistics of each publisher.
+    mutable std::mutex seq_mtx_;                               ///< Sequence statistics mutex.
+
+    // Latency statistics.
+    std::vector<std::unique_ptr<LatencySink>> latency_sinks_;  ///< Latency statistics of each processing thread.
+    std::chrono::milliseconds latency_stats_period_;           ///< Period of the latency statistics callback.
+    std::atomic_bool flag_latency_stats_;                      ///< Flag for enabling the latency statistics.
+    mutable std::mutex latency_mtx_;                           ///< Latency sinks container mutex.
+
+    // Dispatch workers.
+    std::vector<std::unique_ptr<DispatchShard>> dispatch_shards_;  ///< Dispatch workers, one per topic shard.
+    unsigned dispatch_workers_;                                    ///< Configured number of dispatch workers.
+    DispatchQueuePolicy dispatch_policy_;                          ///< Configured dispatch queues policy.
+    std::size_t dispatch_max_depth_;                               ///< Configured maximum depth of each queue.
+    int rcv_hwm_;                                                  ///< Configured reception high water mark.
+    SocketOptions socket_options_;                                 ///< Tuning options of the subscriber sockets.
+    SocketOptions applied_socket_options_;                         ///< Options read back from the last SUB socket.
+
+    // Reactor integration.
+    std::shared_ptr<ZMQReactor> reactor_;     ///< Shared reactor (if null, the subscriber uses its own worker thread).
+    ZMQReactor::HandlerId data_handler_id_;   ///< Reactor registration of the subscriber socket.
+    ZMQReactor::HandlerId dish_handler_id_;   ///< Reactor registration of the dish socket.
+    ZMQReactor::HandlerId ctrl_handler_id_;   ///< Reactor registration of the control socket.
+    ZMQReactor::HandlerId latency_timer_id_;  ///< Reactor registration of the latency statistics timer.
+    std::promise<void> reactor_promise_;      ///< Promise for the worker future when using the reactor.
+    std::deque<PendingMsg> strand_queue_;     ///< Messages pending in the reactor executors.
+    std::condition_variable strand_cv_;       ///< Condition variable to notify that the strand is idle.
+    std::mutex strand_mtx_;                   ///< Strand mutex.
+    bool strand_scheduled_;                   ///< True while a strand task is pending or running.
+
+    // Worker threads configuration.
+    utils::ThreadConfig thread_config_;       ///< Configuration of the worker threads.
+    utils::ThreadCpuClock worker_cpu_clock_;  ///< CPU time of the subscriber worker thread.
 
     // Useful flags.
     std::atomic_bool flag_working_;       ///< Flag for check the worker active status.
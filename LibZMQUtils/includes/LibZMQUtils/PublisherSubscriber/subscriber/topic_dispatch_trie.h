@@ -0,0 +1,194 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file topic_dispatch_trie.h
+ * @brief This file contains the declaration of the TopicDispatchTrie template class.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+/**
+ * @class TopicDispatchTrie
+ *
+ * @brief Compact trie that maps topic patterns to values (usually process functions or callback identifiers).
+ *
+ * The topics are split in levels using the `/` separator (for example, "amelas/mount/az"). The patterns can be:
+ *   - Exact topics: "amelas/mount/az" only matches "amelas/mount/az".
+ *   - Single-level wildcards: "amelas/+/az" matches "amelas/mount/az" or "amelas/dome/az".
+ *   - Multi-level (prefix) wildcards: "amelas/mount/#" matches "amelas/mount" and every topic under it, like
+ *     "amelas/mount/az" or "amelas/mount/el/speed". The `#` wildcard must be the last level of the pattern. The
+ *     pattern "#" matches everything.
+ *
+ * The wildcards are only recognized when they fill a complete level, otherwise they are ordinary characters. When
+ * several patterns match the same topic, exact levels have priority over single-level wildcards, and single-level
+ * wildcards have priority over the deepest multi-level wildcard.
+ *
+ * The lookup works directly over a `std::string_view` and does not perform any allocation. The nodes are stored in a
+ * contiguous vector and the children of each node are kept sorted, so they are found using a binary search.
+ *
+ * @warning This class is not thread safe. The patterns should be registered before using the lookup concurrently.
+ *
+ * @tparam ValueT, the type of the values associated to the patterns.
+ */
+template <typename ValueT>
+class TopicDispatchTrie
+{
+
+public:
+
+    static constexpr char kLevelSeparator = '/';       ///< Separator between topic levels.
+    static constexpr char kSingleLevelWildcard = '+';  ///< Wildcard that matches exactly one level.
+    static constexpr char kMultiLevelWildcard = '#';   ///< Wildcard that matches the rest of levels.
+
+    /**
+     * @brief TopicDispatchTrie default constructor.
+     */
+    TopicDispatchTrie();
+
+    /**
+     * @brief Inserts (or replaces) the value associated to a topic pattern.
+     * @param pattern, the topic pattern.
+     * @param value, the value associated to the pattern.
+     * @throw std::invalid_argument if the multi-level wildcard is not the last level of the pattern.
+     */
+    void insert(std::string_view pattern, ValueT value);
+
+    /**
+     * @brief Removes the value associated to a topic pattern.
+     * @param pattern, the topic pattern.
+     * @return True if the pattern was registered, false otherwise.
+     */
+    bool erase(std::string_view pattern);
+
+    /**
+     * @brief Looks for the best value for a topic, following the priorities described in the class documentation.
+     * @param topic, the topic of the received message.
+     * @return A pointer to the value, or nullptr if no pattern matches the topic.
+     */
+    const ValueT* find(std::string_view topic) const;
+
+    /**
+     * @brief Looks for the value registered for exactly this pattern (wildcards are not expanded).
+     * @param pattern, the topic pattern.
+     * @return A pointer to the value, or nullptr if the pattern is not registered.
+     */
+    const ValueT* findPattern(std::string_view pattern) const;
+
+    /**
+     * @brief Checks if the pattern is registered.
+     * @param pattern, the topic pattern.
+     * @return True if the pattern is registered, false otherwise.
+     */
+    bool contains(std::string_view pattern) const;
+
+    /**
+     * @brief Get the number of registered patterns.
+     * @return The number of registered patterns.
+     */
+    std::size_t size() const;
+
+    /**
+     * @brief Check if there is no registered pattern.
+     * @return True if the trie is empty, false otherwise.
+     */
+    bool empty() const;
+
+    /**
+     * @brief Removes all the registered patterns.
+     */
+    void clear();
+
+private:
+
+    // Alias and constants.
+    using NodeIndex = std::uint32_t;
+    static constexpr NodeIndex kNoNode = std::numeric_limits<NodeIndex>::max();
+
+    // Node of the trie. Each node represents a topic level.
+    struct Node
+    {
+        std::vector<std::pair<std::string, NodeIndex>> children;  ///< Literal children, sorted by level name.
+        NodeIndex single_wildcard;                                ///< Child for the single-level wildcard.
+        std::optional<ValueT> value;                              ///< Value for topics ending in this node.
+        std::optional<ValueT> multi_value;                        ///< Value for the multi-level wildcard.
+
+        Node() : single_wildcard(kNoNode) {}
+    };
+
+    // Helper for getting the next level of a topic. Updates the position (npos at the end).
+    static std::string_view nextLevel(std::string_view topic, std::size_t& pos);
+
+    // Helper for finding a literal child. Returns kNoNode if it does not exist.
+    NodeIndex findChild(NodeIndex node, std::string_view level) const;
+
+    // Helper for finding the value slot of a pattern. Returns nullptr if the pattern path does not exist.
+    const std::optional<ValueT>* findSlot(std::string_view pattern) const;
+
+    // Recursive matching (with backtracking for wildcards).
+    const ValueT* match(NodeIndex node, std::string_view topic, std::size_t pos) const;
+
+    // Members.
+    std::vector<Node> nodes_;   ///< Trie nodes. The first one is the root.
+    std::size_t size_;          ///< Number of registered patterns.
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
+
+// TEMPLATES INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/PublisherSubscriber/subscriber/topic_dispatch_trie.tpp"
+// =====================================================================================================================
@@ -0,0 +1,253 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file topic_dispatch_trie.tpp
+ * @brief This file contains the template implementation of the TopicDispatchTrie class.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <algorithm>
+#include <stdexcept>
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+template <typename ValueT>
+TopicDispatchTrie<ValueT>::TopicDispatchTrie() :
+    nodes_(1),
+    size_(0)
+{}
+
+template <typename ValueT>
+void TopicDispatchTrie<ValueT>::insert(std::string_view pattern, ValueT value)
+{
+    NodeIndex node = 0;
+    std::size_t pos = 0;
+
+    while (pos != std::string_view::npos)
+    {
+        std::string_view level = nextLevel(pattern, pos);
+
+        // Multi-level wildcard case. It must be the last level.
+        if (level.size() == 1 && level.front() == kMultiLevelWildcard)
+        {
+            if (pos != std::string_view::npos)
+                throw std::invalid_argument("[LibZMQUtils,PublisherSubscriber,TopicDispatchTrie] "
+                                            "The multi-level wildcard must be the last level of the pattern.");
+
+            if (!this->nodes_[node].multi_value)
+                this->size_++;
+            this->nodes_[node].multi_value = std::move(value);
+            return;
+        }
+
+        // Single-level wildcard case.
+        if (level.size() == 1 && level.front() == kSingleLevelWildcard)
+        {
+            if (this->nodes_[node].single_wildcard == kNoNode)
+            {
+                NodeIndex child = static_cast<NodeIndex>(this->nodes_.size());
+                this->nodes_.emplace_back();
+                this->nodes_[node].single_wildcard = child;
+            }
+            node = this->nodes_[node].single_wildcard;
+            continue;
+        }
+
+        // Literal case (keep the children sorted).
+        auto& children = this->nodes_[node].children;
+        auto it = std::lower_bound(children.begin(), children.end(), level,
+                                   [](const auto& child, std::string_view lvl){return child.first < lvl;});
+        if (it == children.end() || it->first != level)
+        {
+            NodeIndex child = static_cast<NodeIndex>(this->nodes_.size());
+            children.insert(it, {std::string(level), child});
+            this->nodes_.emplace_back();
+            node = child;
+        }
+        else
+            node = it->second;
+    }
+
+    if (!this->nodes_[node].value)
+        this->size_++;
+    this->nodes_[node].value = std::move(value);
+}
+
+template <typename ValueT>
+bool TopicDispatchTrie<ValueT>::erase(std::string_view pattern)
+{
+    // The nodes are not removed, only the values. The structure is reused if the pattern is registered again.
+    auto* slot = const_cast<std::optional<ValueT>*>(this->findSlot(pattern));
+    if (!slot || !slot->has_value())
+        return false;
+
+    slot->reset();
+    this->size_--;
+    return true;
+}
+
+template <typename ValueT>
+const ValueT* TopicDispatchTrie<ValueT>::find(std::string_view topic) const
+{
+    if (0 == this->size_)
+        return nullptr;
+
+    return this->match(0, topic, 0);
+}
+
+template <typename ValueT>
+const ValueT* TopicDispatchTrie<ValueT>::findPattern(std::string_view pattern) const
+{
+    const auto* slot = this->findSlot(pattern);
+    return (slot && slot->has_value()) ? &slot->value() : nullptr;
+}
+
+template <typename ValueT>
+bool TopicDispatchTrie<ValueT>::contains(std::string_view pattern) const
+{
+    return this->findPattern(pattern) != nullptr;
+}
+
+template <typename ValueT>
+std::size_t TopicDispatchTrie<ValueT>::size() const
+{
+    return this->size_;
+}
+
+template <typename ValueT>
+bool TopicDispatchTrie<ValueT>::empty() const
+{
+    return 0 == this->size_;
+}
+
+template <typename ValueT>
+void TopicDispatchTrie<ValueT>::clear()
+{
+    this->nodes_.assign(1, Node());
+    this->size_ = 0;
+}
+
+template <typename ValueT>
+std::string_view TopicDispatchTrie<ValueT>::nextLevel(std::string_view topic, std::size_t& pos)
+{
+    std::size_t sep = topic.find(kLevelSeparator, pos);
+    std::string_view level = topic.substr(pos, sep == std::string_view::npos ? std::string_view::npos : sep - pos);
+    pos = (sep == std::string_view::npos) ? std::string_view::npos : sep + 1;
+    return level;
+}
+
+template <typename ValueT>
+typename TopicDispatchTrie<ValueT>::NodeIndex
+TopicDispatchTrie<ValueT>::findChild(NodeIndex node, std::string_view level) const
+{
+    const auto& children = this->nodes_[node].children;
+    auto it = std::lower_bound(children.begin(), children.end(), level,
+                               [](const auto& child, std::string_view lvl){return child.first < lvl;});
+    return (it != children.end() && it->first == level) ? it->second : kNoNode;
+}
+
+template <typename ValueT>
+const std::optional<ValueT>* TopicDispatchTrie<ValueT>::findSlot(std::string_view pattern) const
+{
+    NodeIndex node = 0;
+    std::size_t pos = 0;
+
+    while (pos != std::string_view::npos)
+    {
+        std::string_view level = nextLevel(pattern, pos);
+
+        if (level.size() == 1 && level.front() == kMultiLevelWildcard && pos == std::string_view::npos)
+            return &this->nodes_[node].multi_value;
+        else if (level.size() == 1 && level.front() == kSingleLevelWildcard)
+            node = this->nodes_[node].single_wildcard;
+        else
+            node = this->findChild(node, level);
+
+        if (node == kNoNode)
+            return nullptr;
+    }
+
+    return &this->nodes_[node].value;
+}
+
+template <typename ValueT>
+const ValueT* TopicDispatchTrie<ValueT>::match(NodeIndex node, std::string_view topic, std::size_t pos) const
+{
+    const Node& current = this->nodes_[node];
+
+    // All the levels were consumed. The multi-level wildcard also matches its parent level.
+    if (pos == std::string_view::npos)
+    {
+        if (current.value)
+            return &current.value.value();
+        return current.multi_value ? &current.multi_value.value() : nullptr;
+    }
+
+    // Get the next level.
+    std::string_view level = nextLevel(topic, pos);
+
+    // Exact level.
+    NodeIndex child = this->findChild(node, level);
+    if (child != kNoNode)
+    {
+        if (const ValueT* result = this->match(child, topic, pos))
+            return result;
+    }
+
+    // Single-level wildcard.
+    if (current.single_wildcard != kNoNode)
+    {
+        if (const ValueT* result = this->match(current.single_wildcard, topic, pos))
+            return result;
+    }
+
+    // Multi-level wildcard.
+    return current.multi_value ? &current.multi_value.value() : nullptr;
+}
+
+}} // END NAMESPACES.
+// =====================================================================================================================
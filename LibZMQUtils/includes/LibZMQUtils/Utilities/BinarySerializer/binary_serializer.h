@@ -53,6 +53,8 @@
 #include <cstddef>
 #include <tuple>
 #include <string>
+#include <array>
+#include <type_traits>
 #if __MINGW64_VERSION_MAJOR > 6
 #include <filesystem>
 #endif
@@ -160,6 +162,54 @@ public:
 
 // ---------------------------------------------------------------------------------------------------------------------
 
+// Compile time serialized size traits. A type has a fixed serialized size when that size does not depend on its value
+// (trivial types, arrays of trivial types and tuples of those), so it can be known before serializing anything.
+
+template<typename T>
+struct trait_is_std_array : std::false_type {};
+
+template<typename T, std::size_t L>
+struct trait_is_std_array<std::array<T, L>> : std::true_type {};
+
+template<typename T, typename = void>
+struct trait_fixed_serialized_size
+{
+    static constexpr bool value = false;
+    static constexpr SizeUnit size = 0;
+};
+
+template<typename T>
+struct trait_fixed_serialized_size<T, std::enable_if_t<std::is_trivial_v<T> && !trait_is_std_array<T>::value &&
+                                                       !std::is_pointer_v<T> && !std::is_same_v<T, std::nullptr_t>>>
+{
+    static constexpr bool value = true;
+    static constexpr SizeUnit size = sizeof(SizeUnit) + sizeof(T);
+};
+
+template<typename T, std::size_t L>
+struct trait_fixed_serialized_size<std::array<T, L>, std::enable_if_t<std::is_trivial_v<T>>>
+{
+    static constexpr bool value = true;
+    static constexpr SizeUnit size = sizeof(SizeUnit) + sizeof(SizeUnit) + sizeof(T) * L;
+};
+
+template<typename... Ts>
+struct trait_fixed_serialized_size<std::tuple<Ts...>>
+{
+    static constexpr bool value = (trait_fixed_serialized_size<std::decay_t<Ts>>::value && ...);
+    static constexpr SizeUnit size = (SizeUnit(0) + ... + trait_fixed_serialized_size<std::decay_t<Ts>>::size);
+};
+
+template<typename... Ts>
+inline constexpr bool has_fixed_serialized_size_v =
+    (trait_fixed_serialized_size<std::decay_t<Ts>>::value && ...);
+
+template<typename... Ts>
+inline constexpr SizeUnit fixed_serialized_size_v =
+    (SizeUnit(0) + ... + trait_fixed_serialized_size<std::decay_t<Ts>>::size);
+
+// ---------------------------------------------------------------------------------------------------------------------
+
 // TODO MOVE TO OTHER FILE
 
 struct LIBZMQUTILS_EXPORT BinarySerializedData
@@ -433,6 +483,9 @@ public:
      * data in the provided unique pointer. It first checks that all input data types are both trivially copyable and
      * trivial, then serializes each data item in order, consolidating the binary data.
      *
+     * The exact serialized size is computed before writing (at compile time when all the types have a fixed
+     * serialized size), so the output buffer is allocated only once and with no spare capacity.
+     *
      * @tparam Args Variadic template argument for types.
      * @param[out] out The unique pointer where the serialized data will be stored. The pointer will be allocated within the function.
      * @param[in] args The input data items to be serialized.
@@ -723,6 +776,10 @@ protected:
     template<typename T, size_t L>
     static SizeUnit serializedSizeSingle(const std::array<T, L>& data);
 
+    // Size calculator function for tuples.
+    template<typename... Args>
+    static SizeUnit serializedSizeSingle(const std::tuple<Args...>& data);
+
 #if __MINGW64_VERSION_MAJOR > 6
     // Size calculator function for files.
     static SizeUnit serializedSizeSingle(const std::filesystem::path& data);
@@ -195,8 +195,15 @@ void BinarySerializer::readRecursive(T& value, Args&... args)
 template<typename... Args>
 SizeUnit BinarySerializer::fastSerialization(BytesDataPtr& out, const Args&... args)
 {
+    // Calculate the exact size, so the serializer allocates its buffer only once.
+    SizeUnit capacity;
+    if constexpr (has_fixed_serialized_size_v<Args...>)
+        capacity = fixed_serialized_size_v<Args...>;
+    else
+        capacity = BinarySerializer::serializedSizeRecursive(args...);
+
     // Do the serialization
-    BinarySerializer serializer;
+    BinarySerializer serializer(capacity);
     const SizeUnit size = serializer.write(std::forward<const Args&>(args)...);
     serializer.moveUnique(out);
     return size;
@@ -275,6 +282,16 @@ SizeUnit BinarySerializer::serializedSizeSingle(const std::array<T, L>&)
     return sizeof(SizeUnit) + sizeof(SizeUnit) + elem_size * array_size;
 }
 
+template<typename... Args>
+SizeUnit BinarySerializer::serializedSizeSingle(const std::tuple<Args...>& data)
+{
+    // The tuple elements are serialized one after another, with no extra header.
+    return std::apply([](const auto&... args)
+    {
+        return (SizeUnit(0) + ... + BinarySerializer::serializedSizeSingle(args));
+    }, data);
+}
+
 template<typename T>
 SizeUnit BinarySerializer::serializedSizeSingle(const std::vector<T>& data)
 {
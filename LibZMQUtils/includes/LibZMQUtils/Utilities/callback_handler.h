@@ -50,8 +50,11 @@
 #include <functional>
 #include <map>
 #include <any>
+#include <atomic>
+#include <memory>
 #include <mutex>
 #include <stdexcept>
+#include <vector>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
@@ -74,6 +77,19 @@ namespace utils{
  * to identifiers (CallbackId) for reference. Only one function can be register with a certain ideintifier. The class
  * also is designed to be thread-safe.
  *
+ * The callbacks are stored in an immutable table that is replaced (copy-on-write) on each registration or removal.
+ * The invocations announce themselves in an atomic readers counter, load the raw pointer to the current table and
+ * call the callback directly, so they never take a lock (the cost is the counter update, the map lookup and the
+ * any cast). Due to this, several threads can invoke callbacks at the same time and a callback can register or
+ * remove other callbacks (or itself) while it is running. Registrations are more expensive, since they copy the
+ * table, but they are expected to be rare. The replaced tables are released by a later update that sees no reader
+ * in progress, or by the destructor.
+ *
+ * Note that a removal doesn't wait for the invocations in progress. An invocation that loaded the table before the
+ * removal still calls the removed callback, even after `removeCallback` returns. So the object that owns a callback
+ * must stay alive until no thread can invoke it anymore (for example, until the server or subscriber that invokes
+ * the callbacks is stopped).
+ *
  * This class can be used independently or subclassed with other classes such as servers or clients of this library.
  *
  * @warning Remember that the function invokeCallback can throw exceptions.
@@ -129,13 +145,19 @@ public:
     template<typename Id, typename ClassT = void, typename RetT = void, typename... Args>
     void registerCallback(Id id, ClassT* object, RetT(ClassT::*callback)(Args...))
     {
-        std::lock_guard<std::mutex> lock(this->mtx_);
-        callback_map_[static_cast<CallbackId>(id)] = CallbackHandler::makeCallback(object, callback);
+        std::any new_callback = CallbackHandler::makeCallback(object, callback);
+        this->updateCallbacks([&](CallbackMap& callbacks)
+        {
+            callbacks[static_cast<CallbackId>(id)] = std::move(new_callback);
+        });
     }
 
     /**
      * @brief Remove a callback using its id.
      * @param id - The id of the callback to be removed.
+     * @warning The invocations in progress are not waited, so the callback can still be running (or about to run)
+     *          when this function returns. The object of the callback must not be destroyed until the invoking
+     *          threads are stopped.
      */
     void removeCallback(CallbackId id);
 
@@ -148,6 +170,7 @@ public:
 
     /**
      * @brief Remove all registered callbacks.
+     * @warning As in `removeCallback`, the invocations in progress are not waited.
      */
     void clearCallbacks();
 
@@ -165,12 +188,13 @@ public:
     template <typename CallbackType, typename RetT, typename... Args>
     RetT invokeCallback(CallbackId id, Args&&... args)
     {
-        // Safe mutex.
-        std::lock_guard<std::mutex> lock(this->mtx_);
+        // Get the current table. The guard keeps it alive even if the callback is removed while running.
+        const ReadGuard guard(*this);
+
         // Try the any cast.
         try
         {
-            auto& any_obj = this->callback_map_.at(id);
+            const auto& any_obj = guard.callbacks().at(id);
             auto callback = std::any_cast<CallbackType>(&any_obj);
             if(callback)
             {
@@ -190,6 +214,40 @@ public:
 
 private:
 
+    /// Alias for the callbacks table.
+    using CallbackMap = std::map<CallbackId, std::any>;
+
+    /// Reader registration. While it exists, the table that it loaded is not released.
+    class ReadGuard
+    {
+    public:
+
+        explicit ReadGuard(const CallbackHandler& handler) : handler_(handler)
+        {
+            // Announce the reader before loading the table (see `updateCallbacks`).
+            this->handler_.readers_.fetch_add(1, std::memory_order_seq_cst);
+            this->callbacks_ = this->handler_.callbacks_.load(std::memory_order_seq_cst);
+        }
+
+        ~ReadGuard()
+        {
+            this->handler_.readers_.fetch_sub(1, std::memory_order_release);
+        }
+
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+        const CallbackMap& callbacks() const {return *this->callbacks_;}
+
+    private:
+
+        const CallbackHandler& handler_;   ///< Handler whose table is being read.
+        const CallbackMap* callbacks_;     ///< Loaded callbacks table.
+    };
+
+    /// Copy the callbacks table, apply the modification, publish the new table and release the unused old ones.
+    void updateCallbacks(const std::function<void(CallbackMap&)>& modification);
+
     /**
      * @brief Helper function to create a std::function from a member function.
      * @tparam ClassT - Type of the class that owns the member function.
@@ -209,8 +267,11 @@ private:
     }
 
     // Private members.
-    std::map<CallbackId, std::any> callback_map_;    ///< Map storing callbacks against their ids.
-    mutable std::mutex mtx_;                         ///< Safety mutex.
+    std::unique_ptr<const CallbackMap> table_ = std::make_unique<const CallbackMap>(); ///< Owned current table.
+    std::atomic<const CallbackMap*> callbacks_ {table_.get()};  ///< Current table, as loaded by the readers.
+    mutable std::atomic<unsigned> readers_ {0};                 ///< Number of readers in progress.
+    std::vector<std::unique_ptr<const CallbackMap>> retired_;   ///< Replaced tables that can still be in use.
+    std::mutex update_mtx_;                          ///< Mutex for serializing the table updates (not the readers).
 };
 
 
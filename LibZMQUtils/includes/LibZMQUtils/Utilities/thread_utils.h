@@ -0,0 +1,183 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file thread_utils.h
+ * @brief This file contains the declaration of the utilities for configuring the library worker threads.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// =====================================================================================================================
+#pragma once
+// =====================================================================================================================
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/libzmqutils_global.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace utils{
+// =====================================================================================================================
+
+/**
+ * @brief Scheduling policy of a worker thread.
+ */
+enum class ThreadSchedPolicy : std::uint8_t
+{
+    DEFAULT,     ///< Default time-sharing policy of the system (the priority is not used).
+    FIFO,        ///< Real-time first-in first-out policy (SCHED_FIFO).
+    ROUND_ROBIN  ///< Real-time round-robin policy (SCHED_RR).
+};
+
+/**
+ * @brief The ThreadConfig struct contains the configuration of a library worker thread.
+ *
+ * Each component (servers, clients, publishers, subscribers, brokers and reactors) has a thread configuration that is
+ * applied by its worker threads when they start. By default, only a descriptive name is set, so the threads can be
+ * identified in tools like `top -H` or `perf`.
+ *
+ * @note The real-time policies usually need special privileges (for example, CAP_SYS_NICE in Linux). For real-time
+ *       applications, consider also locking the process memory at startup (see `lockProcessMemory`).
+ */
+struct LIBZMQUTILS_EXPORT ThreadConfig
+{
+    std::string name;                                             ///< Thread name (truncated to 15 chars in Linux).
+    std::vector<unsigned> cpus;                                   ///< CPUs where the thread can run (empty means any).
+    ThreadSchedPolicy sched_policy = ThreadSchedPolicy::DEFAULT;  ///< Scheduling policy.
+    int sched_priority = 0;                                       ///< Scheduling priority (only for real-time ones).
+};
+
+/**
+ * @brief Applies a thread configuration to the calling thread.
+ * @param config The thread configuration.
+ * @param suffix Suffix for the thread name, used for distinguishing the threads of a pool (for example, "/1").
+ * @return True if every part of the configuration was applied. False if some part failed or is not supported in
+ *         this platform (the rest of the configuration is applied anyway).
+ * @note The name is informative, so it is skipped (without failing) in the Windows versions that don't support
+ *       thread descriptions. The components report the failures through their error callbacks.
+ */
+LIBZMQUTILS_EXPORT bool applyThreadConfig(const ThreadConfig& config, const std::string& suffix = "");
+
+/**
+ * @brief Locks the current and future memory pages of the process in RAM, avoiding page faults in real-time threads.
+ *
+ * This should be called once at startup, before creating the real-time threads. It needs enough memory lock limits
+ * (RLIMIT_MEMLOCK or CAP_IPC_LOCK in Linux).
+ *
+ * @return True if the memory was locked. False if it failed or if it is not supported in this platform.
+ */
+LIBZMQUTILS_EXPORT bool lockProcessMemory();
+
+/**
+ * @brief Get the CPU time consumed by the calling thread.
+ * @return The CPU time of the calling thread, or zero if it is not supported in this platform.
+ */
+LIBZMQUTILS_EXPORT std::chrono::nanoseconds currentThreadCpuTime();
+
+/**
+ * @brief The ThreadCpuClock class measures the CPU time consumed by a worker thread, readable from any thread.
+ *
+ * The worker thread attaches to the clock when it starts, keeping the returned attachment alive while it runs. When
+ * the attachment is destroyed, the final CPU time is stored, so it remains available after the thread finishes.
+ *
+ * @note The class is thread safe. The CPU time is only available in POSIX platforms (zero otherwise).
+ */
+class LIBZMQUTILS_EXPORT ThreadCpuClock
+{
+public:
+
+    /**
+     * @brief RAII attachment of the calling thread to the clock.
+     */
+    class LIBZMQUTILS_EXPORT Attachment
+    {
+    public:
+
+        Attachment(const Attachment&) = delete;
+        Attachment& operator=(const Attachment&) = delete;
+
+        ~Attachment();
+
+    private:
+
+        friend class ThreadCpuClock;
+        explicit Attachment(ThreadCpuClock& clock);
+
+        ThreadCpuClock& clock_;  ///< Attached clock.
+    };
+
+    ThreadCpuClock();
+
+    ThreadCpuClock(const ThreadCpuClock&) = delete;
+    ThreadCpuClock& operator=(const ThreadCpuClock&) = delete;
+
+    /**
+     * @brief Attaches the calling thread to the clock. The previous measure is discarded.
+     * @return The attachment, which must be kept alive while the thread runs.
+     */
+    [[nodiscard]] Attachment attach();
+
+    /**
+     * @brief Get the CPU time consumed by the attached thread (or by the last attached thread, if it finished).
+     * @return The CPU time of the thread.
+     */
+    std::chrono::nanoseconds elapsed() const;
+
+private:
+
+    // Internal helper to read the CPU clock of the attached thread.
+    std::chrono::nanoseconds readClock() const;
+
+    mutable std::mutex mtx_;          ///< Safety mutex.
+    bool attached_;                   ///< True while a thread is attached.
+    std::int64_t clock_id_;           ///< Platform identifier of the CPU clock of the attached thread.
+    std::chrono::nanoseconds final_;  ///< CPU time of the last attached thread when it finished.
+};
+
+}} // END NAMESPACES.
+// =====================================================================================================================
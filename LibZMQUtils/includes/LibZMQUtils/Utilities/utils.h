@@ -48,6 +48,7 @@
 // =====================================================================================================================
 #include <regex>
 #include <string>
+#include <string_view>
 #include <cstring>
 #include <chrono>
 #include <array>
@@ -105,6 +106,43 @@ LIBZMQUTILS_EXPORT HRTimePointStd iso8601DatetimeToTimePoint(const std::string&
 
 LIBZMQUTILS_EXPORT bool isValidIso8601Datetime(const std::string& datetime);
 
+/// Buffer size that fits any datetime written by formatIso8601 (including the null terminator).
+constexpr std::size_t kIso8601BufferSize = 36;
+
+/**
+ * @brief Writes a time point as an ISO 8601 datetime (YYYY-MM-DDTHH:MM:SS[.fff|.fffffffff](Z|+HH:MM)) into a caller
+ *        provided buffer, without any memory allocation.
+ *
+ * The date and time of the last formatted second are cached (per thread and zone mode), so consecutive calls within
+ * the same second only write the fraction. The local time uses the zone offset of the formatted time point.
+ *
+ * @param tp The time point.
+ * @param buffer The output buffer. The result is null terminated.
+ * @param size The size of the buffer. Use kIso8601BufferSize for any option.
+ * @param add_ms True for adding the milliseconds.
+ * @param add_ns True for adding the nanoseconds (has priority over the milliseconds).
+ * @param utc True for UTC time (with 'Z'), false for local time (with the UTC offset).
+ * @return The number of characters written (without the terminator), or 0 if the buffer is too small or the year is
+ *         out of the [0, 9999] range.
+ */
+LIBZMQUTILS_EXPORT std::size_t formatIso8601(const TimePointStd& tp, char* buffer, std::size_t size,
+                                             bool add_ms = true, bool add_ns = false, bool utc = true);
+
+/**
+ * @brief Parses an ISO 8601 datetime in a single pass, without any memory allocation or exception.
+ *
+ * The extended (YYYY-MM-DDTHH:MM:SS) and basic (YYYYMMDDTHHMMSS) formats are supported, with an optional fraction of
+ * any length (only the first 9 digits are used) and an optional zone designator ('Z', +HH:MM or +HHMM). A datetime
+ * without zone designator is parsed as UTC.
+ *
+ * @param datetime The datetime string.
+ * @param tp The parsed time point (only modified if the datetime is valid).
+ * @param has_zone If not null, set to true if the datetime has a zone designator.
+ * @return True if the datetime is valid.
+ */
+LIBZMQUTILS_EXPORT bool parseIso8601Datetime(std::string_view datetime, HRTimePointStd& tp,
+                                             bool* has_zone = nullptr);
+
 // template<typename Enum, std::size_t N>
 // std::string getEnumString(Enum value, const std::array<const char*, N>& str_array)
 // {
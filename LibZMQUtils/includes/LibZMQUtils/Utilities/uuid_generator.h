@@ -47,9 +47,12 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <cstddef>
-#include <mutex>
-#include <random>
-#include <set>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <string_view>
 #include <array>
 // =====================================================================================================================
 
@@ -72,7 +75,8 @@ class LIBZMQUTILS_EXPORT UUID
 
 public:
 
-    static inline constexpr unsigned kUUIDSize = 16;  ///< UUID bytes size.
+    static inline constexpr unsigned kUUIDSize = 16;           ///< UUID bytes size.
+    static inline constexpr unsigned kRFC4122StringSize = 36;  ///< RFC 4122 string representation size.
 
     /**
      * @brief Construct a new empty (invalid) UUID object.
@@ -106,9 +110,8 @@ public:
      *
      * An example of a UUID string: 550e8400-e29b-41d4-a716-446655440000
      *
-     * The function std::stringstream, std::hex, std::setfill, std::setw, and std::hex are used to convert each part of
-     * the UUID into a hex string and concatenate them together with '-' as separator. The std::setw(2) ensures that
-     * each byte is represented by exactly two hex characters, padding with a zero if necessary.
+     * Each byte is converted to exactly two lowercase hex characters using a lookup table (see toRFC4122Chars), and
+     * the groups are separated with '-'.
      *
      * This method's implementation is in alignment with RFC 4122: A Universally Unique IDentifier (UUID) URN Namespace,
      * available at: https://www.ietf.org/rfc/rfc4122.txt
@@ -117,6 +120,30 @@ public:
      */
     std::string toRFC4122String() const;
 
+    /**
+     * @brief Writes the RFC 4122 string representation (see toRFC4122String) into a buffer, without any memory
+     *        allocation. The conversion uses a lookup table of the hexadecimal pairs of each byte.
+     * @param buffer The output buffer, with space for at least kRFC4122StringSize characters. No null terminator is
+     *               written.
+     */
+    void toRFC4122Chars(char* buffer) const;
+
+    /**
+     * @brief Parses an RFC 4122 string representation (8-4-4-4-12 hexadecimal digits, case insensitive), without
+     *        any memory allocation.
+     * @param str The string representation.
+     * @param uuid The parsed UUID (only modified if the string is valid).
+     * @return True if the string is a valid UUID representation.
+     */
+    static bool fromRFC4122String(std::string_view str, UUID& uuid);
+
+    /**
+     * @brief Checks if a string is a valid RFC 4122 representation (8-4-4-4-12 hexadecimal digits).
+     * @param str The string representation.
+     * @return True if the string is a valid UUID representation.
+     */
+    static bool isValidRFC4122String(std::string_view str);
+
     /**
      * @brief Retrieves a constant reference to the UUID's byte array.
      * @return A constant reference to the UUID's byte array.
@@ -185,33 +212,48 @@ LIBZMQUTILS_EXPORT bool operator==(const UUID& a, const UUID& b);
  */
 LIBZMQUTILS_EXPORT bool operator!=(const UUID& a, const UUID& b);
 
+/**
+ * @brief Writes the RFC 4122 string representation of the UUID in a stream, without temporary strings.
+ * @param os The output stream.
+ * @param uuid The UUID.
+ * @return The output stream.
+ */
+LIBZMQUTILS_EXPORT std::ostream& operator<<(std::ostream& os, const UUID& uuid);
+
 /**
  * @class UUIDGenerator
  *
  * @brief This singleton class provides functionality for generating UUID (Universally Unique Identifier).
  *
- * This singleton class supports generation of Version 4 UUIDs as per RFC 4122. A Version 4 UUID is randomly generated.
+ * This singleton class supports generation of Version 4 UUIDs as per RFC 4122 and time-ordered Version 7 UUIDs as per
+ * RFC 9562. A Version 4 UUID is randomly generated, while a Version 7 UUID starts with the Unix time stamp in
+ * milliseconds, so the UUIDs sort by creation time (useful for journals, logs or database keys).
  *
  * The UUID generated by this class is a 128-bit value. The string representation is a series of lowercase hexadecimal
  * digits in groups, separated by hyphens, in the form 8-4-4-4-12 for a total of 36 characters (32 alphanumeric
  * characters and four hyphens).
  *
- * The algorithm used for generation is as follows:
- * 1. Generate 16 random bytes
+ * The algorithm used for the Version 4 generation is as follows:
+ * 1. Generate two random 64-bit words (16 bytes).
  * 2. Adjust certain bits according to RFC 4122 section 4.4 as follows:
  *    a. Set the four most significant bits of the 7th byte to 0100'B, so the high nibble is "4".
  *    b. Set the two most significant bits of the 9th byte to 10'B, so the high nibble will be one of "8", "9",
  *    "A", or "B".
- * 3. Convert the byte array to a string in the form of 8-4-4-4-12
+ *
+ * Each thread uses its own random engine (a 64-bit Mersenne Twister seeded from std::random_device, the time and the
+ * thread identifier), so the generation doesn't need any lock. The uniqueness relies on the 122 random bits (the
+ * probability of a collision is negligible), so the generated UUIDs are not stored.
+ *
+ * For the Version 7 UUIDs, the 12 bits after the time stamp are a counter (randomly initialized each millisecond), so
+ * the UUIDs generated by the same thread are strictly increasing even within the same millisecond.
  *
  * @note The class is thread safe.
  *
  * @note The UUIDs generated are pseudo-random numbers. While the randomness of the generated UUIDs is sufficient for
  * most purposes, it is not suitable for functions that need truly random numbers.
  *
- * @warning This class relies on std::random_device for random number generation. On some platforms, this does not
- * actually provide a non-deterministic random number generator. In such cases, the randomness of the generated UUIDs
- * may be weaker and a random seed will be generated using a timestamp.
+ * @warning On some platforms std::random_device is not a non-deterministic random number generator. In such cases,
+ * the randomness of the generated UUIDs relies on the time stamp and the thread identifier used in the seed.
  */
 class LIBZMQUTILS_EXPORT UUIDGenerator
 {
@@ -223,11 +265,17 @@ public:
     static UUIDGenerator& getInstance();
 
     /**
-     * @brief Generates a version 4 UUID
+     * @brief Generates a version 4 (random) UUID.
      * @return A unique UUID
      */
     UUID generateUUIDv4();
 
+    /**
+     * @brief Generates a version 7 (time-ordered) UUID.
+     * @return A unique UUID, greater than the previous ones generated by the same thread.
+     */
+    UUID generateUUIDv7();
+
     // Deleted constructors and assignment operators.
     UUIDGenerator(const UUIDGenerator &) = delete;
     UUIDGenerator(UUIDGenerator&&) = delete;
@@ -237,14 +285,29 @@ public:
 private:
 
     // Private constructor.
-    UUIDGenerator();
-
-    // Members.
-    std::mutex mtx_;                  ///< Safety mutex.
-    std::random_device rd_;           ///< Random device.
-    std::mt19937_64 gen_;             ///< Generator.
-    std::set<UUID> generated_uuids_;  ///< Set of all generated UUIDs to ensure uniqueness.
+    UUIDGenerator() = default;
 };
 
 }} // END NAMESPACES.
 // =====================================================================================================================
+
+// UUID HASH
+// =====================================================================================================================
+/**
+ * @brief Hash specialization for using UUID as key in unordered containers.
+ */
+namespace std{
+template<>
+struct hash<zmqutils::utils::UUID>
+{
+    size_t operator()(const zmqutils::utils::UUID& uuid) const noexcept
+    {
+        uint64_t high, low;
+        memcpy(&high, uuid.getBytes().data(), sizeof(high));
+        memcpy(&low, uuid.getBytes().data() + sizeof(high), sizeof(low));
+        uint64_t hash = high ^ (low + 0x9E3779B97F4A7C15ULL + (high << 6) + (high >> 2));
+        return static_cast<size_t>(hash ^ (hash >> 32));
+    }
+};
+} // END NAMESPACES.
+// =====================================================================================================================
@@ -83,6 +83,10 @@ CommandClientBase::CommandClientBase(const std::string& server_endpoint,
     recv_close_socket_(nullptr),
     req_close_socket_(nullptr),
     flag_client_closed_(true),
+    reactor_alive_socket_(nullptr),
+    alive_socket_id_(0),
+    alive_timer_id_(0),
+    alive_timeout_id_(0),
     flag_client_working_(false),
     flag_waiting_cmd_reply_(false),
     flag_autoalive_enabled_(false),
@@ -144,6 +148,9 @@ CommandClientBase::CommandClientBase(const std::string& server_endpoint,
     unsigned port = static_cast<unsigned>(std::stoi(server_endpoint.substr(server_endpoint.rfind(':') + 1)));
     this->connected_server_info_.endpoint = server_endpoint;
     this->connected_server_info_.port = port;
+
+    // Default name of the worker thread.
+    this->thread_config_.name = "zmq-alive";
 }
 
 CommandClientBase::~CommandClientBase()
@@ -207,6 +214,12 @@ bool CommandClientBase::internalResetClient()
     {
         // Zmq client socket.
         this->client_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::req);
+
+        // ZMQ_IMMEDIATE is not applied to the REQ socket. Without a completed connection the send would block forever
+        // instead of reaching the reply timeout that reports the dead server.
+        SocketOptions options = this->socket_options_;
+        options.immediate = -1;
+        applySocketOptions(*this->client_socket_, options);
         this->client_socket_->connect(this->server_endpoint_);
         this->client_socket_->set(zmq::sockopt::linger, 0);
 
@@ -269,6 +282,59 @@ void CommandClientBase::disableAutoAlive()
     this->stopAutoAlive();
 }
 
+void CommandClientBase::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the worker is not running.
+    if (!this->flag_autoalive_enabled_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig CommandClientBase::getWorkerThreadConfig() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds CommandClientBase::getWorkerCpuTime() const
+{
+    return this->worker_cpu_clock_.elapsed();
+}
+
+void CommandClientBase::setReactor(std::shared_ptr<ZMQReactor> reactor)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the client is stopped.
+    if (!this->flag_client_working_)
+        this->reactor_ = std::move(reactor);
+}
+
+std::shared_ptr<ZMQReactor> CommandClientBase::getReactor() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->reactor_;
+}
+
+void CommandClientBase::setSocketOptions(const SocketOptions &options)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the client is stopped.
+    if (!this->flag_client_working_)
+        this->socket_options_ = options;
+}
+
+SocketOptions CommandClientBase::getSocketOptions() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->socket_options_;
+}
+
 bool CommandClientBase::isConnected() const
 {
     return this->flag_server_connected_;
@@ -295,10 +361,28 @@ const std::string &CommandClientBase::getServerEndpoint() const
 
 bool CommandClientBase::isWorking() const{return this->flag_client_working_;}
 
+bool CommandClientBase::isContextInUse() const
+{
+    return this->isWorking();
+}
+
 void CommandClientBase::startAutoAlive()
 {
     if(!this->flag_autoalive_enabled_)
     {
+        // With a reactor, the timers and the alive socket are registered in the reactor loop.
+        if (this->reactor_)
+        {
+            if (!this->reactor_->isRunning())
+            {
+                this->onClientError(zmq::error_t(), this->kScope + " The reactor is not running. Auto alive disabled.");
+                return;
+            }
+            this->flag_autoalive_enabled_ = true;
+            this->reactor_->execute([this]{ this->startReactorAlive(); });
+            return;
+        }
+
         this->flag_autoalive_enabled_ = true;
         this->auto_alive_future_ = std::async(std::launch::async, [this]{this->aliveWorker();});
     }
@@ -309,6 +393,14 @@ void CommandClientBase::stopAutoAlive()
     if (this->flag_autoalive_enabled_)
     {
         this->flag_autoalive_enabled_ = false;
+
+        // With a reactor, unregister the timers and the alive socket in the reactor loop.
+        if (this->reactor_)
+        {
+            this->reactor_->execute([this]{ this->stopReactorAlive(); });
+            return;
+        }
+
         this->auto_alive_cv_.notify_all();
         // If the auto alive is waiting for a response.
         if(this->auto_alive_future_.valid() &&
@@ -559,83 +651,7 @@ void CommandClientBase::recvFromSocket(CommandReply& reply,
             // We have data, so a message has been received, try to process it.
             if (items[0].revents & ZMQ_POLLIN)
             {
-                // Update the seen flag.
-                this->flag_server_seen_ = true;
-
-                // Store the last time the server was seen.
-                this->connected_server_info_.seen_timestamp =
-                    utils::timePointToIso8601(utils::HRTimePointStd::clock::now());
-
-                // Get the multipart msg.
-                zmq::multipart_t multipart_msg;
-                multipart_msg.recv(*recv_socket);
-
-                // Check for empty msg or timeout reached.
-                if (multipart_msg.empty())
-                {
-                    reply.result = OperationResult::EMPTY_MSG;
-                    return;
-                }
-
-                // Check the multipart msg size.
-                if (multipart_msg.size() != 3 && multipart_msg.size() != 4)
-                {
-                    reply.result = OperationResult::INVALID_PARTS;
-                    return;
-                }
-
-                // Get the multipart data.
-                zmq::message_t msg_uuid = multipart_msg.pop();
-                zmq::message_t msg_res = multipart_msg.pop();
-                zmq::message_t msg_time = multipart_msg.pop();
-
-                // Get the server UUID data.
-                if (msg_uuid.size() == utils::UUID::kUUIDSize + sizeof(serializer::SizeUnit)*2)
-                {
-                    std::array<std::byte, 16> uuid_bytes;
-                    serializer::BinarySerializer::fastDeserialization(msg_uuid.data(), msg_uuid.size(), uuid_bytes);
-                    reply.server_uuid = utils::UUID(uuid_bytes);
-                }
-                else
-                {
-                    reply.result = OperationResult::INVALID_SERVER_UUID;
-                    return;
-                }
-
-                // Check the result size.
-                constexpr size_t res_part_size = (sizeof(serializer::SizeUnit) + sizeof(ResultType))*2;
-                if (msg_res.size() != res_part_size)
-                {
-                    reply.result = OperationResult::INVALID_MSG;
-                    return;
-                }
-
-                // Get the operation result and the command.
-                serializer::BinarySerializer::fastDeserialization(msg_res.data(), msg_res.size(),
-                                                                  reply.command, reply.result);
-
-                // Get the timestamp.
-                serializer::BinarySerializer::fastDeserialization(msg_time.data(), msg_time.size(), reply.timestamp);
-
-                // If there is still one more part, they are the parameters.
-                if (multipart_msg.size() == 1)
-                {
-                    // Get the message and the size.
-                    zmq::message_t msg_params = multipart_msg.pop();
-
-                    // Check the parameters.
-                    if(msg_params.size() == 0)
-                    {
-                        reply.result = OperationResult::EMPTY_PARAMS;
-                        return;
-                    }
-
-                    // Get and store the parameters data.
-                    serializer::BinarySerializer serializer(msg_params.data(), msg_params.size());
-                    reply.data.size = serializer.moveUnique(reply.data.bytes);
-                }
-
-                // All ok.
+                this->recvReply(*recv_socket, reply);
                 return;
             }
         }
@@ -667,6 +683,84 @@ void CommandClientBase::recvFromSocket(CommandReply& reply,
     }
 }
 
+void CommandClientBase::recvReply(zmq::socket_t &recv_socket, CommandReply &reply)
+{
+    // Update the seen flag.
+    this->flag_server_seen_ = true;
+
+    // Store the last time the server was seen.
+    this->connected_server_info_.seen_timestamp = utils::timePointToIso8601(utils::HRTimePointStd::clock::now());
+
+    // Get the multipart msg.
+    zmq::multipart_t multipart_msg;
+    multipart_msg.recv(recv_socket);
+
+    // Check for empty msg or timeout reached.
+    if (multipart_msg.empty())
+    {
+        reply.result = OperationResult::EMPTY_MSG;
+        return;
+    }
+
+    // Check the multipart msg size.
+    if (multipart_msg.size() != 3 && multipart_msg.size() != 4)
+    {
+        reply.result = OperationResult::INVALID_PARTS;
+        return;
+    }
+
+    // Get the multipart data.
+    zmq::message_t msg_uuid = multipart_msg.pop();
+    zmq::message_t msg_res = multipart_msg.pop();
+    zmq::message_t msg_time = multipart_msg.pop();
+
+    // Get the server UUID data.
+    if (msg_uuid.size() == utils::UUID::kUUIDSize + sizeof(serializer::SizeUnit)*2)
+    {
+        std::array<std::byte, 16> uuid_bytes;
+        serializer::BinarySerializer::fastDeserialization(msg_uuid.data(), msg_uuid.size(), uuid_bytes);
+        reply.server_uuid = utils::UUID(uuid_bytes);
+    }
+    else
+    {
+        reply.result = OperationResult::INVALID_SERVER_UUID;
+        return;
+    }
+
+    // Check the result size.
+    constexpr size_t res_part_size = (sizeof(serializer::SizeUnit) + sizeof(ResultType))*2;
+    if (msg_res.size() != res_part_size)
+    {
+        reply.result = OperationResult::INVALID_MSG;
+        return;
+    }
+
+    // Get the operation result and the command.
+    serializer::BinarySerializer::fastDeserialization(msg_res.data(), msg_res.size(),
+                                                      reply.command, reply.result);
+
+    // Get the timestamp.
+    serializer::BinarySerializer::fastDeserialization(msg_time.data(), msg_time.size(), reply.timestamp);
+
+    // If there is still one more part, they are the parameters.
+    if (multipart_msg.size() == 1)
+    {
+        // Get the message and the size.
+        zmq::message_t msg_params = multipart_msg.pop();
+
+        // Check the parameters.
+        if(msg_params.size() == 0)
+        {
+            reply.result = OperationResult::EMPTY_PARAMS;
+            return;
+        }
+
+        // Get and store the parameters data.
+        serializer::BinarySerializer serializer(msg_params.data(), msg_params.size());
+        reply.data.size = serializer.moveUnique(reply.data.bytes);
+    }
+}
+
 void CommandClientBase::deleteSockets()
 {
     // Delete the pointers.
@@ -720,6 +814,11 @@ void CommandClientBase::internalStopClient()
 
 void CommandClientBase::aliveWorker()
 {
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_))
+        this->onClientError(zmq::error_t(), this->kScope + " The thread configuration was not fully applied.");
+    auto cpu_attachment = this->worker_cpu_clock_.attach();
+
     // Request and reply.
     CommandRequest command_request(ServerCommand::REQ_ALIVE, this->client_info_.uuid,
                                    utils::currentISO8601Date(true, false, true), {});
@@ -873,6 +972,174 @@ void CommandClientBase::aliveWorker()
         delete pull_close_socket;
 }
 
+void CommandClientBase::startReactorAlive()
+{
+    // Create the alive socket. The loop owns it while the auto alive is enabled.
+    try
+    {
+        this->reactor_alive_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::req);
+        this->reactor_alive_socket_->connect(this->server_endpoint_);
+        this->reactor_alive_socket_->set(zmq::sockopt::linger, 0);
+    }
+    catch (const zmq::error_t &error)
+    {
+        // Safe mutex lock
+        std::unique_lock<std::mutex> lock(this->mtx_);
+
+        // Call to the error callback and stop the client for safety.
+        this->onClientError(error, this->kScope + " Error while creating automatic alive worker. Stopping the client.");
+        this->stopReactorAlive();
+        this->flag_autoalive_enabled_ = false;
+        this->internalStopClient();
+        return;
+    }
+
+    // Register the alive socket and the sending timer, and send the first alive message now.
+    const auto period = std::chrono::milliseconds(std::max(this->send_alive_period_.load(), 1u));
+    this->alive_socket_id_ = this->reactor_->addSocket(*this->reactor_alive_socket_, [this]
+    {
+        this->recvReactorAlive();
+    });
+    this->alive_timer_id_ = this->reactor_->addTimer(period, [this]{ this->sendReactorAlive(); });
+    this->sendReactorAlive();
+}
+
+void CommandClientBase::stopReactorAlive()
+{
+    // Unregister the timers and the alive socket, and delete it.
+    if (this->alive_timeout_id_)
+        this->reactor_->removeTimer(this->alive_timeout_id_);
+    if (this->alive_timer_id_)
+        this->reactor_->removeTimer(this->alive_timer_id_);
+    if (this->alive_socket_id_)
+        this->reactor_->removeSocket(this->alive_socket_id_);
+    this->alive_timeout_id_ = 0;
+    this->alive_timer_id_ = 0;
+    this->alive_socket_id_ = 0;
+
+    if (this->reactor_alive_socket_)
+    {
+        delete this->reactor_alive_socket_;
+        this->reactor_alive_socket_ = nullptr;
+    }
+}
+
+void CommandClientBase::sendReactorAlive()
+{
+    // Avoid unnecesary alive messages. The REQ socket also needs the previous reply before sending again.
+    if (!this->flag_autoalive_enabled_ || this->alive_timeout_id_ || !this->isWorking())
+        return;
+
+    // Request.
+    CommandRequest command_request(ServerCommand::REQ_ALIVE, this->client_info_.uuid,
+                                   utils::currentISO8601Date(true, false, true), {});
+
+    // Send the command without blocking the loop. If it can't be queued, retry in the next period.
+    try
+    {
+        // Call to the internal sending command callback.
+        if (this->flag_alive_callbacks_)
+            this->onSendingCommand(command_request);
+
+        // Prepare and send the multipart msg. The msg id will be the same of the original client socket.
+        zmq::multipart_t multipart_msg(this->prepareMessage(command_request));
+        if (!multipart_msg.send(*this->reactor_alive_socket_, static_cast<int>(zmq::send_flags::dontwait)))
+            return;
+    }
+    catch (const zmq::error_t &error)
+    {
+        // Call to the error callback and stop the client for safety.
+        this->onClientError(error, this->kScope + " Error while sending automatic alive. Stopping the client.");
+
+        // If was  connected, call to the disconnected callback.
+        if(this->flag_server_connected_)
+        {
+            this->onDisconnected(this->connected_server_info_);
+            this->flag_server_connected_ = false;
+        }
+
+        // Safe mutex lock
+        std::unique_lock<std::mutex> lock(this->mtx_);
+        this->stopReactorAlive();
+        this->flag_autoalive_enabled_ = false;
+        this->internalStopClient();
+        return;
+    }
+
+    // Call to the internal waiting command callback, and wait the reply until the server alive timeout.
+    if(this->flag_alive_callbacks_)
+        this->onWaitingReply();
+    this->alive_timeout_id_ = this->reactor_->addTimer(
+        std::chrono::milliseconds(std::max(this->server_alive_timeout_.load(), 1u)),
+        [this]{ this->reactorAliveTimeout(); });
+}
+
+void CommandClientBase::recvReactorAlive()
+{
+    // Receive the reply. A reply after the timeout can't arrive, since the socket is deleted on timeout.
+    CommandReply reply;
+    try
+    {
+        this->recvReply(*this->reactor_alive_socket_, reply);
+    }
+    catch (const zmq::error_t &error)
+    {
+        // Call to the error callback and stop the client for safety.
+        this->onClientError(error, this->kScope + " Error while receiving automatic alive. Stopping the client.");
+
+        // Safe mutex lock
+        std::unique_lock<std::mutex> lock(this->mtx_);
+        this->stopReactorAlive();
+        this->flag_autoalive_enabled_ = false;
+        this->internalStopClient();
+        return;
+    }
+    catch(...)
+    {
+        reply.result = OperationResult::INVALID_MSG;
+    }
+
+    // The server replied in time.
+    if (this->alive_timeout_id_)
+    {
+        this->reactor_->removeTimer(this->alive_timeout_id_);
+        this->alive_timeout_id_ = 0;
+    }
+
+    // Check the result.
+    if(reply.result == OperationResult::COMMAND_OK)
+    {
+        // Call to the internal callback.
+        if(this->flag_alive_callbacks_)
+            this->onReplyReceived(reply);
+    }
+    else
+    {
+        // Internal callback.
+        this->onBadOperation(reply);
+    }
+}
+
+void CommandClientBase::reactorAliveTimeout()
+{
+    // Call to the internall callback.
+    this->onDeadServer(this->connected_server_info_);
+
+    // If was  connected, call to the disconnected callback.
+    if(this->flag_server_connected_)
+    {
+        this->onDisconnected(this->connected_server_info_);
+        this->flag_server_connected_ = false;
+    }
+
+    // Disable autoalive.
+    this->stopReactorAlive();
+    this->flag_autoalive_enabled_ = false;
+
+    // NOTE: The client reset is neccesary for flush the ZMQ internal
+    this->internalResetClient();
+}
+
 OperationResult CommandClientBase::doConnect(bool auto_alive)
 {
     // Result.
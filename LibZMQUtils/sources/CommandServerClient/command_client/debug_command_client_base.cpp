@@ -146,7 +146,7 @@ void DebugCommandClientBase::onBadOperation(const CommandReply &rep)
     std::stringstream data;
     data << "Reply Timestamp:  " << rep.timestamp                          << std::endl;
     data << "Elapsed ms:       " << rep.elapsed.count()                   << std::endl;
-    data << "Server UUID:      " << rep.server_uuid.toRFC4122String()      << std::endl;
+    data << "Server UUID:      " << rep.server_uuid                        << std::endl;
     data << "Server Command:   " << std::to_string(static_cast<CommandType>(rep.command))
          << " (" << this->serverCommandToString(rep.command) << ")"        << std::endl;
     data << "Result:           " << static_cast<ResultType>(rep.result)
@@ -161,7 +161,7 @@ void DebugCommandClientBase::onReplyReceived(const CommandReply &rep)
     std::stringstream data;
     data << "Reply Timestamp:   " << rep.timestamp                         << std::endl;
     data << "Elapsed ms:        " << rep.elapsed.count()                   << std::endl;
-    data << "Server UUID:       " << rep.server_uuid.toRFC4122String()     << std::endl;
+    data << "Server UUID:       " << rep.server_uuid                       << std::endl;
     data << "Server Command:    " << std::to_string(static_cast<CommandType>(rep.command))
          << " (" << this->serverCommandToString(rep.command) << ")"        << std::endl;
     data << "Result:            " << static_cast<ResultType>(rep.result)
@@ -64,9 +64,23 @@ ClbkCommandServerBase::ClbkCommandServerBase(unsigned server_port,
     CallbackHandler()
 {}
 
-void ClbkCommandServerBase::removeCallback(ServerCommand command)
+bool ClbkCommandServerBase::removeCallback(ServerCommand command)
 {
+    // The automatic process functions have the callback bound, so replace them with one reporting the missing callback.
+    // This fails while the server is working, since the worker could be calling the bound object.
+    if(this->bound_clbk_cmds_.count(command) > 0)
+    {
+        auto empty_proc_func = [](const CommandRequest&, CommandReply& reply)
+        {
+            reply.result = OperationResult::EMPTY_EXT_CALLBACK;
+        };
+        if(!this->registerReqProcFunc(command, empty_proc_func))
+            return false;
+        this->bound_clbk_cmds_.erase(command);
+    }
+
     CallbackHandler::removeCallback(static_cast<CallbackHandler::CallbackId>(command));
+    return true;
 }
 
 bool ClbkCommandServerBase::hasCallback(ServerCommand command)
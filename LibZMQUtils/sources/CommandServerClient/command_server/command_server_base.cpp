@@ -42,6 +42,7 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <stdio.h>
+#include <algorithm>
 #include <thread>
 #include <chrono>
 // =====================================================================================================================
@@ -78,6 +79,7 @@ CommandServerBase::CommandServerBase(unsigned port,
                                      const std::string& server_version,
                                      const std::string& server_info) :
     server_socket_(nullptr),
+    enabled_hooks_(static_cast<std::uint32_t>(ServerHook::ALL_HOOKS)),
     flag_server_working_(false),
     flag_check_clients_alive_(true),
     flag_alive_callbacks_(true),
@@ -134,6 +136,9 @@ CommandServerBase::CommandServerBase(unsigned port,
     this->server_info_.ips = this->getServerIps();
     this->server_info_.hostname = internal_helpers::network::getHostname();
     this->server_info_.seen_timestamp = "";
+
+    // Default name of the worker thread.
+    this->thread_config_.name = "zmq-server";
 }
 
 const std::future<void> &CommandServerBase::getServerWorkerFuture() const
@@ -153,6 +158,11 @@ bool CommandServerBase::isWorking() const
     return this->flag_server_working_;
 }
 
+bool CommandServerBase::isContextInUse() const
+{
+    return this->isWorking();
+}
+
 void CommandServerBase::setClientAliveTimeout(const std::chrono::milliseconds& timeout)
 {
     this->client_alive_timeout_ = static_cast<unsigned>(timeout.count());
@@ -191,6 +201,59 @@ void CommandServerBase::setAliveCallbacksEnabled(bool flag)
     this->flag_alive_callbacks_ = flag;
 }
 
+void CommandServerBase::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the server is stopped.
+    if (!this->flag_server_working_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig CommandServerBase::getWorkerThreadConfig() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds CommandServerBase::getWorkerCpuTime() const
+{
+    return this->worker_cpu_clock_.elapsed();
+}
+
+void CommandServerBase::setSocketOptions(const SocketOptions &options)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the server is stopped.
+    if (!this->flag_server_working_)
+        this->socket_options_ = options;
+}
+
+void CommandServerBase::setEnabledHooks(std::uint32_t hooks)
+{
+    // Safe mutex lock
+    std::unique_lock<std::mutex> lock(this->mtx_);
+
+    // Only update the value if the server is stopped.
+    if (!this->flag_server_working_)
+        this->enabled_hooks_ = hooks;
+}
+
+std::uint32_t CommandServerBase::getEnabledHooks() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->enabled_hooks_;
+}
+
+SocketOptions CommandServerBase::getSocketOptions() const
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    return this->socket_options_;
+}
+
 const CommandServerInfo &CommandServerBase::getServerInfo() const
 {
     std::unique_lock<std::mutex> lock(this->mtx_);
@@ -232,6 +295,12 @@ bool CommandServerBase::startServer()
     if (this->flag_server_working_)
         return true;
 
+    // Freeze the process functions, so the worker can dispatch the commands without locks.
+    {
+        std::unique_lock<std::mutex> lock(this->mtx_);
+        this->buildProcessFunctionsTable();
+    }
+
      // Launch server worker in other thread.
     this->fut_server_worker_ = std::async(std::launch::async, &CommandServerBase::serverWorker, this);
 
@@ -476,6 +545,12 @@ OperationResult CommandServerBase::execReqGetServerTime(CommandReply& reply)
 
 void CommandServerBase::serverWorker()
 {
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_))
+        this->onServerError(zmq::error_t(),
+                            CommandServerBase::kScope + " The thread configuration was not fully applied.");
+    auto cpu_attachment = this->worker_cpu_clock_.attach();
+
     // Containers.
     CommandRequest request;
     CommandReply reply;
@@ -507,7 +582,8 @@ void CommandServerBase::serverWorker()
     while(this->server_socket_ && this->flag_server_working_)
     {
         // Call to the internal waiting command callback (check first the last request).
-        if (request.command != ServerCommand::REQ_ALIVE || this->flag_alive_callbacks_)
+        if (this->isHookEnabled(ServerHook::WAITING_COMMAND) &&
+            (request.command != ServerCommand::REQ_ALIVE || this->flag_alive_callbacks_))
             this->onWaitingCommand();
 
         // Clean the containers.
@@ -538,10 +614,12 @@ void CommandServerBase::serverWorker()
             reply.timestamp = utils::currentISO8601Date(true, false, true);
 
             // Internal callback.
-            this->onInvalidMsgReceived(request);
+            if (this->isHookEnabled(ServerHook::INVALID_MSG_RECEIVED))
+                this->onInvalidMsgReceived(request);
 
             // Send response callback.
-            this->onSendingResponse(reply);
+            if (this->isHookEnabled(ServerHook::SENDING_RESPONSE))
+                this->onSendingResponse(reply);
 
             // Prepare the message.
             serializer::BytesDataPtr data_ptr;
@@ -580,7 +658,8 @@ void CommandServerBase::serverWorker()
             reply.timestamp = utils::currentISO8601Date(true, false, true);
 
             // Sending callback.
-            if (request.command != ServerCommand::REQ_ALIVE || this->flag_alive_callbacks_)
+            if (this->isHookEnabled(ServerHook::SENDING_RESPONSE) &&
+                (request.command != ServerCommand::REQ_ALIVE || this->flag_alive_callbacks_))
                 this->onSendingResponse(reply);
 
             // Binary serializer.
@@ -786,7 +865,8 @@ const CommandServerBase::NetworkAdapterInfoV &CommandServerBase::internalGetServ
 void CommandServerBase::processCommand(CommandRequest& request, CommandReply& reply)
 {
     // First of all, call to the internal callback.
-    this->onCommandReceived(request);
+    if (this->isHookEnabled(ServerHook::COMMAND_RECEIVED))
+        this->onCommandReceived(request);
 
     // Process the different commands.
     // 1 - Process is the connect request.
@@ -820,7 +900,8 @@ void CommandServerBase::processCommand(CommandRequest& request, CommandReply& re
     else if(this->validateCustomRequest(request))
     {
         // Call the internal callback.
-        this->onCustomCommandReceived(request);
+        if (this->isHookEnabled(ServerHook::CUSTOM_COMMAND_RECEIVED))
+            this->onCustomCommandReceived(request);
 
         // Custom command, so call to the custom process.
         this->processCustomCommand(request, reply);
@@ -833,17 +914,59 @@ void CommandServerBase::processCommand(CommandRequest& request, CommandReply& re
 
 void CommandServerBase::processCustomCommand(CommandRequest& request, CommandReply &reply)
 {
-    auto iter = process_fnc_map_.find(request.command);
-    if(iter != process_fnc_map_.end())
+    // Negative commands wrap to huge indexes, so the size check also discards them.
+    const std::size_t idx = static_cast<std::size_t>(request.command);
+    if(idx < this->process_fnc_table_.size())
     {
         // Invoke the function.
-        iter->second(request, reply);
+        if(this->process_fnc_table_[idx])
+            this->process_fnc_table_[idx](request, reply);
+        else
+            reply.result = OperationResult::NOT_IMPLEMENTED;
+        return;
     }
+
+    // Command outside the table.
+    auto iter = this->process_fnc_overflow_.find(static_cast<ServerCommand>(request.command));
+    if(iter != this->process_fnc_overflow_.end())
+        iter->second(request, reply);
     else
-    {
-        // Command not found in the map.
         reply.result = OperationResult::NOT_IMPLEMENTED;
+}
+
+void CommandServerBase::buildProcessFunctionsTable()
+{
+    // The commands that fit in the table (the rest are frozen into the overflow map).
+    auto in_table = [](ServerCommand command)
+    {
+        const CommandType id = static_cast<CommandType>(command);
+        return id >= 0 && static_cast<unsigned>(id) < kMaxProcessFunctionsTableSize;
+    };
+
+    // Get the table size from the biggest registered command.
+    std::size_t table_size = 0;
+    for(const auto& [command, function] : this->process_fnc_map_)
+    {
+        if(function && in_table(command))
+            table_size = std::max(table_size, static_cast<std::size_t>(command) + 1);
     }
+
+    // Fill the containers.
+    ProcessFunctionsTable table(table_size);
+    ProcessFunctionsMap overflow;
+    for(const auto& [command, function] : this->process_fnc_map_)
+    {
+        if(!function)
+            continue;
+        if(in_table(command))
+            table[static_cast<std::size_t>(command)] = function;
+        else
+            overflow[command] = function;
+    }
+
+    // Store the containers.
+    this->process_fnc_table_ = std::move(table);
+    this->process_fnc_overflow_ = std::move(overflow);
 }
 
 void CommandServerBase::checkClientsAliveStatus()
@@ -960,6 +1083,7 @@ void CommandServerBase::resetSocket()
             // Create the ZMQ rep socket.
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
             this->server_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::rep);
+            applySocketOptions(*this->server_socket_, this->socket_options_);
             this->server_socket_->bind(this->server_info_.endpoint);
             this->server_socket_->set(zmq::sockopt::linger, 0);
 
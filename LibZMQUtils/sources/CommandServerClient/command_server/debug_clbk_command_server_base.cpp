@@ -168,7 +168,7 @@ void DebugClbkCommandServerBase::onCommandReceived(const CommandRequest &request
     // Log.
     BinarySerializer serializer(request.data.bytes.get(), request.data.size);
     std::stringstream data;
-    data << "Client UUID:        " << request.client_uuid.toRFC4122String()                 << std::endl;
+    data << "Client UUID:        " << request.client_uuid                                   << std::endl;
     data << "Request Timestamp:  " << request.timestamp                                     << std::endl;
     data << "Server Command:     "
          << std::to_string(static_cast<CommandType>(request.command))
@@ -183,7 +183,7 @@ void DebugClbkCommandServerBase::onInvalidMsgReceived(const CommandRequest &requ
     // Log.
     BinarySerializer serializer(request.data.bytes.get(), request.data.size);
     std::stringstream data;
-    data << "Client UUID:        " << request.client_uuid.toRFC4122String()                 << std::endl;
+    data << "Client UUID:        " << request.client_uuid                                   << std::endl;
     data << "Request Timestamp:  " << request.timestamp                                     << std::endl;
     data << "Server Command:     "
          << std::to_string(static_cast<CommandType>(request.command))
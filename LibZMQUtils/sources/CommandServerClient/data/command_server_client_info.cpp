@@ -103,7 +103,7 @@ std::string CommandClientInfo::toJsonString() const
     std::stringstream ss;
 
     ss << "{"
-       << "\"uuid\":\"" << this->uuid.toRFC4122String() << "\","
+       << "\"uuid\":\"" << this->uuid << "\","
        << "\"ip\":\"" << this->ip << "\","
        << "\"pid\":\"" << this->pid << "\","
        << "\"hostname\":\"" << this->hostname << "\","
@@ -147,7 +147,7 @@ std::string CommandServerInfo::toJsonString() const
     std::stringstream ss;
 
     ss << "{"
-       << "\"uuid\":\"" << this->uuid.toRFC4122String() << "\","
+       << "\"uuid\":\"" << this->uuid << "\","
        << "\"port\":" << this->port << ","
        << "\"endpoint\":\"" << this->endpoint << "\","
        << "\"hostname\":\"" << this->hostname << "\","
@@ -174,7 +174,7 @@ std::string CommandClientInfo::toString() const
     std::stringstream ss;
 
     // Generate the string.
-    ss << "Client UUID:     " << this->uuid.toRFC4122String() << std::endl;
+    ss << "Client UUID:     " << this->uuid << std::endl;
     ss << "Client Ip:       " << this->ip                     << std::endl;
     ss << "Client PID:      " << this->pid                    << std::endl;
     ss << "Client Hostname: " << this->hostname               << std::endl;
@@ -211,7 +211,7 @@ std::string CommandServerInfo::toString(bool only_basic_info) const
         ip_list.erase(ip_list.size() - separator.size(), separator.size());
 
     // Generate the string.
-    ss << "Server UUID:      " << this->uuid.toRFC4122String() << std::endl;
+    ss << "Server UUID:      " << this->uuid << std::endl;
     ss << "Server Port:      " << this->port << std::endl;
     ss << "Server Endpoint:  " << this->endpoint << std::endl;
     ss << "Server Hostname:  " << this->hostname << std::endl;
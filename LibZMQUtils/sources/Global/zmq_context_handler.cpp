@@ -44,6 +44,7 @@
 #include <vector>
 #include <functional>
 #include <mutex>
+#include <stdexcept>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
@@ -57,9 +58,12 @@ namespace zmqutils{
 
 ZMQContextHandler::ZMQContextHandler()
 {
-    // For the first instance, create the context.
+    // Safety mutex.
+    std::lock_guard<std::mutex> lock(ZMQContextHandler::mtx_);
+
+    // For the first instance, create the context (the configuration was validated when it was stored).
     if (ZMQContextHandler::instances_.empty())
-        ZMQContextHandler::context_ = std::make_unique<zmq::context_t>(1);
+        ZMQContextHandler::context_ = ZMQContextHandler::createContext(ZMQContextHandler::config_);
 
     // Register this instance.
     ZMQContextHandler::instances_.push_back(std::ref(*this));
@@ -91,7 +95,91 @@ ZMQContextHandler::~ZMQContextHandler()
 
 const std::unique_ptr<zmq::context_t>& ZMQContextHandler::getContext()
 {
-    return ZMQContextHandler::context_;
+    return this->dedicated_context_ ? this->dedicated_context_ : ZMQContextHandler::context_;
+}
+
+bool ZMQContextHandler::setGlobalContextConfig(const ZMQContextConfig &config)
+{
+    // Safety mutex.
+    std::lock_guard<std::mutex> lock(ZMQContextHandler::mtx_);
+
+    // The configuration can only be changed before creating the global context.
+    if (!ZMQContextHandler::instances_.empty())
+        return false;
+
+    // Validate the configuration (the context threads are not started until a socket is created).
+    ZMQContextHandler::createContext(config);
+    ZMQContextHandler::config_ = config;
+    return true;
+}
+
+ZMQContextConfig ZMQContextHandler::getGlobalContextConfig()
+{
+    std::lock_guard<std::mutex> lock(ZMQContextHandler::mtx_);
+    return ZMQContextHandler::config_;
+}
+
+bool ZMQContextHandler::setDedicatedContext(const ZMQContextConfig &config)
+{
+    // The sockets of a working component belong to the current context.
+    if (this->isContextInUse())
+        return false;
+
+    this->dedicated_context_ = ZMQContextHandler::createContext(config);
+    return true;
+}
+
+bool ZMQContextHandler::clearDedicatedContext()
+{
+    // The sockets of a working component belong to the current context.
+    if (this->isContextInUse())
+        return false;
+
+    this->dedicated_context_.reset();
+    return true;
+}
+
+bool ZMQContextHandler::isContextInUse() const
+{
+    return false;
+}
+
+bool ZMQContextHandler::hasDedicatedContext() const
+{
+    return this->dedicated_context_ != nullptr;
+}
+
+std::unique_ptr<zmq::context_t> ZMQContextHandler::createContext(const ZMQContextConfig &config)
+{
+    // Check the parameters.
+    if (config.io_threads < 0)
+        throw std::invalid_argument("[LibZMQUtils,ZMQContextHandler] The number of I/O threads can't be negative.");
+
+    // Create the context and apply the options. They must be set before creating any socket.
+    try
+    {
+        auto context = std::make_unique<zmq::context_t>(config.io_threads);
+        if (config.max_sockets > 0)
+            context->set(zmq::ctxopt::max_sockets, config.max_sockets);
+#ifdef ZMQ_THREAD_SCHED_POLICY
+        if (config.sched_policy >= 0)
+            context->set(zmq::ctxopt::thread_sched_policy, config.sched_policy);
+#endif
+#ifdef ZMQ_THREAD_PRIORITY
+        if (config.sched_priority >= 0)
+            context->set(zmq::ctxopt::thread_priority, config.sched_priority);
+#endif
+#ifdef ZMQ_THREAD_AFFINITY_CPU_ADD
+        for (int cpu : config.affinity_cpus)
+            context->set(zmq::ctxopt::thread_affinity_cpu_add, cpu);
+#endif
+        return context;
+    }
+    catch (const zmq::error_t& error)
+    {
+        throw std::invalid_argument(std::string("[LibZMQUtils,ZMQContextHandler] Invalid context configuration: ") +
+                                    error.what());
+    }
 }
 
 // =====================================================================================================================
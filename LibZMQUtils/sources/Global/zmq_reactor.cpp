@@ -0,0 +1,486 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file zmq_reactor.cpp
+ * @brief This file contains the implementation of the global ZMQReactor class.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <algorithm>
+#include <future>
+#include <stdexcept>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/zmq_reactor.h"
+#include "LibZMQUtils/Utilities/uuid_generator.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+// =====================================================================================================================
+
+ZMQReactor::ZMQReactor(unsigned executor_threads) :
+    last_id_(0),
+    flag_running_(false),
+    flag_exit_(false),
+    executor_threads_(executor_threads),
+    exec_exit_(false)
+{
+    // Default name of the threads.
+    this->thread_config_.name = "zmq-reactor";
+    for (unsigned i = 0; i < executor_threads; i++)
+        this->exec_cpu_clocks_.push_back(std::make_unique<utils::ThreadCpuClock>());
+}
+
+bool ZMQReactor::start()
+{
+    // Safety mutex.
+    std::lock_guard<std::mutex> lock(this->state_mtx_);
+
+    // Check if the reactor is already running.
+    if (this->flag_running_)
+        return true;
+
+    // Create the wake-up sockets. They are used to interrupt the poll when there are new tasks.
+    try
+    {
+        auto wake_endpoint = "inproc://reactor" +
+                             utils::UUIDGenerator::getInstance().generateUUIDv4().toRFC4122String();
+        this->wake_recv_socket_ = std::make_unique<zmq::socket_t>(*this->getContext().get(), zmq::socket_type::pair);
+        this->wake_recv_socket_->set(zmq::sockopt::linger, 0);
+        this->wake_recv_socket_->bind(wake_endpoint);
+        this->wake_send_socket_ = std::make_unique<zmq::socket_t>(*this->getContext().get(), zmq::socket_type::pair);
+        this->wake_send_socket_->set(zmq::sockopt::linger, 0);
+        this->wake_send_socket_->set(zmq::sockopt::sndhwm, 0);
+        this->wake_send_socket_->connect(wake_endpoint);
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->wake_recv_socket_.reset();
+        this->wake_send_socket_.reset();
+        this->onReactorError(error.what(), ZMQReactor::kScope + " Error during wake-up sockets creation.");
+        return false;
+    }
+
+    // Start the executor pool.
+    this->exec_exit_ = false;
+    for (unsigned i = 0; i < this->executor_threads_; i++)
+        this->executors_.emplace_back(&ZMQReactor::executorWorker, this, i);
+
+    // Start the loop thread. From now on the tasks are queued for it, and the wake-up receiving socket is used only by
+    // the loop thread (the sending socket is protected by the loop mutex).
+    this->flag_exit_ = false;
+    this->flag_running_ = true;
+    this->loop_th_ = std::thread([this]
+    {
+        this->loop_th_id_ = std::this_thread::get_id();
+        if (!utils::applyThreadConfig(this->thread_config_))
+            this->onReactorError(std::string(),
+                                 ZMQReactor::kScope + " The thread configuration was not fully applied.");
+        auto cpu_attachment = this->loop_cpu_clock_.attach();
+        this->loopWorker();
+    });
+    return true;
+}
+
+void ZMQReactor::stop()
+{
+    // Safety mutex.
+    std::lock_guard<std::mutex> lock(this->state_mtx_);
+
+    // Check if the reactor is running.
+    if (!this->flag_running_)
+        return;
+
+    // Stop the loop thread.
+    this->flag_exit_ = true;
+    this->wakeUp();
+    if (this->loop_th_.joinable())
+        this->loop_th_.join();
+    this->loop_th_id_ = std::thread::id();
+    this->flag_running_ = false;
+
+    // Stop the executor pool. The executors run the pending tasks before exiting.
+    {
+        std::lock_guard<std::mutex> exec_lock(this->exec_mtx_);
+        this->exec_exit_ = true;
+    }
+    this->exec_cv_.notify_all();
+    for (auto& executor : this->executors_)
+        executor.join();
+    this->executors_.clear();
+
+    // Delete the wake-up sockets. From now on the tasks run directly in the caller.
+    {
+        std::lock_guard<std::mutex> loop_lock(this->loop_mtx_);
+        this->wake_send_socket_.reset();
+        this->wake_recv_socket_.reset();
+    }
+
+    // Run the loop tasks that were queued while stopping.
+    this->runLoopTasks();
+}
+
+bool ZMQReactor::isRunning() const
+{
+    return this->flag_running_;
+}
+
+bool ZMQReactor::isContextInUse() const
+{
+    return this->isRunning();
+}
+
+bool ZMQReactor::isLoopThread() const
+{
+    return std::this_thread::get_id() == this->loop_th_id_.load();
+}
+
+unsigned ZMQReactor::getExecutorThreads() const
+{
+    return this->executor_threads_;
+}
+
+void ZMQReactor::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Only update the value if the reactor is stopped.
+    std::lock_guard<std::mutex> lock(this->state_mtx_);
+    if (!this->flag_running_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig ZMQReactor::getWorkerThreadConfig() const
+{
+    std::lock_guard<std::mutex> lock(this->state_mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds ZMQReactor::getWorkerCpuTime() const
+{
+    return this->loop_cpu_clock_.elapsed();
+}
+
+std::vector<std::chrono::nanoseconds> ZMQReactor::getExecutorsCpuTime() const
+{
+    std::vector<std::chrono::nanoseconds> times;
+    for (const auto& clock : this->exec_cpu_clocks_)
+        times.push_back(clock->elapsed());
+    return times;
+}
+
+ZMQReactor::HandlerId ZMQReactor::addSocket(zmq::socket_t &socket, Handler handler)
+{
+    auto entry = std::make_shared<SocketEntry>();
+    entry->socket = &socket;
+    entry->handler = std::move(handler);
+    entry->active = true;
+
+    HandlerId id;
+    {
+        std::lock_guard<std::mutex> lock(this->reg_mtx_);
+        id = ++this->last_id_;
+        this->sockets_.emplace(id, std::move(entry));
+    }
+
+    // The loop rebuilds the poll items on each iteration, so we only need to interrupt the current poll.
+    if (!this->isLoopThread())
+        this->wakeUp();
+    return id;
+}
+
+void ZMQReactor::removeSocket(HandlerId id)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->reg_mtx_);
+        auto it = this->sockets_.find(id);
+        if (it == this->sockets_.end())
+            return;
+        it->second->active = false;
+        this->sockets_.erase(it);
+    }
+
+    // Wait until the loop is not polling the removed socket anymore.
+    this->syncWithLoop();
+}
+
+ZMQReactor::HandlerId ZMQReactor::addTimer(std::chrono::milliseconds period, Handler handler)
+{
+    if (period.count() <= 0)
+        throw std::invalid_argument(ZMQReactor::kScope + " The timer period must be greater than zero.");
+
+    auto entry = std::make_shared<TimerEntry>();
+    entry->period = period;
+    entry->next_tp = std::chrono::steady_clock::now() + period;
+    entry->handler = std::move(handler);
+    entry->active = true;
+
+    HandlerId id;
+    {
+        std::lock_guard<std::mutex> lock(this->reg_mtx_);
+        id = ++this->last_id_;
+        this->timers_.emplace(id, std::move(entry));
+    }
+
+    // Interrupt the current poll, so the new timeout is used.
+    if (!this->isLoopThread())
+        this->wakeUp();
+    return id;
+}
+
+void ZMQReactor::removeTimer(HandlerId id)
+{
+    {
+        std::lock_guard<std::mutex> lock(this->reg_mtx_);
+        auto it = this->timers_.find(id);
+        if (it == this->timers_.end())
+            return;
+        it->second->active = false;
+        this->timers_.erase(it);
+    }
+
+    // Wait until the loop is not running the removed timer.
+    this->syncWithLoop();
+}
+
+void ZMQReactor::execute(const Task &task)
+{
+    // Run directly if we are in the loop thread or if there is no loop.
+    if (this->isLoopThread() || !this->flag_running_)
+    {
+        task();
+        return;
+    }
+
+    // Queue the task and wait for it. The exceptions are propagated to the caller.
+    auto packaged = std::make_shared<std::packaged_task<void()>>(task);
+    std::future<void> fut = packaged->get_future();
+    this->post([packaged]{ (*packaged)(); });
+    fut.get();
+}
+
+void ZMQReactor::post(Task task)
+{
+    // Queue the task. If there is no loop, run it directly.
+    {
+        std::lock_guard<std::mutex> lock(this->loop_mtx_);
+        if (this->wake_send_socket_)
+        {
+            this->loop_tasks_.push_back(std::move(task));
+            this->wake_send_socket_->send(zmq::message_t(), zmq::send_flags::dontwait);
+            return;
+        }
+    }
+    this->runSafe(task, ZMQReactor::kScope + " Error running a posted task.");
+}
+
+void ZMQReactor::submit(Task task)
+{
+    // Without executors, the task runs in the loop thread.
+    if (0 == this->executor_threads_)
+    {
+        this->post(std::move(task));
+        return;
+    }
+
+    // Queue the task for the executors. If there are no executors running, run it directly.
+    {
+        std::lock_guard<std::mutex> lock(this->exec_mtx_);
+        if (!this->executors_.empty() && !this->exec_exit_)
+        {
+            this->exec_tasks_.push_back(std::move(task));
+            this->exec_cv_.notify_one();
+            return;
+        }
+    }
+    this->runSafe(task, ZMQReactor::kScope + " Error running a submitted task.");
+}
+
+ZMQReactor::~ZMQReactor()
+{
+    this->stop();
+}
+
+void ZMQReactor::onReactorError(const std::string &, const std::string &)
+{}
+
+void ZMQReactor::loopWorker()
+{
+    std::vector<zmq::pollitem_t> items;
+    std::vector<std::shared_ptr<SocketEntry>> sockets;
+    std::vector<std::shared_ptr<TimerEntry>> timers;
+
+    while (true)
+    {
+        // Run the pending tasks. They can change the registrations.
+        this->runLoopTasks();
+        if (this->flag_exit_)
+            break;
+
+        // Build the poll items and get the time until the next timer.
+        items.clear();
+        sockets.clear();
+        timers.clear();
+        auto now = std::chrono::steady_clock::now();
+        std::chrono::milliseconds timeout(-1);
+        items.push_back({static_cast<void*>(*this->wake_recv_socket_), 0, ZMQ_POLLIN, 0});
+        {
+            std::lock_guard<std::mutex> lock(this->reg_mtx_);
+            for (const auto& socket : this->sockets_)
+            {
+                items.push_back({static_cast<void*>(*socket.second->socket), 0, ZMQ_POLLIN, 0});
+                sockets.push_back(socket.second);
+            }
+            for (const auto& timer : this->timers_)
+            {
+                auto remaining = std::chrono::ceil<std::chrono::milliseconds>(timer.second->next_tp - now);
+                remaining = std::max(remaining, std::chrono::milliseconds(0));
+                timeout = (timeout.count() < 0) ? remaining : std::min(timeout, remaining);
+                timers.push_back(timer.second);
+            }
+        }
+
+        // Wait for the sockets, the timers or a wake-up.
+        try
+        {
+            zmq::poll(items.data(), items.size(), timeout);
+        }
+        catch (const zmq::error_t& error)
+        {
+            if (error.num() == EINTR)
+                continue;
+            this->onReactorError(error.what(), ZMQReactor::kScope + " Error while polling the sockets.");
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            continue;
+        }
+
+        // Discard the wake-up messages.
+        if (items[0].revents & ZMQ_POLLIN)
+        {
+            zmq::message_t msg;
+            while (this->wake_recv_socket_->recv(msg, zmq::recv_flags::dontwait))
+            {}
+        }
+
+        // Call the handlers of the readable sockets. A handler can remove other sockets, so check the active flag.
+        for (std::size_t i = 0; i < sockets.size(); i++)
+        {
+            if ((items[i + 1].revents & ZMQ_POLLIN) && sockets[i]->active)
+                this->runSafe(sockets[i]->handler, ZMQReactor::kScope + " Error in a socket handler.");
+        }
+
+        // Call the handlers of the expired timers. If the loop is late, the lost periods are skipped.
+        now = std::chrono::steady_clock::now();
+        for (const auto& timer : timers)
+        {
+            if (!timer->active || now < timer->next_tp)
+                continue;
+            timer->next_tp += timer->period;
+            if (timer->next_tp <= now)
+                timer->next_tp = now + timer->period;
+            this->runSafe(timer->handler, ZMQReactor::kScope + " Error in a timer handler.");
+        }
+    }
+}
+
+void ZMQReactor::executorWorker(std::size_t index)
+{
+    // Apply the thread configuration and measure the CPU time of the executor.
+    if (!utils::applyThreadConfig(this->thread_config_, "/" + std::to_string(index)))
+        this->onReactorError(std::string(), ZMQReactor::kScope + " The thread configuration of the executor " +
+                             std::to_string(index) + " was not fully applied.");
+    auto cpu_attachment = this->exec_cpu_clocks_[index]->attach();
+
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(this->exec_mtx_);
+            this->exec_cv_.wait(lock, [this]{ return this->exec_exit_ || !this->exec_tasks_.empty(); });
+            if (this->exec_tasks_.empty())
+                return;
+            task = std::move(this->exec_tasks_.front());
+            this->exec_tasks_.pop_front();
+        }
+        this->runSafe(task, ZMQReactor::kScope + " Error running a submitted task.");
+    }
+}
+
+void ZMQReactor::runLoopTasks()
+{
+    std::deque<Task> tasks;
+    {
+        std::lock_guard<std::mutex> lock(this->loop_mtx_);
+        tasks.swap(this->loop_tasks_);
+    }
+    for (const auto& task : tasks)
+        this->runSafe(task, ZMQReactor::kScope + " Error running a posted task.");
+}
+
+void ZMQReactor::wakeUp()
+{
+    std::lock_guard<std::mutex> lock(this->loop_mtx_);
+    if (this->wake_send_socket_)
+        this->wake_send_socket_->send(zmq::message_t(), zmq::send_flags::dontwait);
+}
+
+void ZMQReactor::syncWithLoop()
+{
+    // The tasks run at the start of each iteration, before building the poll items, so when an empty task has run
+    // the loop has finished the previous iteration and will not use the removed registrations anymore.
+    if (!this->isLoopThread())
+        this->execute([]{});
+}
+
+void ZMQReactor::runSafe(const Task &task, const std::string &ext_info)
+{
+    try
+    {
+        task();
+    }
+    catch (const std::exception& error)
+    {
+        this->onReactorError(error.what(), ext_info);
+    }
+}
+
+} // END NAMESPACES.
+// =====================================================================================================================
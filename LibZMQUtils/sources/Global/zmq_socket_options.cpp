@@ -0,0 +1,137 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file zmq_socket_options.cpp
+ * @brief This file contains the implementation of the global SocketOptions struct and its presets.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Global/zmq_socket_options.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+
+SocketOptions SocketOptions::lowLatency()
+{
+    SocketOptions options;
+    options.snd_hwm = 100;
+    options.rcv_hwm = 100;
+    options.immediate = 1;
+    options.tcp_keepalive = 1;
+    options.tcp_keepalive_idle = 5;
+    options.tcp_keepalive_intvl = 1;
+    options.tcp_keepalive_cnt = 3;
+    options.tos = 0xB8;  // DSCP EF (expedited forwarding).
+    return options;
+}
+
+SocketOptions SocketOptions::bulk()
+{
+    SocketOptions options;
+    options.snd_hwm = 100000;
+    options.rcv_hwm = 100000;
+    options.snd_buf = 4 * 1024 * 1024;
+    options.rcv_buf = 4 * 1024 * 1024;
+    options.backlog = 1024;
+    options.tos = 0x28;  // DSCP AF11 (high throughput data).
+    return options;
+}
+
+SocketOptions SocketOptions::constrainedLink()
+{
+    SocketOptions options;
+    options.snd_hwm = 1000;
+    options.rcv_hwm = 1000;
+    options.snd_buf = 64 * 1024;
+    options.rcv_buf = 64 * 1024;
+    options.immediate = 1;
+    options.tcp_keepalive = 1;
+    options.tcp_keepalive_idle = 30;
+    options.tcp_keepalive_intvl = 10;
+    options.tcp_keepalive_cnt = 5;
+    return options;
+}
+
+void applySocketOptions(zmq::socket_t& socket, const SocketOptions& options)
+{
+    if (options.snd_hwm >= 0)
+        socket.set(zmq::sockopt::sndhwm, options.snd_hwm);
+    if (options.rcv_hwm >= 0)
+        socket.set(zmq::sockopt::rcvhwm, options.rcv_hwm);
+    if (options.snd_buf >= 0)
+        socket.set(zmq::sockopt::sndbuf, options.snd_buf);
+    if (options.rcv_buf >= 0)
+        socket.set(zmq::sockopt::rcvbuf, options.rcv_buf);
+    if (options.tcp_keepalive >= 0)
+        socket.set(zmq::sockopt::tcp_keepalive, options.tcp_keepalive);
+    if (options.tcp_keepalive_idle >= 0)
+        socket.set(zmq::sockopt::tcp_keepalive_idle, options.tcp_keepalive_idle);
+    if (options.tcp_keepalive_intvl >= 0)
+        socket.set(zmq::sockopt::tcp_keepalive_intvl, options.tcp_keepalive_intvl);
+    if (options.tcp_keepalive_cnt >= 0)
+        socket.set(zmq::sockopt::tcp_keepalive_cnt, options.tcp_keepalive_cnt);
+    if (options.immediate >= 0)
+        socket.set(zmq::sockopt::immediate, options.immediate);
+    if (options.tos >= 0)
+        socket.set(zmq::sockopt::tos, options.tos);
+    if (options.backlog >= 0)
+        socket.set(zmq::sockopt::backlog, options.backlog);
+}
+
+SocketOptions readSocketOptions(zmq::socket_t& socket)
+{
+    SocketOptions options;
+    options.snd_hwm = socket.get(zmq::sockopt::sndhwm);
+    options.rcv_hwm = socket.get(zmq::sockopt::rcvhwm);
+    options.snd_buf = socket.get(zmq::sockopt::sndbuf);
+    options.rcv_buf = socket.get(zmq::sockopt::rcvbuf);
+    options.tcp_keepalive = socket.get(zmq::sockopt::tcp_keepalive);
+    options.tcp_keepalive_idle = socket.get(zmq::sockopt::tcp_keepalive_idle);
+    options.tcp_keepalive_intvl = socket.get(zmq::sockopt::tcp_keepalive_intvl);
+    options.tcp_keepalive_cnt = socket.get(zmq::sockopt::tcp_keepalive_cnt);
+    options.immediate = socket.get(zmq::sockopt::immediate);
+    options.tos = socket.get(zmq::sockopt::tos);
+    options.backlog = socket.get(zmq::sockopt::backlog);
+    return options;
+}
+
+} // END NAMESPACES.
+// =====================================================================================================================
@@ -43,8 +43,12 @@
 // =====================================================================================================================
 #if defined(WINDOWS) || defined(_WIN32)
 #include <direct.h>
+#include <windows.h>
 #define GetCurrentDir _getcwd
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <unistd.h>
 #define GetCurrentDir getcwd
 #endif
@@ -53,6 +57,7 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <string>
+#include <fstream>
 // =====================================================================================================================
 
 // LIBDPSLR INCLUDES
@@ -89,5 +94,159 @@ std::string getFileName(const std::string &filepath)
     return filepath;
 }
 
+bool fileExists(const std::string &file_path)
+{
+    std::ifstream file(file_path);
+    return file.good();
+}
+
+MemoryMappedFile::MemoryMappedFile() :
+    data_(nullptr),
+    size_(0),
+    file_(nullptr),
+    mapping_(nullptr),
+    fd_(-1)
+{}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    this->close();
+}
+
+bool MemoryMappedFile::openWrite(const std::string &file_path, std::size_t size)
+{
+    this->close();
+    if (0 == size)
+        return false;
+
+#if defined(WINDOWS) || defined(_WIN32)
+    HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, nullptr,
+                              CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == file)
+        return false;
+    LARGE_INTEGER li_size;
+    li_size.QuadPart = static_cast<LONGLONG>(size);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READWRITE, li_size.HighPart, li_size.LowPart, nullptr);
+    void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, size) : nullptr;
+    if (!data)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    this->file_ = file;
+    this->mapping_ = mapping;
+#else
+    int fd = ::open(file_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0)
+        return false;
+    if (::ftruncate(fd, static_cast<off_t>(size)) != 0)
+    {
+        ::close(fd);
+        return false;
+    }
+    void* data = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == data)
+    {
+        ::close(fd);
+        return false;
+    }
+    this->fd_ = fd;
+#endif
+
+    this->data_ = static_cast<std::byte*>(data);
+    this->size_ = size;
+    return true;
+}
+
+bool MemoryMappedFile::openRead(const std::string &file_path)
+{
+    this->close();
+
+#if defined(WINDOWS) || defined(_WIN32)
+    HANDLE file = CreateFileA(file_path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (INVALID_HANDLE_VALUE == file)
+        return false;
+    LARGE_INTEGER li_size;
+    if (!GetFileSizeEx(file, &li_size) || 0 == li_size.QuadPart)
+    {
+        CloseHandle(file);
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(li_size.QuadPart);
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    void* data = mapping ? MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, size) : nullptr;
+    if (!data)
+    {
+        if (mapping)
+            CloseHandle(mapping);
+        CloseHandle(file);
+        return false;
+    }
+    this->file_ = file;
+    this->mapping_ = mapping;
+#else
+    int fd = ::open(file_path.c_str(), O_RDONLY);
+    if (fd < 0)
+        return false;
+    struct stat st;
+    if (::fstat(fd, &st) != 0 || 0 == st.st_size)
+    {
+        ::close(fd);
+        return false;
+    }
+    std::size_t size = static_cast<std::size_t>(st.st_size);
+    void* data = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    if (MAP_FAILED == data)
+    {
+        ::close(fd);
+        return false;
+    }
+    this->fd_ = fd;
+#endif
+
+    this->data_ = static_cast<std::byte*>(data);
+    this->size_ = size;
+    return true;
+}
+
+void MemoryMappedFile::close()
+{
+    if (!this->data_)
+        return;
+
+#if defined(WINDOWS) || defined(_WIN32)
+    UnmapViewOfFile(this->data_);
+    CloseHandle(static_cast<HANDLE>(this->mapping_));
+    CloseHandle(static_cast<HANDLE>(this->file_));
+    this->mapping_ = nullptr;
+    this->file_ = nullptr;
+#else
+    ::munmap(this->data_, this->size_);
+    ::close(this->fd_);
+    this->fd_ = -1;
+#endif
+
+    this->data_ = nullptr;
+    this->size_ = 0;
+}
+
+bool MemoryMappedFile::isOpen() const
+{
+    return this->data_ != nullptr;
+}
+
+std::byte *MemoryMappedFile::data() const
+{
+    return this->data_;
+}
+
+std::size_t MemoryMappedFile::size() const
+{
+    return this->size_;
+}
+
 }}} // END NAMESPACES
 // =====================================================================================================================
@@ -0,0 +1,159 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file zmq_helpers.cpp
+ * @brief This file contains the implementation of several helper tools related with ZeroMQ messages and sockets.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <cstdint>
+#include <cstring>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/InternalHelpers/zmq_helpers.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace internal_helpers{
+namespace zmq_helpers{
+// =====================================================================================================================
+
+bool isUdpEndpoint(const std::string &endpoint)
+{
+    return endpoint.compare(0, 6, "udp://") == 0;
+}
+
+bool isLocalEndpoint(const std::string &endpoint)
+{
+    return endpoint.compare(0, 6, "ipc://") == 0 || endpoint.compare(0, 9, "inproc://") == 0;
+}
+
+unsigned endpointPort(const std::string &endpoint)
+{
+    // Local endpoints can contain ':' in the path or name, but they have no port.
+    if (isLocalEndpoint(endpoint))
+        return 0;
+
+    // Parse the digits after the last ':'.
+    std::size_t pos = endpoint.rfind(':');
+    if (pos == std::string::npos || pos + 1 == endpoint.size())
+        return 0;
+    unsigned port = 0;
+    for (std::size_t i = pos + 1; i < endpoint.size(); i++)
+    {
+        if (endpoint[i] < '0' || endpoint[i] > '9')
+            return 0;
+        port = port * 10 + static_cast<unsigned>(endpoint[i] - '0');
+        if (port > 65535)
+            return 0;
+    }
+    return port;
+}
+
+std::string topicToGroup(std::string_view topic)
+{
+    return std::string(topic.substr(0, kMaxGroupLength));
+}
+
+zmq::message_t packMultipart(const zmq::multipart_t &multipart)
+{
+    // Calculate the size.
+    std::size_t size = 0;
+    for (const auto& part : multipart)
+        size += 4 + part.size();
+
+    // Pack each part.
+    zmq::message_t packed(size);
+    auto* out = static_cast<unsigned char*>(packed.data());
+    for (const auto& part : multipart)
+    {
+        std::uint32_t part_size = static_cast<std::uint32_t>(part.size());
+        out[0] = static_cast<unsigned char>((part_size >> 24) & 0xFF);
+        out[1] = static_cast<unsigned char>((part_size >> 16) & 0xFF);
+        out[2] = static_cast<unsigned char>((part_size >> 8) & 0xFF);
+        out[3] = static_cast<unsigned char>(part_size & 0xFF);
+        if (part_size > 0)
+            std::memcpy(out + 4, part.data(), part_size);
+        out += 4 + part_size;
+    }
+
+    return packed;
+}
+
+bool unpackMultipart(const zmq::message_t &packed, zmq::multipart_t &multipart)
+{
+    const auto* in = static_cast<const unsigned char*>(packed.data());
+    std::size_t remaining = packed.size();
+
+    while (remaining > 0)
+    {
+        // Get the part size.
+        if (remaining < 4)
+            return false;
+        std::size_t part_size = (static_cast<std::size_t>(in[0]) << 24) | (static_cast<std::size_t>(in[1]) << 16) |
+                                (static_cast<std::size_t>(in[2]) << 8) | static_cast<std::size_t>(in[3]);
+        in += 4;
+        remaining -= 4;
+
+        // Get the part data.
+        if (remaining < part_size)
+            return false;
+        multipart.addmem(in, part_size);
+        in += part_size;
+        remaining -= part_size;
+    }
+
+    return true;
+}
+
+zmq::message_t makeSharedMessage(const std::shared_ptr<const std::byte[]> &bytes, std::size_t size)
+{
+    // The message hint is a new reference to the buffer, which is deleted by ZMQ when the message is released.
+    auto* ref = new std::shared_ptr<const std::byte[]>(bytes);
+    return zmq::message_t(const_cast<std::byte*>(ref->get()), size, [](void*, void* hint)
+    {
+        delete static_cast<std::shared_ptr<const std::byte[]>*>(hint);
+    }, ref);
+}
+
+}}} // END NAMESPACES.
+// =====================================================================================================================
@@ -0,0 +1,593 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file broker_base.cpp
+ * @brief This file contains the implementation of the BrokerBase class and related.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <array>
+#include <string>
+// =====================================================================================================================
+
+// ZMQ INCLUDES
+// =====================================================================================================================
+#include <zmq.hpp>
+#include <zmq_addon.hpp>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/PublisherSubscriber/broker/broker_base.h"
+#include "LibZMQUtils/PublisherSubscriber/subscriber/subscriber_base.h"
+#include "LibZMQUtils/Utilities/uuid_generator.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+// BROKER CONTROL COMMANDS
+// =====================================================================================================================
+
+/// Commands that can be sent to the broker worker through the internal control socket.
+enum class BrokerBase::ControlCommand : std::uint8_t
+{
+    EXIT,        ///< Finish the worker.
+    CONNECT,     ///< Connect the publishers socket to a new publisher.
+    DISCONNECT   ///< Disconnect the publishers socket from a publisher.
+};
+
+// =====================================================================================================================
+
+BrokerBase::BrokerBase(unsigned broker_port, const std::string &broker_iface, const std::string &broker_name) :
+    xsub_socket_(nullptr),
+    xpub_socket_(nullptr),
+    recv_ctrl_socket_(nullptr),
+    req_ctrl_socket_(nullptr),
+    name_(broker_name),
+    flag_working_(false),
+    flag_capture_(false)
+{
+    // Check the port.
+    if (0 == broker_port)
+        throw std::invalid_argument(this->kScope + " The broker port can't be zero.");
+
+    // Prepare the subscribers endpoint.
+    this->endpoint_ = "tcp://" + broker_iface + ":" + std::to_string(broker_port);
+
+    // Default name of the worker thread.
+    this->thread_config_.name = "zmq-broker";
+}
+
+bool BrokerBase::startBroker()
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->broker_mtx_);
+
+    // If worker is already started, do nothing
+    if (this->flag_working_)
+        return true;
+
+    // Try creating the sockets.
+    try
+    {
+        // Control mutex lock (publishers).
+        std::lock_guard<std::mutex> ctrl_lock(this->ctrl_mtx_);
+
+        // Create the XPUB socket for the subscribers.
+        this->xpub_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::xpub);
+        this->xpub_socket_->set(zmq::sockopt::linger, 0);
+        this->xpub_socket_->bind(this->endpoint_);
+
+        // Create the XSUB socket and connect to the publishers.
+        this->xsub_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::xsub);
+        this->xsub_socket_->set(zmq::sockopt::linger, 0);
+        for (const auto& endpoint : this->publishers_)
+            this->xsub_socket_->connect(endpoint);
+
+        // Create the internal control sockets.
+        utils::UUID ctrl_uuid = utils::UUIDGenerator::getInstance().generateUUIDv4();
+        auto ctrl_endpoint = "inproc://brokerctrl" + ctrl_uuid.toRFC4122String();
+        this->recv_ctrl_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pair);
+        this->recv_ctrl_socket_->set(zmq::sockopt::linger, 0);
+        this->recv_ctrl_socket_->bind(ctrl_endpoint);
+        this->req_ctrl_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pair);
+        this->req_ctrl_socket_->set(zmq::sockopt::linger, 0);
+        this->req_ctrl_socket_->connect(ctrl_endpoint);
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->deleteSockets();
+        this->onBrokerError(error, this->kScope + " Error during socket creation.");
+        return false;
+    }
+
+    // Launch the worker in other thread. The sockets are only used by the worker from now on.
+    this->flag_working_ = true;
+    this->worker_th_ = std::thread(&BrokerBase::brokerWorker, this);
+
+    // Call to the internal callback.
+    this->onBrokerStart();
+    return true;
+}
+
+void BrokerBase::stopBroker()
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->broker_mtx_);
+
+    // If worker is already stopped, do nothing.
+    if (!this->flag_working_)
+        return;
+
+    // Call to the internal stop and to the internal callback.
+    this->internalStopBroker();
+    this->onBrokerStop();
+}
+
+bool BrokerBase::isWorking() const
+{
+    return this->flag_working_;
+}
+
+bool BrokerBase::isContextInUse() const
+{
+    return this->isWorking();
+}
+
+const std::string &BrokerBase::getEndpoint() const
+{
+    return this->endpoint_;
+}
+
+const std::string &BrokerBase::getName() const
+{
+    return this->name_;
+}
+
+void BrokerBase::addPublisher(const std::string &pub_endpoint)
+{
+    // Check the publisher endpoint.
+    if(pub_endpoint.empty())
+        throw std::invalid_argument(this->kScope + " The publisher endpoint can't be empty.");
+
+    // Control mutex lock.
+    std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+
+    // Store the publisher. If the broker is working, connect the socket. If it fails, discard the publisher.
+    if (this->publishers_.insert(pub_endpoint).second &&
+        !this->sendCtrlCommand(ControlCommand::CONNECT, pub_endpoint))
+        this->publishers_.erase(pub_endpoint);
+}
+
+void BrokerBase::removePublisher(const std::string &pub_endpoint)
+{
+    // Control mutex lock.
+    std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+
+    // Erase the publisher. If the broker is working, disconnect the socket.
+    if (this->publishers_.erase(pub_endpoint) > 0)
+        this->sendCtrlCommand(ControlCommand::DISCONNECT, pub_endpoint);
+}
+
+std::set<std::string> BrokerBase::getPublishers() const
+{
+    std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+    return this->publishers_;
+}
+
+void BrokerBase::setCaptureEnabled(bool enabled)
+{
+    this->flag_capture_ = enabled;
+}
+
+bool BrokerBase::getCaptureEnabled() const
+{
+    return this->flag_capture_;
+}
+
+BrokerStats BrokerBase::getStats() const
+{
+    std::lock_guard<std::mutex> lock(this->stats_mtx_);
+    return this->stats_;
+}
+
+void BrokerBase::resetStats()
+{
+    std::lock_guard<std::mutex> lock(this->stats_mtx_);
+    this->stats_ = BrokerStats();
+}
+
+void BrokerBase::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->broker_mtx_);
+
+    // Only update the value if the broker is stopped.
+    if (!this->flag_working_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig BrokerBase::getWorkerThreadConfig() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->broker_mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds BrokerBase::getWorkerCpuTime() const
+{
+    return this->worker_cpu_clock_.elapsed();
+}
+
+BrokerBase::~BrokerBase()
+{
+    // Stop the broker.
+    // Warning: In this case the onBrokerStop callback can't be executed.
+    std::unique_lock<std::shared_mutex> lock(this->broker_mtx_);
+    this->internalStopBroker();
+}
+
+void BrokerBase::brokerWorker()
+{
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_))
+        this->onBrokerError(zmq::error_t(), this->kScope + " The thread configuration was not fully applied.");
+    auto cpu_attachment = this->worker_cpu_clock_.attach();
+
+    // Poller items for the publishers socket, the subscribers socket and the control socket.
+    std::array<zmq::pollitem_t, 3> items = {{
+        { static_cast<void*>(*this->xsub_socket_),      0, ZMQ_POLLIN, 0 },
+        { static_cast<void*>(*this->xpub_socket_),      0, ZMQ_POLLIN, 0 },
+        { static_cast<void*>(*this->recv_ctrl_socket_), 0, ZMQ_POLLIN, 0 }}};
+
+    // Worker loop. It finishes only with the exit command, so pending control commands are always answered.
+    while (true)
+    {
+        try
+        {
+            // Wait for messages, subscriptions or control commands.
+            zmq::poll(items.data(), items.size(), std::chrono::milliseconds(-1));
+
+            // Process the control commands.
+            if ((items[2].revents & ZMQ_POLLIN) && this->processCtrlCommand())
+                break;
+
+            // Forward the subscriptions upstream.
+            if (items[1].revents & ZMQ_POLLIN)
+                this->forwardSubscription();
+
+            // Forward the messages downstream.
+            if (items[0].revents & ZMQ_POLLIN)
+                this->forwardMessage();
+        }
+        catch (const zmq::error_t& error)
+        {
+            // Interrupted system call, try again.
+            if (error.num() == EINTR)
+                continue;
+
+            // Else, call to error callback and finish the worker.
+            this->onBrokerError(error, this->kScope + " Error while forwarding the messages.");
+            break;
+        }
+    }
+}
+
+void BrokerBase::forwardMessage()
+{
+    // Containers.
+    std::uint64_t bytes = 0;
+    zmq::multipart_t announcement;
+    bool is_announcement = false;
+
+    if (this->flag_capture_)
+    {
+        // Receive the complete message, call to the capture callback and forward it.
+        zmq::multipart_t msg;
+        msg.recv(*this->xsub_socket_);
+        if (msg.empty())
+            return;
+        this->topic_buffer_.assign(static_cast<const char*>(msg.front().data()), msg.front().size());
+        this->uuid_buffer_.clear();
+        if (msg.size() > 1)
+            this->uuid_buffer_.assign(static_cast<const char*>(msg[1].data()), msg[1].size());
+        is_announcement = (this->topic_buffer_ == kReservedTopicTopicIds);
+        if (is_announcement)
+            announcement = msg.clone();
+        for (const auto& part : msg)
+            bytes += part.size();
+        this->onMsgCaptured(this->topic_buffer_, msg);
+        msg.send(*this->xpub_socket_);
+    }
+    else
+    {
+        // Forward the message frame by frame (the frames are moved, not copied). Only the topic identifiers
+        // announcements are copied, since they must be decoded after forwarding them.
+        zmq::message_t frame;
+        std::size_t idx = 0;
+        bool more = true;
+        while (more)
+        {
+            if (!this->xsub_socket_->recv(frame))
+                return;
+            more = frame.more();
+            bytes += frame.size();
+            if (0 == idx)
+            {
+                this->topic_buffer_.assign(static_cast<const char*>(frame.data()), frame.size());
+                this->uuid_buffer_.clear();
+                is_announcement = (this->topic_buffer_ == kReservedTopicTopicIds);
+            }
+            else if (1 == idx)
+                this->uuid_buffer_.assign(static_cast<const char*>(frame.data()), frame.size());
+            if (is_announcement)
+                announcement.addmem(frame.data(), frame.size());
+            idx++;
+            this->xpub_socket_->send(frame, more ? zmq::send_flags::sndmore : zmq::send_flags::none);
+        }
+    }
+
+    // Store the topic identifiers announced by the publisher.
+    if (is_announcement)
+        this->processTopicIdsAnnouncement(announcement);
+
+    // Resolve the topic identifier using the announcements of the publisher.
+    std::string_view topic(this->topic_buffer_);
+    bool tracked = true;
+    TopicId topic_id;
+    if (parseTopicIdFrame(topic, topic_id))
+    {
+        auto ids_it = this->topic_ids_.find(std::string_view(this->uuid_buffer_));
+        tracked = (ids_it != this->topic_ids_.end() && topic_id < ids_it->second.size() &&
+                   !ids_it->second[topic_id].empty());
+        if (tracked)
+            topic = ids_it->second[topic_id];
+    }
+
+    // Update the statistics. The topic buffer avoids allocations for the already known topics, and the number of
+    // topics is limited.
+    std::lock_guard<std::mutex> lock(this->stats_mtx_);
+    this->stats_.msgs++;
+    this->stats_.bytes += bytes;
+    auto it = tracked ? this->stats_.topics.find(topic) : this->stats_.topics.end();
+    if (tracked && it == this->stats_.topics.end() && this->stats_.topics.size() < kMaxBrokerTopicStats)
+        it = this->stats_.topics.emplace(TopicType(topic), TopicTrafficStats()).first;
+    if (it == this->stats_.topics.end())
+    {
+        this->stats_.untracked_msgs++;
+        return;
+    }
+    it->second.msgs++;
+    it->second.bytes += bytes;
+}
+
+void BrokerBase::forwardSubscription()
+{
+    // Receive the subscription message (first byte 1 for subscribe or 0 for unsubscribe, then the topic).
+    zmq::message_t msg;
+    if (!this->xpub_socket_->recv(msg))
+        return;
+
+    // Update the statistics and call to the internal callback.
+    const auto* data = static_cast<const char*>(msg.data());
+    if (msg.size() > 0 && (data[0] == 0 || data[0] == 1))
+    {
+        bool subscribed = (data[0] == 1);
+        TopicType topic(data + 1, msg.size() - 1);
+        {
+            std::lock_guard<std::mutex> lock(this->stats_mtx_);
+            if (subscribed)
+            {
+                // The identifier frames are not accounted by topic, and the number of topics is limited.
+                TopicId topic_id;
+                this->stats_.subscriptions++;
+                auto it = this->stats_.topics.find(topic);
+                if (it == this->stats_.topics.end() && !parseTopicIdFrame(topic, topic_id) &&
+                    this->stats_.topics.size() < kMaxBrokerTopicStats)
+                    it = this->stats_.topics.emplace(topic, TopicTrafficStats()).first;
+                if (it != this->stats_.topics.end())
+                    it->second.subscriptions++;
+            }
+            else
+                this->stats_.unsubscriptions++;
+        }
+        this->onSubscriptionChanged(topic, subscribed);
+    }
+
+    // Forward the subscription to the publishers.
+    this->xsub_socket_->send(msg, zmq::send_flags::none);
+}
+
+void BrokerBase::processTopicIdsAnnouncement(zmq::multipart_t &frames)
+{
+    // Decode the announcement and merge it into the table of the publisher.
+    PublishedMessage msg;
+    bool is_topic_id;
+    TopicId topic_id;
+    if (SubscriberBase::decodeMessage(frames, msg, is_topic_id, topic_id) == OperationResult::OPERATION_OK)
+        mergeTopicIdsAnnouncement(msg, this->topic_ids_[this->uuid_buffer_]);
+}
+
+void BrokerBase::internalStopBroker()
+{
+    // If worker is already stopped, do nothing.
+    if (!this->flag_working_)
+        return;
+
+    // Set the shared working flag to false (is atomic).
+    this->flag_working_ = false;
+
+    // Send the exit command through the control socket. The worker does not reply to this command.
+    {
+        std::lock_guard<std::mutex> ctrl_lock(this->ctrl_mtx_);
+        zmq::multipart_t ctrl_msg;
+        ctrl_msg.addtyp(ControlCommand::EXIT);
+        ctrl_msg.addstr(std::string());
+        ctrl_msg.send(*this->req_ctrl_socket_);
+    }
+
+    // Wait the worker.
+    if (this->worker_th_.joinable())
+        this->worker_th_.join();
+
+    // Delete the sockets.
+    this->deleteSockets();
+}
+
+void BrokerBase::deleteSockets()
+{
+    if (this->xsub_socket_)
+    {
+        delete this->xsub_socket_;
+        this->xsub_socket_ = nullptr;
+    }
+
+    if (this->xpub_socket_)
+    {
+        delete this->xpub_socket_;
+        this->xpub_socket_ = nullptr;
+    }
+
+    if (this->recv_ctrl_socket_)
+    {
+        delete this->recv_ctrl_socket_;
+        this->recv_ctrl_socket_ = nullptr;
+    }
+
+    if (this->req_ctrl_socket_)
+    {
+        delete this->req_ctrl_socket_;
+        this->req_ctrl_socket_ = nullptr;
+    }
+}
+
+bool BrokerBase::sendCtrlCommand(ControlCommand command, const std::string &arg)
+{
+    // If the broker is not working, the change will be applied when starting.
+    if (!this->flag_working_)
+        return true;
+
+    // If we are in the worker thread (for example, inside a callback), apply the change directly.
+    if (std::this_thread::get_id() == this->worker_th_.get_id())
+        return this->applyCtrlCommand(command, arg);
+
+    // Send the command to the worker and wait for the result.
+    try
+    {
+        zmq::multipart_t ctrl_msg;
+        ctrl_msg.addtyp(command);
+        ctrl_msg.addstr(arg);
+        ctrl_msg.send(*this->req_ctrl_socket_);
+        zmq::multipart_t ctrl_reply;
+        ctrl_reply.recv(*this->req_ctrl_socket_);
+        return ctrl_reply.poptyp<bool>();
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->onBrokerError(error, this->kScope + " Error while sending a control command.");
+        return false;
+    }
+}
+
+bool BrokerBase::processCtrlCommand()
+{
+    // Receive the command. The messages come from our own control socket, so they are always well formed.
+    zmq::multipart_t ctrl_msg;
+    ctrl_msg.recv(*this->recv_ctrl_socket_);
+    ControlCommand command = ctrl_msg.poptyp<ControlCommand>();
+    std::string arg = ctrl_msg.popstr();
+
+    // Exit command case. No reply is necessary.
+    if (ControlCommand::EXIT == command)
+        return true;
+
+    // Apply the command and send the result.
+    zmq::multipart_t ctrl_reply;
+    ctrl_reply.addtyp(this->applyCtrlCommand(command, arg));
+    ctrl_reply.send(*this->recv_ctrl_socket_);
+
+    // Continue working.
+    return false;
+}
+
+bool BrokerBase::applyCtrlCommand(ControlCommand command, const std::string &arg)
+{
+    try
+    {
+        switch (command)
+        {
+        case ControlCommand::CONNECT:
+            this->xsub_socket_->connect(arg);
+            break;
+        case ControlCommand::DISCONNECT:
+            this->xsub_socket_->disconnect(arg);
+            break;
+        case ControlCommand::EXIT:
+            break;
+        }
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->onBrokerError(error, this->kScope + " Error while applying a control command.");
+        return false;
+    }
+
+    // All ok.
+    return true;
+}
+
+void BrokerBase::onBrokerStart()
+{}
+
+void BrokerBase::onBrokerStop()
+{}
+
+void BrokerBase::onMsgCaptured(std::string_view, const zmq::multipart_t&)
+{}
+
+void BrokerBase::onSubscriptionChanged(const TopicType&, bool)
+{}
+
+void BrokerBase::onBrokerError(const zmq::error_t&, const std::string&)
+{}
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -41,6 +41,9 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <algorithm>
+#include <cmath>
+#include <limits>
 // =====================================================================================================================
 
 // ZMQUTILS INCLUDES
@@ -69,7 +72,9 @@ PublishedMessage::PublishedMessage(const TopicType &topic, const utils::UUID &uu
     priority(priority),
     publisher_uuid(uuid),
     data(std::move(data)),
-    timestamp(timestamp)
+    timestamp(timestamp),
+    sequence(0),
+    topic_sequence(0)
 {}
 
 void PublishedMessage::clear()
@@ -77,8 +82,249 @@ void PublishedMessage::clear()
     this->publisher_uuid.clear();
     this->topic.clear();
     this->data.clear();
+    this->shared_data.clear();
     this->timestamp.clear();
     this->priority = MessagePriority::NormalPriority;
+    this->sequence = 0;
+    this->topic_sequence = 0;
+}
+
+SharedPublishedData::SharedPublishedData() :
+    size(0)
+{}
+
+SharedPublishedData::SharedPublishedData(PublishedData &&data) :
+    bytes(std::move(data.bytes)),
+    size(data.size)
+{
+    data.size = 0;
+}
+
+bool SharedPublishedData::isEmpty() const
+{
+    return (!this->bytes || this->size == 0);
+}
+
+void SharedPublishedData::clear()
+{
+    this->bytes.reset();
+    this->size = 0;
+}
+
+TopicTrafficStats::TopicTrafficStats() :
+    msgs(0),
+    bytes(0),
+    subscriptions(0)
+{}
+
+BrokerStats::BrokerStats() :
+    msgs(0),
+    bytes(0),
+    subscriptions(0),
+    unsubscriptions(0),
+    untracked_msgs(0)
+{}
+
+TopicDispatchStats::TopicDispatchStats() :
+    processed_msgs(0),
+    dropped_msgs(0),
+    total_clbk_time(0),
+    last_clbk_time(0),
+    max_clbk_time(0)
+{}
+
+std::chrono::nanoseconds TopicDispatchStats::meanClbkTime() const
+{
+    if (0 == this->processed_msgs)
+        return std::chrono::nanoseconds(0);
+    return this->total_clbk_time / this->processed_msgs;
+}
+
+LatencyHistogram::LatencyHistogram() :
+    count(0),
+    total(0),
+    min(0),
+    max(0),
+    buckets{}
+{}
+
+void LatencyHistogram::addSample(std::chrono::nanoseconds sample)
+{
+    // Negative samples are due to clock skew.
+    if (sample.count() < 0)
+        sample = std::chrono::nanoseconds(0);
+
+    // Get the bucket (bit length of the microseconds).
+    std::uint64_t us = static_cast<std::uint64_t>(sample.count()) / 1000;
+    std::size_t idx = 0;
+    while (us > 0 && idx < kBuckets - 1)
+    {
+        us >>= 1;
+        idx++;
+    }
+
+    // Update the data.
+    this->min = (0 == this->count) ? sample : std::min(this->min, sample);
+    this->max = std::max(this->max, sample);
+    this->total += sample;
+    this->count++;
+    this->buckets[idx]++;
+}
+
+void LatencyHistogram::merge(const LatencyHistogram &other)
+{
+    // Empty histogram case.
+    if (0 == other.count)
+        return;
+
+    // Update the data.
+    this->min = (0 == this->count) ? other.min : std::min(this->min, other.min);
+    this->max = std::max(this->max, other.max);
+    this->total += other.total;
+    this->count += other.count;
+    for (std::size_t i = 0; i < kBuckets; i++)
+        this->buckets[i] += other.buckets[i];
+}
+
+std::chrono::nanoseconds LatencyHistogram::mean() const
+{
+    if (0 == this->count)
+        return std::chrono::nanoseconds(0);
+    return this->total / this->count;
+}
+
+std::chrono::nanoseconds LatencyHistogram::percentile(double percentile) const
+{
+    if (0 == this->count)
+        return std::chrono::nanoseconds(0);
+
+    // Number of samples that must be under the percentile.
+    double target = std::max(1.0, std::ceil(percentile / 100.0 * static_cast<double>(this->count)));
+
+    // Look for the bucket.
+    std::uint64_t accum = 0;
+    for (std::size_t i = 0; i < kBuckets - 1; i++)
+    {
+        accum += this->buckets[i];
+        if (static_cast<double>(accum) >= target)
+            return std::min(this->max, std::chrono::nanoseconds(std::chrono::microseconds(1LL << i)));
+    }
+    return this->max;
+}
+
+SequenceStats::SequenceStats() :
+    received_msgs(0),
+    lost_msgs(0),
+    duplicated_msgs(0),
+    reordered_msgs(0),
+    restarts(0),
+    last_sequence(0),
+    recv_window(0)
+{}
+
+std::uint64_t SequenceStats::track(SequenceType seq)
+{
+    // First sequence.
+    this->received_msgs++;
+    if (0 == this->last_sequence)
+    {
+        this->last_sequence = seq;
+        this->recv_window = 1;
+        return 0;
+    }
+
+    // New sequence. The gap (if any) is counted as lost.
+    if (seq > this->last_sequence)
+    {
+        SequenceType shift = seq - this->last_sequence;
+        std::uint64_t lost = shift - 1;
+        this->recv_window = (shift < kSequenceWindow) ? ((this->recv_window << shift) | 1) : 1;
+        this->last_sequence = seq;
+        this->lost_msgs += lost;
+        return lost;
+    }
+
+    // Older sequence out of the window. The publisher sequence was restarted.
+    SequenceType offset = this->last_sequence - seq;
+    if (offset >= kSequenceWindow)
+    {
+        this->restarts++;
+        this->last_sequence = seq;
+        this->recv_window = 1;
+        return 0;
+    }
+
+    // Older sequence inside the window. It is a duplicate or a late message previously counted as lost.
+    std::uint64_t bit = std::uint64_t(1) << offset;
+    if (this->recv_window & bit)
+        this->duplicated_msgs++;
+    else
+    {
+        this->recv_window |= bit;
+        this->reordered_msgs++;
+        if (this->lost_msgs > 0)
+            this->lost_msgs--;
+    }
+    return 0;
+}
+
+TopicType makeTopicIdFrame(TopicId id)
+{
+    TopicType frame(kTopicIdFrameSize, kTopicIdMarker);
+    frame[1] = static_cast<char>((id >> 8) & 0xFF);
+    frame[2] = static_cast<char>(id & 0xFF);
+    return frame;
+}
+
+bool parseTopicIdFrame(std::string_view frame, TopicId &id)
+{
+    if (frame.size() != kTopicIdFrameSize || frame[0] != kTopicIdMarker)
+        return false;
+    id = static_cast<TopicId>((static_cast<unsigned char>(frame[1]) << 8) | static_cast<unsigned char>(frame[2]));
+    return true;
+}
+
+PublishedData makeTopicIdsAnnouncement(TopicId first_id, const std::vector<TopicType> &names)
+{
+    PublishedData data;
+    data.size = serializer::BinarySerializer::fastSerialization(data.bytes, first_id, names);
+    return data;
+}
+
+bool parseTopicIdsAnnouncement(const PublishedMessage &msg, TopicId &first_id, std::vector<TopicType> &names)
+{
+    // Get the announced range.
+    try
+    {
+        serializer::BinarySerializer::fastDeserialization(msg.data.bytes.get(), msg.data.size, first_id, names);
+    }
+    catch(...)
+    {
+        return false;
+    }
+
+    // Check the range.
+    return static_cast<std::size_t>(first_id) + names.size() <=
+           static_cast<std::size_t>(std::numeric_limits<TopicId>::max()) + 1;
+}
+
+bool mergeTopicIdsAnnouncement(const PublishedMessage &msg, std::vector<TopicType> &table)
+{
+    // Get the announced range.
+    TopicId first_id;
+    std::vector<TopicType> names;
+    if (!parseTopicIdsAnnouncement(msg, first_id, names))
+        return false;
+
+    // Store the unknown names.
+    if (table.size() < first_id + names.size())
+        table.resize(first_id + names.size());
+    for (std::size_t i = 0; i < names.size(); i++)
+    {
+        if (table[first_id + i].empty())
+            table[first_id + i] = std::move(names[i]);
+    }
+    return true;
 }
 
 
@@ -94,7 +94,7 @@ std::string PublisherInfo::toJsonString() const
     std::stringstream ss;
 
     ss << "{"
-       << "\"uuid\":" << this->uuid.toRFC4122String() << ","
+       << "\"uuid\":" << this->uuid << ","
        << "\"port\":" << this->port << ","
        << "\"pid\":\"" << this->pid << "\","
        << "\"endpoint\":\"" << this->endpoint << "\","
@@ -131,7 +131,7 @@ std::string PublisherInfo::toString() const
         ip_list.erase(ip_list.size() - separator.size(), separator.size());
 
     // Generate the string.
-    ss << "Publisher UUID:      "        << this->uuid.toRFC4122String() << std::endl;
+    ss << "Publisher UUID:      "        << this->uuid << std::endl;
     ss << "Publisher Port:      "        << this->port                   << std::endl;
     ss << "Publisher PID:       "        << this->pid                    << std::endl;
     ss << "Publisher Endpoint:  "        << this->endpoint               << std::endl;
@@ -149,7 +149,7 @@ std::string SubscriberInfo::toJsonString() const
     std::stringstream ss;
 
     ss << "{"
-       << "\"uuid\":\"" << this->uuid.toRFC4122String() << "\","
+       << "\"uuid\":\"" << this->uuid << "\","
        << "\"hostname\":\"" << this->hostname << "\","
        << "\"name\":\"" << this->name << "\","
        << "\"info\":\"" << this->info << "\","
@@ -165,7 +165,7 @@ std::string SubscriberInfo::toString() const
     std::stringstream ss;
 
     // Generate the string.
-    ss << "Subscriber UUID:     " << this->uuid.toRFC4122String() << std::endl;
+    ss << "Subscriber UUID:     " << this->uuid << std::endl;
     ss << "Subscriber Hostname: " << this->hostname               << std::endl;
     ss << "Subscriber Name:     " << this->name                   << std::endl;
     ss << "Subscriber Info:     " << this->info                   << std::endl;
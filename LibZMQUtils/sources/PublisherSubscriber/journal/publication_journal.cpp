@@ -0,0 +1,404 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+/** ********************************************************************************************************************
+ * @file publication_journal.cpp
+ * @brief This file contains the implementation of the PublicationJournalWriter and PublicationJournalReader classes.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <map>
+#include <sstream>
+// =====================================================================================================================
+
+// LIBZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/PublisherSubscriber/journal/publication_journal.h"
+#include "LibZMQUtils/PublisherSubscriber/subscriber/subscriber_base.h"
+#include "LibZMQUtils/InternalHelpers/file_helpers.h"
+#include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
+// =====================================================================================================================
+
+// LIBZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace pubsub{
+// =====================================================================================================================
+
+// JOURNAL FORMAT
+// =====================================================================================================================
+
+// Each segment starts with the magic string, followed by the records. Each record is:
+//   [u32 record size (without this field)][u64 sequence][i64 send time ns][u32 frames]([u32 frame size][frame])*
+// A zero record size (the initial content of the mapped file) marks the end of the segment.
+constexpr std::string_view kJournalMagic = "ZMQJRNL1";
+constexpr std::size_t kRecordFixedSize = sizeof(std::uint32_t) + sizeof(SequenceType) + sizeof(std::int64_t) +
+                                         sizeof(std::uint32_t);
+
+// Auxiliar function to get the path of a segment file.
+static std::string journalSegmentPath(const std::string& directory, const std::string& prefix, std::size_t index)
+{
+    std::ostringstream path;
+    path << directory << '/' << prefix << '_' << std::setw(6) << std::setfill('0') << index
+         << kJournalSegmentExtension;
+    return path.str();
+}
+
+// =====================================================================================================================
+
+PublicationJournalWriter::PublicationJournalWriter(const std::string &directory, const std::string &prefix,
+                                                   std::size_t segment_size, std::size_t max_pending) :
+    directory_(directory),
+    prefix_(prefix),
+    segment_size_(std::max(segment_size, kJournalMagic.size() + kRecordFixedSize)),
+    max_pending_(max_pending),
+    segment_(new internal_helpers::files::MemoryMappedFile),
+    segment_index_(0),
+    segment_offset_(0),
+    in_progress_(0),
+    stop_(false),
+    written_records_(0),
+    failed_records_(0)
+{
+    // Continue after the last existing segment.
+    while (internal_helpers::files::fileExists(journalSegmentPath(this->directory_, this->prefix_,
+                                                                  this->segment_index_)))
+        this->segment_index_++;
+
+    // Launch the writer thread.
+    this->writer_th_ = std::thread(&PublicationJournalWriter::writerWorker, this);
+}
+
+void PublicationJournalWriter::append(SequenceType sequence, const StampTimePoint &send_tp, zmq::multipart_t &msg)
+{
+    // Prepare the record sharing the frames.
+    PendingRecord record;
+    record.sequence = sequence;
+    record.send_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(send_tp.time_since_epoch()).count();
+    record.frames.reserve(msg.size());
+    for (auto& frame : msg)
+    {
+        record.frames.emplace_back();
+        record.frames.back().copy(frame);
+    }
+
+    // Hand the record to the writer thread. If the writer can't keep up, the record is dropped.
+    {
+        std::lock_guard<std::mutex> lock(this->mtx_);
+        if (this->pending_.size() >= this->max_pending_)
+        {
+            this->failed_records_++;
+            return;
+        }
+        this->pending_.push_back(std::move(record));
+    }
+    this->cv_.notify_one();
+}
+
+void PublicationJournalWriter::flush()
+{
+    std::unique_lock<std::mutex> lock(this->mtx_);
+    this->cv_flush_.wait(lock, [this]{return this->pending_.empty() && 0 == this->in_progress_;});
+}
+
+std::uint64_t PublicationJournalWriter::getWrittenRecords() const
+{
+    return this->written_records_;
+}
+
+std::uint64_t PublicationJournalWriter::getFailedRecords() const
+{
+    return this->failed_records_;
+}
+
+PublicationJournalWriter::~PublicationJournalWriter()
+{
+    // Stop the writer thread. The pending records are written before.
+    {
+        std::lock_guard<std::mutex> lock(this->mtx_);
+        this->stop_ = true;
+    }
+    this->cv_.notify_one();
+    if (this->writer_th_.joinable())
+        this->writer_th_.join();
+
+    // Close the segment.
+    this->segment_->close();
+}
+
+void PublicationJournalWriter::writerWorker()
+{
+    // Local container (swapped with the pending records, so the appends are not blocked while writing).
+    std::vector<PendingRecord> records;
+
+    while (true)
+    {
+        // Wait for new records.
+        {
+            std::unique_lock<std::mutex> lock(this->mtx_);
+            this->in_progress_ = 0;
+            this->cv_flush_.notify_all();
+            this->cv_.wait(lock, [this]{return this->stop_ || !this->pending_.empty();});
+            if (this->pending_.empty() && this->stop_)
+                break;
+            records.swap(this->pending_);
+            this->in_progress_ = records.size();
+        }
+
+        // Write the records. The frames are released after writing them.
+        for (const auto& record : records)
+        {
+            if (this->writeRecord(record))
+                this->written_records_++;
+            else
+                this->failed_records_++;
+        }
+        records.clear();
+    }
+}
+
+bool PublicationJournalWriter::writeRecord(const PendingRecord &record)
+{
+    // Calculate the record size.
+    std::size_t size = kRecordFixedSize;
+    for (const auto& frame : record.frames)
+        size += sizeof(std::uint32_t) + frame.size();
+
+    // Open a new segment if the record doesn't fit (the end marker is the zero content after the last record).
+    if (!this->segment_->isOpen() || this->segment_offset_ + size + sizeof(std::uint32_t) > this->segment_->size())
+    {
+        if (!this->openNextSegment(size + sizeof(std::uint32_t)))
+            return false;
+    }
+
+    // Auxiliar lambda for writing.
+    std::byte* out = this->segment_->data() + this->segment_offset_;
+    auto write = [&out](const void* src, std::size_t n)
+    {
+        std::memcpy(out, src, n);
+        out += n;
+    };
+
+    // Write the record.
+    std::uint32_t record_size = static_cast<std::uint32_t>(size - sizeof(std::uint32_t));
+    std::uint32_t nframes = static_cast<std::uint32_t>(record.frames.size());
+    write(&record_size, sizeof(record_size));
+    write(&record.sequence, sizeof(record.sequence));
+    write(&record.send_ns, sizeof(record.send_ns));
+    write(&nframes, sizeof(nframes));
+    for (const auto& frame : record.frames)
+    {
+        std::uint32_t frame_size = static_cast<std::uint32_t>(frame.size());
+        write(&frame_size, sizeof(frame_size));
+        if (frame_size > 0)
+            write(frame.data(), frame_size);
+    }
+
+    // Update the offset.
+    this->segment_offset_ += size;
+    return true;
+}
+
+bool PublicationJournalWriter::openNextSegment(std::size_t min_size)
+{
+    // Close the previous segment.
+    if (this->segment_->isOpen())
+    {
+        this->segment_->close();
+        this->segment_index_++;
+    }
+
+    // Create the new segment.
+    std::size_t size = std::max(this->segment_size_, kJournalMagic.size() + min_size);
+    std::string path = journalSegmentPath(this->directory_, this->prefix_, this->segment_index_);
+    if (!this->segment_->openWrite(path, size))
+        return false;
+
+    // Write the magic string.
+    std::memcpy(this->segment_->data(), kJournalMagic.data(), kJournalMagic.size());
+    this->segment_offset_ = kJournalMagic.size();
+    return true;
+}
+
+JournalReplayConfig::JournalReplayConfig() :
+    first_sequence(0),
+    last_sequence(std::numeric_limits<SequenceType>::max()),
+    from(StampTimePoint::min()),
+    to(StampTimePoint::max()),
+    speed(0)
+{}
+
+PublicationJournalReader::PublicationJournalReader(const std::string &directory, const std::string &prefix) :
+    directory_(directory),
+    prefix_(prefix)
+{}
+
+std::size_t PublicationJournalReader::replay(const JournalReplayConfig &config, const ReplayFunction &func) const
+{
+    // Containers.
+    std::size_t replayed = 0;
+    std::map<utils::UUID, std::vector<TopicType>> topic_ids;
+    internal_helpers::files::MemoryMappedFile segment;
+    bool first = true;
+    std::chrono::nanoseconds first_send(0);
+    std::chrono::steady_clock::time_point replay_start;
+
+    // Read each segment.
+    for (std::size_t index = 0; segment.openRead(journalSegmentPath(this->directory_, this->prefix_, index)); index++)
+    {
+        // Check the magic string.
+        const std::byte* data = segment.data();
+        std::size_t size = segment.size();
+        if (size < kJournalMagic.size() || std::memcmp(data, kJournalMagic.data(), kJournalMagic.size()) != 0)
+            continue;
+        std::size_t offset = kJournalMagic.size();
+
+        // Read each record.
+        while (offset + kRecordFixedSize <= size)
+        {
+            // Auxiliar lambda for reading.
+            const std::byte* in = data + offset;
+            auto read = [&in](void* dst, std::size_t n)
+            {
+                std::memcpy(dst, in, n);
+                in += n;
+            };
+
+            // Read the fixed fields. A zero size (or an invalid size) marks the end of the segment.
+            std::uint32_t record_size, nframes;
+            SequenceType sequence;
+            std::int64_t send_ns;
+            read(&record_size, sizeof(record_size));
+            if (record_size < kRecordFixedSize - sizeof(record_size) ||
+                offset + sizeof(record_size) + record_size > size)
+                break;
+            read(&sequence, sizeof(sequence));
+            read(&send_ns, sizeof(send_ns));
+            read(&nframes, sizeof(nframes));
+            const std::byte* record_end = data + offset + sizeof(record_size) + record_size;
+            offset += sizeof(record_size) + record_size;
+
+            // Read the frames.
+            zmq::multipart_t frames;
+            bool valid = true;
+            for (std::uint32_t i = 0; i < nframes && valid; i++)
+            {
+                std::uint32_t frame_size;
+                if (in + sizeof(frame_size) > record_end)
+                {
+                    valid = false;
+                    break;
+                }
+                read(&frame_size, sizeof(frame_size));
+                if (in + frame_size > record_end)
+                {
+                    valid = false;
+                    break;
+                }
+                frames.addmem(in, frame_size);
+                in += frame_size;
+            }
+            if (!valid || frames.empty())
+                continue;
+
+            // Check if it is a topic identifiers announcement (always processed) or if it is in the range.
+            bool announcement = (frames.front().to_string_view() == kReservedTopicTopicIds);
+            StampTimePoint send_tp(std::chrono::duration_cast<StampTimePoint::duration>(
+                std::chrono::nanoseconds(send_ns)));
+            if (!announcement && (sequence < config.first_sequence || sequence > config.last_sequence ||
+                                  send_tp < config.from || send_tp > config.to))
+                continue;
+
+            // Decode the message.
+            PublishedMessage msg;
+            bool is_topic_id;
+            TopicId topic_id;
+            OperationResult result = SubscriberBase::decodeMessage(frames, msg, is_topic_id, topic_id);
+            if (result != OperationResult::OPERATION_OK && result != OperationResult::EMPTY_PARAMS)
+                continue;
+
+            // Store the topic identifiers announcements.
+            if (announcement)
+            {
+                mergeTopicIdsAnnouncement(msg, topic_ids[msg.publisher_uuid]);
+                continue;
+            }
+
+            // Resolve the topic identifier.
+            if (is_topic_id)
+            {
+                auto it = topic_ids.find(msg.publisher_uuid);
+                if (it == topic_ids.end() || topic_id >= it->second.size() || it->second[topic_id].empty())
+                    continue;
+                msg.topic = it->second[topic_id];
+            }
+
+            // Wait for the original (or accelerated) time.
+            if (first)
+            {
+                first_send = std::chrono::nanoseconds(send_ns);
+                replay_start = std::chrono::steady_clock::now();
+                first = false;
+            }
+            else if (config.speed > 0)
+            {
+                auto elapsed = std::chrono::duration<double, std::nano>(
+                    static_cast<double>((std::chrono::nanoseconds(send_ns) - first_send).count()) / config.speed);
+                std::this_thread::sleep_until(
+                    replay_start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(elapsed));
+            }
+
+            // Replay the message.
+            func(std::move(msg));
+            replayed++;
+        }
+    }
+
+    // Return the number of replayed messages.
+    return replayed;
+}
+
+std::size_t PublicationJournalReader::replay(const JournalReplayConfig &config, SubscriberBase &subscriber) const
+{
+    return this->replay(config, [&subscriber](PublishedMessage&& msg){subscriber.injectMsg(std::move(msg));});
+}
+
+}} // END NAMESPACES.
+// =====================================================================================================================
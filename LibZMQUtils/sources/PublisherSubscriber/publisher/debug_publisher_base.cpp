@@ -125,7 +125,7 @@ void DebugPublisherBase::onSendingMsg(const PublishedMessage &msg)
     // Log.
     serializer::BinarySerializer serializer(msg.data.bytes.get(), msg.data.size);
     std::stringstream data;
-    data << "Publisher UUID: " << msg.publisher_uuid.toRFC4122String() << std::endl;
+    data << "Publisher UUID: " << msg.publisher_uuid << std::endl;
     data << "Topic:          " << msg.topic                      << std::endl;
     data << "Timestamp:      " << msg.timestamp                  << std::endl;
     data << "Params size:    " << msg.data.size                  << std::endl;
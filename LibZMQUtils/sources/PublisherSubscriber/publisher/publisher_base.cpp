@@ -46,6 +46,7 @@
 #include <cstdlib>
 #include <thread>
 #include <chrono>
+#include <limits>
 // =====================================================================================================================
 
 // ZMQ INCLUDES
@@ -58,6 +59,7 @@
 // =====================================================================================================================
 #include "LibZMQUtils/PublisherSubscriber/publisher/publisher_base.h"
 #include "LibZMQUtils/InternalHelpers/network_helpers.h"
+#include "LibZMQUtils/InternalHelpers/zmq_helpers.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
 #include "LibZMQUtils/Utilities/utils.h"
 // =====================================================================================================================
@@ -83,9 +85,18 @@ PublisherBase::PublisherBase(unsigned publisher_port,
                              const std::string& publisher_version,
                              const std::string& publisher_info) :
     publisher_socket_(nullptr),
+    snd_hwm_(-1),
     flag_publisher_working_(false),
     publisher_reconn_attempts_(kDefaultPublisherReconnAttempts),
-    stop_queue_worker_(false)
+    stop_queue_worker_(false),
+    announce_timer_id_(0),
+    reactor_worker_scheduled_(false),
+    flag_direct_send_(false),
+    socket_busy_(false),
+    flag_topic_ids_(false),
+    active_topic_ids_(0),
+    flag_topic_seqs_(false),
+    pub_seq_(0)
 {
     // Auxiliar variables and containers.
     std::string inter_aux = publisher_iface;
@@ -136,6 +147,9 @@ PublisherBase::PublisherBase(unsigned publisher_port,
     this->pub_info_.info = publisher_info;
     this->pub_info_.version = publisher_version;
     this->pub_info_.ips = this->getPublisherIps();
+
+    // Default name of the worker thread.
+    this->thread_config_.name = "zmq-pub";
 }
 
 bool PublisherBase::internalEnqueueMsg(PublishedMessage &&msg)
@@ -190,6 +204,8 @@ bool PublisherBase::internalEnqueueMsg(PublishedMessage &&msg)
     if (inserted)
     {
         this->queue_cv_.notify_one();
+        if (this->reactor_)
+            this->scheduleReactorWorker();
     }
 
     return inserted;
@@ -197,90 +213,257 @@ bool PublisherBase::internalEnqueueMsg(PublishedMessage &&msg)
 
 void PublisherBase::messageQueueWorker()
 {
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_))
+        this->onPublisherError(zmq::error_t(), this->kClassScope + " The thread configuration was not fully applied.");
+    auto cpu_attachment = this->worker_cpu_clock_.attach();
+
     // Worker infinite loop.
     while (!this->stop_queue_worker_)
     {
         // Lock for cv.
         std::unique_lock<std::mutex> lock(this->queue_mutex_);
 
-        // Wait for a new msg in the queue.
-        this->queue_cv_.wait(lock, [this]
+        // Wait predicate. The messages can't be sent while a direct sender is using the socket.
+        auto pred = [this]
         {
             return stop_queue_worker_ ||
-                   !this->queue_prio_critical_.empty() ||
-                   !this->queue_prio_high_.empty() ||
-                   !this->queue_prio_normal_.empty() ||
-                   !this->queue_prio_low_.empty() ||
-                   !this->queue_prio_no_.empty();
-        });
+                   (!this->socket_busy_ &&
+                    (!this->queue_prio_critical_.empty() ||
+                     !this->queue_prio_high_.empty() ||
+                     !this->queue_prio_normal_.empty() ||
+                     !this->queue_prio_low_.empty() ||
+                     !this->queue_prio_no_.empty()));
+        };
+
+        // Wait for a new msg in the queue. If topic identifiers are in use, wake up also for announcing them.
+        if (this->flag_topic_ids_ && !this->topic_names_.empty())
+            this->queue_cv_.wait_until(lock, this->next_ids_announce_, pred);
+        else
+            this->queue_cv_.wait(lock, pred);
 
         // Stop the worker case.
         if (this->stop_queue_worker_)
             break;
 
-        // Storage for published msg.
-        PublishedMessage msg;
+        // Wait again if a direct sender is using the socket (announcement timeout case).
+        if (this->socket_busy_)
+            continue;
 
-        // Move the msg.
-        if (!this->queue_prio_critical_.empty())
-        {
-            msg = std::move(this->queue_prio_critical_.front());
-            this->queue_prio_critical_.pop();
-        }
-        else if (!this->queue_prio_high_.empty())
-        {
-            msg = std::move(this->queue_prio_high_.front());
-            this->queue_prio_high_.pop();
-        }
-        else if (!this->queue_prio_normal_.empty())
+        // Send the next message.
+        this->sendNextQueuedMsg(lock);
+    }
+}
+
+void PublisherBase::reactorQueueWorker()
+{
+    // Maximum number of messages sent by each task, so the loop is shared with the rest of components.
+    constexpr unsigned kMaxBatch = 64;
+
+    // Lock the queues.
+    std::unique_lock<std::mutex> lock(this->queue_mutex_);
+
+    // Send the messages. If a direct sender is using the socket, it will schedule a new task when releasing it.
+    for (unsigned i = 0; i < kMaxBatch; i++)
+    {
+        if (this->stop_queue_worker_ || this->socket_busy_ || !this->sendNextQueuedMsg(lock))
         {
-            msg = std::move(this->queue_prio_normal_.front());
-            this->queue_prio_normal_.pop();
+            this->reactor_worker_scheduled_ = false;
+            return;
         }
-        else if (!queue_prio_low_.empty())
+    }
+
+    // Continue in a new task with the remaining messages.
+    this->reactor_worker_scheduled_ = false;
+    lock.unlock();
+    this->scheduleReactorWorker();
+}
+
+void PublisherBase::scheduleReactorWorker()
+{
+    // Check if there are pending messages and if the task is already scheduled.
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex_);
+        if (this->reactor_worker_scheduled_ || this->stop_queue_worker_ ||
+            (this->queue_prio_critical_.empty() &&
+             this->queue_prio_high_.empty() &&
+             this->queue_prio_normal_.empty() &&
+             this->queue_prio_low_.empty() &&
+             this->queue_prio_no_.empty()))
+            return;
+        this->reactor_worker_scheduled_ = true;
+    }
+
+    // Send the messages in the reactor loop.
+    this->reactor_->post([this]{ this->reactorQueueWorker(); });
+}
+
+void PublisherBase::stopQueueWorker()
+{
+    // Stop the worker thread.
+    this->stop_queue_worker_ = true;
+    this->queue_cv_.notify_all();
+    if (this->queue_worker_th_.joinable())
+        this->queue_worker_th_.join();
+
+    // Stop the reactor tasks. The tasks posted before this one have finished when it runs.
+    if (this->reactor_)
+    {
+        this->reactor_->execute([this]
         {
-            msg = std::move(this->queue_prio_low_.front());
-            this->queue_prio_low_.pop();
-        }
-        else if (!this->queue_prio_no_.empty())
+            this->reactor_->removeTimer(this->announce_timer_id_);
+            this->announce_timer_id_ = 0;
+        });
+        std::lock_guard<std::mutex> lock(this->queue_mutex_);
+        this->reactor_worker_scheduled_ = false;
+    }
+}
+
+bool PublisherBase::sendNextQueuedMsg(std::unique_lock<std::mutex> &lock)
+{
+    // Periodic announcement of the topic identifiers (for late joining subscribers). The socket is not busy and the
+    // queue mutex is locked, so this thread owns the socket and the table of identifiers.
+    if (this->flag_topic_ids_ && !this->topic_names_.empty() &&
+        std::chrono::steady_clock::now() >= this->next_ids_announce_)
+    {
+        try
         {
-            msg = std::move(this->queue_prio_no_.front());
-            this->queue_prio_no_.pop();
+            this->announceTopicIds(0, this->topic_names_.size());
         }
-        else
+        catch (const zmq::error_t& error)
         {
-            continue;
+            this->onPublisherError(error, this->kClassScope + " Error while announcing the topic identifiers.");
         }
+        this->next_ids_announce_ = std::chrono::steady_clock::now() + kTopicIdsAnnouncePeriod;
+    }
 
-        // Unlock.
-        lock.unlock();
+    // Storage for published msg.
+    PublishedMessage msg;
 
-        // Send the message via ZMQ
-        try
-        {
-            // Call to the internal sending command callback.
-            this->onSendingMsg(msg);
+    // Move the msg.
+    if (!this->queue_prio_critical_.empty())
+    {
+        msg = std::move(this->queue_prio_critical_.front());
+        this->queue_prio_critical_.pop();
+    }
+    else if (!this->queue_prio_high_.empty())
+    {
+        msg = std::move(this->queue_prio_high_.front());
+        this->queue_prio_high_.pop();
+    }
+    else if (!this->queue_prio_normal_.empty())
+    {
+        msg = std::move(this->queue_prio_normal_.front());
+        this->queue_prio_normal_.pop();
+    }
+    else if (!queue_prio_low_.empty())
+    {
+        msg = std::move(this->queue_prio_low_.front());
+        this->queue_prio_low_.pop();
+    }
+    else if (!this->queue_prio_no_.empty())
+    {
+        msg = std::move(this->queue_prio_no_.front());
+        this->queue_prio_no_.pop();
+    }
+    else
+    {
+        return false;
+    }
 
+    // Take the socket and unlock.
+    this->socket_busy_ = true;
+    lock.unlock();
 
-            // Prepare the multipart msg.
-            zmq::multipart_t multipart_msg(this->prepareMessage(msg));
+    // Send the message via ZMQ
+    try
+    {
+        // Call to the internal sending command callback.
+        this->onSendingMsg(msg);
 
 
-            // Send the msg.
-            bool res = multipart_msg.send(*this->publisher_socket_);
-            if (!res)
-            {
-                // Custom error for 0 bytes sent.
-                this->onPublisherError(zmq::error_t(), this->kClassScope + " No data was sent (0 bytes).");
-            }
-        }
-        catch (const zmq::error_t& error)
+        // Prepare the multipart msg.
+        zmq::multipart_t multipart_msg(this->prepareMessage(msg));
+
+        // Send the msg.
+        bool res = this->sendPreparedMsg(multipart_msg, msg);
+        if (!res)
         {
-            // Call to the error callback and stop the publisher for safety.
-            this->onPublisherError(error, this->kClassScope + " Error while sending a request. Stopping the publisher.");
-            this->internalStopPublisher();
+            // Custom error for 0 bytes sent.
+            this->onPublisherError(zmq::error_t(), this->kClassScope + " No data was sent (0 bytes).");
         }
     }
+    catch (const zmq::error_t& error)
+    {
+        // Call to the error callback and stop the publisher for safety.
+        this->releaseSocket();
+        this->onPublisherError(error, this->kClassScope + " Error while sending a request. Stopping the publisher.");
+        this->internalStopPublisher();
+        lock.lock();
+        return false;
+    }
+
+    // Release the socket and lock again.
+    this->releaseSocket();
+    lock.lock();
+    return true;
+}
+
+OperationResult PublisherBase::internalPublishMsg(PublishedMessage &&msg)
+{
+    // Take the socket for a direct send. Only if there are no pending messages, so the order is preserved.
+    bool direct = false;
+    if (this->flag_direct_send_)
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex_);
+        direct = !this->socket_busy_ &&
+                 this->queue_prio_critical_.empty() &&
+                 this->queue_prio_high_.empty() &&
+                 this->queue_prio_normal_.empty() &&
+                 this->queue_prio_low_.empty() &&
+                 this->queue_prio_no_.empty();
+        this->socket_busy_ = direct;
+    }
+
+    // Enqueue the msg. If the enqueue fails, the queue is overflown.
+    if (!direct)
+        return this->internalEnqueueMsg(std::move(msg)) ? OperationResult::OPERATION_OK :
+                                                          OperationResult::OVERFLOW_QUEUE;
+
+    // Send the message in the calling thread.
+    try
+    {
+        // Call to the internal sending command callback.
+        this->onSendingMsg(msg);
+
+        // Prepare and send the msg.
+        zmq::multipart_t multipart_msg(this->prepareMessage(msg));
+        if (!this->sendPreparedMsg(multipart_msg, msg))
+            this->onPublisherError(zmq::error_t(), this->kClassScope + " No data was sent (0 bytes).");
+    }
+    catch (const zmq::error_t& error)
+    {
+        // Call to the error callback and stop the publisher for safety.
+        this->releaseSocket();
+        this->onPublisherError(error, this->kClassScope + " Error while sending a request. Stopping the publisher.");
+        this->internalStopPublisher();
+        return OperationResult::INTERNAL_ZMQ_ERROR;
+    }
+
+    // Release the socket (the worker could be waiting for it).
+    this->releaseSocket();
+    return OperationResult::OPERATION_OK;
+}
+
+void PublisherBase::releaseSocket()
+{
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex_);
+        this->socket_busy_ = false;
+    }
+    this->queue_cv_.notify_one();
+    if (this->reactor_)
+        this->scheduleReactorWorker();
 }
 
 PublisherBase::~PublisherBase()
@@ -393,6 +576,205 @@ bool PublisherBase::isWorking() const
     return this->flag_publisher_working_;
 }
 
+bool PublisherBase::isContextInUse() const
+{
+    return this->isWorking();
+}
+
+void PublisherBase::setTopicIdsEnabled(bool enabled)
+{
+    this->flag_topic_ids_ = enabled;
+}
+
+bool PublisherBase::getTopicIdsEnabled() const
+{
+    return this->flag_topic_ids_;
+}
+
+void PublisherBase::setTopicSequencesEnabled(bool enabled)
+{
+    this->flag_topic_seqs_ = enabled;
+}
+
+bool PublisherBase::getTopicSequencesEnabled() const
+{
+    return this->flag_topic_seqs_;
+}
+
+void PublisherBase::setDirectSendEnabled(bool enabled)
+{
+    this->flag_direct_send_ = enabled;
+}
+
+bool PublisherBase::getDirectSendEnabled() const
+{
+    return this->flag_direct_send_;
+}
+
+bool PublisherBase::setUdpTransport(const std::string &udp_endpoint)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Check the status, the endpoint and the draft API.
+    if (this->flag_publisher_working_)
+        return false;
+    if (!udp_endpoint.empty() &&
+        (!internal_helpers::zmq_helpers::kDraftApiAvailable ||
+         !internal_helpers::zmq_helpers::isUdpEndpoint(udp_endpoint)))
+        return false;
+
+    // Update the endpoint.
+    this->udp_endpoint_ = udp_endpoint;
+    return true;
+}
+
+const std::string &PublisherBase::getUdpTransport() const
+{
+    return this->udp_endpoint_;
+}
+
+bool PublisherBase::setLocalTransport(const std::string &local_endpoint)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Check the status and the endpoint.
+    if (this->flag_publisher_working_)
+        return false;
+    if (!local_endpoint.empty() && !internal_helpers::zmq_helpers::isLocalEndpoint(local_endpoint))
+        return false;
+
+    // Update the endpoint.
+    this->local_endpoint_ = local_endpoint;
+    return true;
+}
+
+const std::string &PublisherBase::getLocalTransport() const
+{
+    return this->local_endpoint_;
+}
+
+void PublisherBase::setSendHWM(int hwm)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Only update the value if the publisher is stopped.
+    if (!this->flag_publisher_working_)
+        this->snd_hwm_ = hwm;
+}
+
+int PublisherBase::getSendHWM() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->snd_hwm_;
+}
+
+void PublisherBase::setSocketOptions(const SocketOptions& options)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Only update the value if the publisher is stopped.
+    if (!this->flag_publisher_working_)
+        this->socket_options_ = options;
+}
+
+SocketOptions PublisherBase::getSocketOptions() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->socket_options_;
+}
+
+SocketOptions PublisherBase::getAppliedSocketOptions() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->applied_socket_options_;
+}
+
+void PublisherBase::setReactor(std::shared_ptr<ZMQReactor> reactor)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Only update the value if the publisher is stopped.
+    if (!this->flag_publisher_working_)
+        this->reactor_ = std::move(reactor);
+}
+
+std::shared_ptr<ZMQReactor> PublisherBase::getReactor() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->reactor_;
+}
+
+void PublisherBase::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Only update the value if the publisher is stopped.
+    if (!this->flag_publisher_working_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig PublisherBase::getWorkerThreadConfig() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds PublisherBase::getWorkerCpuTime() const
+{
+    return this->worker_cpu_clock_.elapsed();
+}
+
+bool PublisherBase::enableJournal(const std::string &directory, const std::string &prefix, std::size_t segment_size,
+                                  std::size_t max_pending)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Check the status.
+    if (this->flag_publisher_working_)
+        return false;
+
+    // Create the journal (the previous one is closed before).
+    this->journal_.reset();
+    this->journal_ = std::make_unique<PublicationJournalWriter>(directory, prefix, segment_size, max_pending);
+    return true;
+}
+
+bool PublisherBase::disableJournal()
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Check the status.
+    if (this->flag_publisher_working_)
+        return false;
+
+    // Close the journal.
+    this->journal_.reset();
+    return true;
+}
+
+bool PublisherBase::isJournalEnabled() const
+{
+    // Safe mutex lock
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    return this->journal_ != nullptr;
+}
+
+void PublisherBase::flushJournal()
+{
+    // Safe mutex lock (the journal can't be replaced meanwhile).
+    std::shared_lock<std::shared_mutex> lock(this->pub_mtx_);
+    if (this->journal_)
+        this->journal_->flush();
+}
+
 OperationResult PublisherBase::enqueueMsg(const TopicType& topic, MessagePriority priority, PublishedData&& data)
 {
     // Safe mutex lock
@@ -405,12 +787,48 @@ OperationResult PublisherBase::enqueueMsg(const TopicType& topic, MessagePriorit
     // Prepare the message.
     PublishedMessage msg(topic, this->pub_info_.uuid, utils::currentISO8601Date(true, false, true),
                          std::move(data), priority);
+    msg.enqueue_tp = std::chrono::system_clock::now();
 
-    // Enqueue the msg. If the enqueue fails, the queue is overflown.
-    bool result = this->internalEnqueueMsg(std::move(msg));
+    // Publish the msg (enqueue or direct send).
+    return this->internalPublishMsg(std::move(msg));
+}
+
+OperationResult PublisherBase::enqueueSharedMsg(const TopicType &topic, MessagePriority priority,
+                                                const SharedPublishedData &data)
+{
+    return this->enqueueSharedMsg(std::vector<TopicType>{topic}, priority, data);
+}
+
+OperationResult PublisherBase::enqueueSharedMsg(const std::vector<TopicType> &topics, MessagePriority priority,
+                                                const SharedPublishedData &data)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->pub_mtx_);
+
+    // Check if we started the publisher.
+    if (!this->publisher_socket_)
+        return OperationResult::PUBLISHER_STOPPED;
+
+    // Common message data.
+    std::string timestamp = utils::currentISO8601Date(true, false, true);
+    StampTimePoint enqueue_tp = std::chrono::system_clock::now();
+    OperationResult result = OperationResult::OPERATION_OK;
+
+    // Prepare and publish a message for each topic. All of them share the same data buffer.
+    for (const auto& topic : topics)
+    {
+        PublishedMessage msg(topic, this->pub_info_.uuid, timestamp, PublishedData(), priority);
+        msg.shared_data = data;
+        msg.enqueue_tp = enqueue_tp;
+        OperationResult res = this->internalPublishMsg(std::move(msg));
+        if (OperationResult::INTERNAL_ZMQ_ERROR == res)
+            return res;
+        if (OperationResult::OPERATION_OK != res)
+            result = res;
+    }
 
     // Return the result.
-    return result ? OperationResult::OPERATION_OK : OperationResult::OVERFLOW_QUEUE;
+    return result;
 }
 
 const std::vector<NetworkAdapterInfo> &PublisherBase::getBoundInterfaces() const
@@ -447,15 +865,22 @@ bool PublisherBase::internalResetPublisher()
     // Lock.
     this->pub_mtx_.lock();
 
+    // The shared reactor must be running.
+    if (this->reactor_ && !this->reactor_->isRunning())
+    {
+        this->pub_mtx_.unlock();
+        this->onPublisherError(zmq::error_t(),
+                               this->kClassScope + " The shared reactor must be running to start the publisher.");
+        return false;
+    }
+
+    // Stop the worker (before closing the sockets, since it could be using them).
+    this->stopQueueWorker();
+
     // Close the previous sockets to flush.
     this->deleteSockets();
-
-    // Stop the worker thread.
-    this->stop_queue_worker_ = true;
-    this->queue_cv_.notify_all();
-    if (this->queue_worker_th_.joinable())
-        this->queue_worker_th_.join();
     this->stop_queue_worker_ = false;
+    this->socket_busy_ = false;
 
     // Try creating a new socket.
     do{
@@ -463,12 +888,43 @@ bool PublisherBase::internalResetPublisher()
         {
             // Zmq publisher socket.
             std::this_thread::sleep_for(std::chrono::milliseconds(1));
-            this->publisher_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pub);
-            this->publisher_socket_->bind(this->pub_info_.endpoint);
-            this->publisher_socket_->set(zmq::sockopt::linger, 0);
+#ifdef ZMQ_BUILD_DRAFT_API
+            if (!this->udp_endpoint_.empty())
+            {
+                // UDP RADIO transport.
+                this->publisher_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::radio);
+                this->publisher_socket_->set(zmq::sockopt::linger, 0);
+                applySocketOptions(*this->publisher_socket_, this->socket_options_);
+                if (this->snd_hwm_ >= 0)
+                    this->publisher_socket_->set(zmq::sockopt::sndhwm, this->snd_hwm_);
+                this->publisher_socket_->connect(this->udp_endpoint_);
+            }
+            else
+#endif
+            {
+                // TCP (or local) PUB transport.
+                this->publisher_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pub);
+                applySocketOptions(*this->publisher_socket_, this->socket_options_);
+                if (this->snd_hwm_ >= 0)
+                    this->publisher_socket_->set(zmq::sockopt::sndhwm, this->snd_hwm_);
+                this->publisher_socket_->bind(this->local_endpoint_.empty() ? this->pub_info_.endpoint :
+                                                                              this->local_endpoint_);
+                this->publisher_socket_->set(zmq::sockopt::linger, 0);
+            }
+
+            // Store the options that ZMQ really applied.
+            this->applied_socket_options_ = readSocketOptions(*this->publisher_socket_);
 
-            // Prepare the queues worker thread.
-            this->queue_worker_th_ = std::thread(&PublisherBase::messageQueueWorker, this);
+            // Prepare the queues worker thread, or the reactor timer for the topic identifiers announcements.
+            if (this->reactor_)
+                this->announce_timer_id_ = this->reactor_->addTimer(kTopicIdsAnnouncePeriod, [this]
+                {
+                    std::unique_lock<std::mutex> lock(this->queue_mutex_);
+                    if (!this->stop_queue_worker_ && !this->socket_busy_)
+                        this->sendNextQueuedMsg(lock);
+                });
+            else
+                this->queue_worker_th_ = std::thread(&PublisherBase::messageQueueWorker, this);
 
             // Update the working flag.
             this->flag_publisher_working_ = true;
@@ -531,11 +987,8 @@ void PublisherBase::internalStopPublisher()
     if (!this->flag_publisher_working_)
         return;
 
-    // Stop the worker thread.
-    this->stop_queue_worker_ = true;
-    this->queue_cv_.notify_all();
-    if (this->queue_worker_th_.joinable())
-        this->queue_worker_th_.join();
+    // Stop the worker.
+    this->stopQueueWorker();
 
     // Set the shared working flag to false (is atomic).
     this->flag_publisher_working_ = false;
@@ -549,8 +1002,11 @@ zmq::multipart_t PublisherBase::prepareMessage(PublishedMessage& publication)
     // Serializer.
     serializer::BinarySerializer serializer;
 
-    // Prepare the topic. This must come plain, since it is used by ZMQ topic filtering.
-    zmq::message_t msg_topic(publication.topic);
+    // Prepare the topic. This must come plain, since it is used by ZMQ topic filtering. If the topic identifiers are
+    // enabled, the identifier frame is sent instead (the subscribers also use it for ZMQ topic filtering).
+    TopicId topic_id;
+    zmq::message_t msg_topic = (this->flag_topic_ids_ && this->internalGetTopicId(publication.topic, topic_id)) ?
+                                   zmq::message_t(makeTopicIdFrame(topic_id)) : zmq::message_t(publication.topic);
 
     // Prepare the uuid.
     size_t uuid_size = serializer.write(publication.publisher_uuid.getBytes());
@@ -560,11 +1016,27 @@ zmq::multipart_t PublisherBase::prepareMessage(PublishedMessage& publication)
     size_t ts_size = serializer.write(publication.timestamp);
     zmq::message_t msg_ts(serializer.release(), ts_size, serializer::del_byte_ptr);
 
+    // Stamp the sequence numbers (publisher and topic) and the sending time.
+    publication.sequence = ++this->pub_seq_;
+    publication.topic_sequence = this->flag_topic_seqs_ ? ++this->topic_seqs_[publication.topic] : 0;
+    publication.send_tp = std::chrono::system_clock::now();
+    if (publication.enqueue_tp == StampTimePoint())
+        publication.enqueue_tp = publication.send_tp;
+
+    // Prepare the header with the sequence numbers and the binary time stamps (nanoseconds since epoch).
+    std::int64_t enqueue_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                  publication.enqueue_tp.time_since_epoch()).count();
+    std::int64_t send_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               publication.send_tp.time_since_epoch()).count();
+    size_t seq_size = serializer.write(publication.sequence, publication.topic_sequence, enqueue_ns, send_ns);
+    zmq::message_t msg_seq(serializer.release(), seq_size, serializer::del_byte_ptr);
+
     // Prepare the multipart msg.
     zmq::multipart_t multipart_msg;
     multipart_msg.add(std::move(msg_topic));
     multipart_msg.add(std::move(msg_uuid));
     multipart_msg.add(std::move(msg_ts));
+    multipart_msg.add(std::move(msg_seq));
 
     // Add publication custom data if they exist.
     if (publication.data.size > 0)
@@ -574,10 +1046,104 @@ zmq::multipart_t PublisherBase::prepareMessage(PublishedMessage& publication)
         zmq::message_t message_params(publication.data.bytes.release(), publication.data.size, serializer::del_byte_ptr);
         multipart_msg.add(std::move(message_params));
     }
+    else if (!publication.shared_data.isEmpty())
+    {
+        // Prepare the shared custom data. The zmq message only holds a reference to the shared buffer.
+        multipart_msg.add(internal_helpers::zmq_helpers::makeSharedMessage(publication.shared_data.bytes,
+                                                                           publication.shared_data.size));
+    }
 
     // Return the multipart msg.
     return multipart_msg;
 }
 
+bool PublisherBase::internalGetTopicId(const TopicType &topic, TopicId &id)
+{
+    // The reserved topics are always sent plain.
+    if (topic == kReservedTopicTopicIds)
+        return false;
+
+    // Check if the topic is already registered.
+    auto it = this->topic_ids_.find(topic);
+    if (it != this->topic_ids_.end())
+    {
+        // The identifiers are registered in order, so they are activated in order too.
+        id = it->second;
+        if (id < this->active_topic_ids_)
+            return true;
+        auto now = std::chrono::steady_clock::now();
+        while (this->active_topic_ids_ < this->topic_ids_tps_.size() &&
+               this->topic_ids_tps_[this->active_topic_ids_] <= now)
+            this->active_topic_ids_++;
+        return id < this->active_topic_ids_;
+    }
+
+    // If there are no free identifiers, the topic will be sent plain.
+    if (this->topic_names_.size() > std::numeric_limits<TopicId>::max())
+        return false;
+
+    // Register the new topic and announce only the new identifier. The messages of this topic are sent plain during
+    // one announcement period, so the subscribers can subscribe to the identifier frame before it is used.
+    // The queue worker checks the table under the queue mutex, so the table is modified under it too.
+    id = static_cast<TopicId>(this->topic_names_.size());
+    this->topic_ids_.insert({topic, id});
+    {
+        std::lock_guard<std::mutex> lock(this->queue_mutex_);
+        this->topic_names_.push_back(topic);
+    }
+    this->topic_ids_tps_.push_back(std::chrono::steady_clock::now() + kTopicIdsAnnouncePeriod);
+    this->announceTopicIds(id, 1);
+    return false;
+}
+
+bool PublisherBase::sendPreparedMsg(zmq::multipart_t &multipart_msg, const PublishedMessage &msg)
+{
+    // Store the message in the journal (the frames are shared with the journal thread, not copied).
+    if (this->journal_)
+        this->journal_->append(msg.sequence, msg.send_tp, multipart_msg);
+
+    // Send the message using the configured transport.
+    return this->udp_endpoint_.empty() ? multipart_msg.send(*this->publisher_socket_) :
+                                         this->sendRadioMsg(multipart_msg, msg.topic);
+}
+
+bool PublisherBase::sendRadioMsg(zmq::multipart_t &multipart_msg, const TopicType &topic)
+{
+#ifdef ZMQ_BUILD_DRAFT_API
+    // RADIO sockets don't support multipart messages, so the parts are packed into a single datagram.
+    std::string group = internal_helpers::zmq_helpers::topicToGroup(topic);
+    zmq::message_t packed = internal_helpers::zmq_helpers::packMultipart(multipart_msg);
+
+    // Check the datagram size (group size byte, group and data).
+    if (packed.size() + group.size() + 1 > internal_helpers::zmq_helpers::kMaxUdpDatagramSize)
+    {
+        this->onPublisherError(zmq::error_t(), this->kClassScope + " The message is too big for a UDP datagram.");
+        return true;
+    }
+
+    // Send the datagram.
+    packed.set_group(group.c_str());
+    return this->publisher_socket_->send(packed, zmq::send_flags::none).has_value();
+#else
+    (void)multipart_msg;
+    (void)topic;
+    return false;
+#endif
+}
+
+void PublisherBase::announceTopicIds(TopicId first_id, std::size_t count)
+{
+    // Serialize the range of topic names.
+    std::vector<TopicType> names(this->topic_names_.begin() + first_id,
+                                 this->topic_names_.begin() + first_id + static_cast<std::ptrdiff_t>(count));
+    PublishedData data = makeTopicIdsAnnouncement(first_id, names);
+
+    // Prepare and send the announcement.
+    PublishedMessage msg(TopicType(kReservedTopicTopicIds), this->pub_info_.uuid,
+                         utils::currentISO8601Date(true, false, true), std::move(data));
+    zmq::multipart_t multipart_msg(this->prepareMessage(msg));
+    this->sendPreparedMsg(multipart_msg, msg);
+}
+
 }} // END NAMESPACES.
 // =====================================================================================================================
@@ -111,7 +111,7 @@ void DebugClbkSubscriberBase::onInvalidMsgReceived(const PublishedMessage& msg,
     // Log.
     serializer::BinarySerializer serializer(msg.data.bytes.get(), msg.data.size);
     std::stringstream data;
-    data << "Publisher UUID: " << msg.publisher_uuid.toRFC4122String() << std::endl;
+    data << "Publisher UUID: " << msg.publisher_uuid << std::endl;
     data << "Topic:          " << msg.topic                            << std::endl;
     data << "Timestamp:      " << msg.timestamp                        << std::endl;
     data << "Result:         " << static_cast<ResultType>(res)
@@ -129,7 +129,7 @@ void DebugClbkSubscriberBase::onMsgReceived(const PublishedMessage &msg, Operati
     // Log.
     serializer::BinarySerializer serializer(msg.data.bytes.get(), msg.data.size);
     std::stringstream data;
-    data << "Publisher UUID: " << msg.publisher_uuid.toRFC4122String() << std::endl;
+    data << "Publisher UUID: " << msg.publisher_uuid << std::endl;
     data << "Topic:          " << msg.topic                            << std::endl;
     data << "Timestamp:      " << msg.timestamp                        << std::endl;
     data << "Result:         " << static_cast<ResultType>(res)
@@ -41,9 +41,13 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <algorithm>
+#include <array>
 #include <shared_mutex>
 #include <thread>
 #include <chrono>
+#include <deque>
+#include <unordered_map>
 // =====================================================================================================================
 
 // ZMQ INCLUDES
@@ -57,6 +61,7 @@
 #include "LibZMQUtils/PublisherSubscriber/subscriber/subscriber_base.h"
 #include "LibZMQUtils/Global/constants.h"
 #include "LibZMQUtils/InternalHelpers/network_helpers.h"
+#include "LibZMQUtils/InternalHelpers/zmq_helpers.h"
 #include "LibZMQUtils/Utilities/BinarySerializer/binary_serializer.h"
 #include "LibZMQUtils/Utilities/utils.h"
 // =====================================================================================================================
@@ -67,11 +72,65 @@ namespace zmqutils{
 namespace pubsub{
 // =====================================================================================================================
 
+// SUBSCRIBER CONTROL COMMANDS
+// =====================================================================================================================
+
+/// Commands that can be sent to the subscriber worker through the internal control socket.
+enum class SubscriberBase::ControlCommand : std::uint8_t
+{
+    EXIT        = 0,  ///< Close the worker.
+    SUBSCRIBE   = 1,  ///< Apply a new topic filter (ZMQ_SUBSCRIBE).
+    UNSUBSCRIBE = 2,  ///< Remove a topic filter (ZMQ_UNSUBSCRIBE).
+    CONNECT     = 3,  ///< Connect to a new publisher endpoint.
+    DISCONNECT  = 4   ///< Disconnect from a publisher endpoint.
+};
+
+// =====================================================================================================================
+
+// DISPATCH WORKERS DATA
+// =====================================================================================================================
+
+/// Data of each dispatch worker. Each worker processes the messages of the topics whose hash maps to it.
+struct SubscriberBase::DispatchShard
+{
+    /// Item stored in the dispatch queue.
+    using DispatchItem = SubscriberBase::PendingMsg;
+
+    std::deque<DispatchItem> queue;                                 ///< Pending messages.
+    std::unordered_map<TopicType, TopicDispatchStats> topic_stats;  ///< Dispatch statistics for each topic.
+    std::size_t max_queue_depth = 0;                                ///< Maximum queue depth reached.
+    std::uint64_t dropped_msgs = 0;                                 ///< Messages dropped by the queue policy.
+    std::mutex mtx;                                                 ///< Safety mutex (queue and statistics).
+    std::condition_variable cv;                                     ///< Condition variable for new messages.
+    bool stop = false;                                              ///< Flag for stopping the worker.
+    std::thread worker_th;                                          ///< Worker thread.
+    utils::ThreadCpuClock cpu_clock;                                ///< CPU time of the worker thread.
+};
+
+// =====================================================================================================================
+
 SubscriberBase::SubscriberBase(const std::string& subscriber_name,
                                const std::string& subscriber_version ,
                                const std::string& subscriber_info) :
     socket_(nullptr),
-    socket_pub_close_(nullptr),
+    dish_socket_(nullptr),
+    recv_ctrl_socket_(nullptr),
+    req_ctrl_socket_(nullptr),
+    worker_th_id_(std::thread::id()),
+    ctrl_req_id_(0),
+    process_fnc_gen_(1),
+    enabled_hooks_(static_cast<std::uint32_t>(SubscriberHook::ALL_HOOKS)),
+    latency_stats_period_(0),
+    flag_latency_stats_(false),
+    dispatch_workers_(0),
+    dispatch_policy_(DispatchQueuePolicy::UNBOUNDED),
+    dispatch_max_depth_(0),
+    rcv_hwm_(-1),
+    data_handler_id_(0),
+    dish_handler_id_(0),
+    ctrl_handler_id_(0),
+    latency_timer_id_(0),
+    strand_scheduled_(false),
     flag_working_(false)
 {
     // Get the client interfaces.
@@ -88,6 +147,9 @@ SubscriberBase::SubscriberBase(const std::string& subscriber_name,
     this->sub_info_.name = subscriber_name;
     this->sub_info_.version = subscriber_version;
     this->sub_info_.info = subscriber_info;
+
+    // Default name of the worker threads.
+    this->thread_config_.name = "zmq-sub";
 }
 
 const std::set<TopicType> &SubscriberBase::getTopicFilters() const
@@ -115,6 +177,11 @@ bool SubscriberBase::isWorking() const
     return this->flag_working_;
 }
 
+bool SubscriberBase::isContextInUse() const
+{
+    return this->isWorking();
+}
+
 bool SubscriberBase::startSubscriber()
 {
     // Safe mutex lock
@@ -124,15 +191,60 @@ bool SubscriberBase::startSubscriber()
     if (this->flag_working_)
         return true;
 
-    // Launch worker in other thread.
-    this->fut_worker_ = std::async(std::launch::async, &SubscriberBase::subscriberWorker, this);
+    // Clear the latency statistics, using one sink for each thread that processes messages.
+    {
+        std::lock_guard<std::mutex> latency_lock(this->latency_mtx_);
+        this->latency_sinks_.clear();
+        for (unsigned i = 0; i <= this->dispatch_workers_; i++)
+            this->latency_sinks_.push_back(std::make_unique<LatencySink>());
+    }
+
+    // Start the dispatch workers (if enabled) before receiving any message.
+    this->startDispatchWorkers();
+
+    // The shared reactor must be running.
+    const bool reactor_stopped = this->reactor_ && !this->reactor_->isRunning();
+
+    if (this->reactor_)
+    {
+        // Create the sockets in the reactor loop, which will own them while the subscriber is working.
+        if (!reactor_stopped)
+        {
+            this->reactor_promise_ = std::promise<void>();
+            this->fut_worker_ = this->reactor_promise_.get_future();
+            this->reactor_->execute([this]
+            {
+                this->resetSocket();
+                if (this->flag_working_)
+                    this->attachToReactor();
+                else
+                    this->reactor_promise_.set_value();
+            });
+        }
+    }
+    else
+    {
+        // Launch worker in other thread.
+        this->fut_worker_ = std::async(std::launch::async, &SubscriberBase::subscriberWorker, this);
+
+        // Wait for the worker deployment.
+        std::unique_lock<std::mutex> depl_lock(this->depl_mtx_);
+        this->cv_worker_depl_.wait(depl_lock);
+    }
+
+    // If the worker failed, stop the dispatch workers.
+    if (!this->flag_working_)
+        this->stopDispatchWorkers();
 
-    // Wait for the worker deployment.
-    std::unique_lock<std::mutex> depl_lock(this->depl_mtx_);
-    this->cv_worker_depl_.wait(depl_lock);
+    // Report the stopped reactor case (without the lock, so the callback can use the subscriber).
+    const bool working = this->flag_working_;
+    lock.unlock();
+    if (reactor_stopped)
+        this->onSubscriberError(zmq::error_t(),
+                                this->kScope + " The shared reactor must be running to start the subscriber.");
 
     // Return the worker status.
-    return this->flag_working_;
+    return working;
 }
 
 void SubscriberBase::stopSubscriber()
@@ -143,6 +255,12 @@ void SubscriberBase::stopSubscriber()
     // Call to the internal stop.
     this->internalStopSubscriber();
 
+    // Stop the dispatch workers. The pending messages will be processed before.
+    this->stopDispatchWorkers();
+
+    // Control mutex lock.
+    std::lock_guard<std::mutex> ctrl_lock(this->ctrl_mtx_);
+
     // Clean the subscribers.
     this->subscribed_publishers_.clear();
 
@@ -159,26 +277,44 @@ void SubscriberBase::subscribe(const std::string& pub_endpoint)
     if(pub_endpoint.empty())
         throw std::invalid_argument(this->kScope + " The publisher endpoint can't be empty.");
 
-    // Check if endpoint is already subscribed
-    auto it = std::find_if(this->subscribed_publishers_.begin(), this->subscribed_publishers_.end(),
-                          [&pub_endpoint](const auto& pair)
-    {
-        return pair.second.endpoint == pub_endpoint;
-    });
+    // Check the UDP transport availability.
+    if(internal_helpers::zmq_helpers::isUdpEndpoint(pub_endpoint) &&
+       !internal_helpers::zmq_helpers::kDraftApiAvailable)
+        throw std::invalid_argument(this->kScope + " The UDP transport requires the ZMQ draft API.");
+
+    // Control requests lock.
+    auto req_lock = this->lockCtrlRequests();
+
+    // Publisher container.
+    PublisherInfo pub_info;
 
-    // If endpoint is not subscribed, then store information.
-    if (it == this->subscribed_publishers_.end())
     {
+        // Control mutex lock.
+        std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+
+        // Check if endpoint is already subscribed
+        auto it = std::find_if(this->subscribed_publishers_.begin(), this->subscribed_publishers_.end(),
+                              [&pub_endpoint](const auto& pair)
+        {
+            return pair.second.endpoint == pub_endpoint;
+        });
+        if (it != this->subscribed_publishers_.end())
+            return;
+
         // TODO ¿De que sirve aqui usar un uuid inventado? pub-sub abstrae de esa parte.
         // Tal vez seria interesante actualizar la información a partir de los mensajes recibidos.
 
-        unsigned port = static_cast<unsigned>(std::stoi(pub_endpoint.substr(pub_endpoint.rfind(':') + 1)));
-        PublisherInfo pub_info(utils::UUID(), port, pub_endpoint);
+        // If endpoint is not subscribed, then store information.
+        unsigned port = internal_helpers::zmq_helpers::endpointPort(pub_endpoint);
+        pub_info = PublisherInfo(utils::UUIDGenerator::getInstance().generateUUIDv4(), port, pub_endpoint);
         this->subscribed_publishers_.insert({pub_info.uuid, pub_info});
+    }
 
-        // If socket is started, then reset to apply the change.
-        if (this->flag_working_)
-            this->resetSocket();
+    // If the subscriber is working, connect the socket to the new publisher. If it fails, discard the publisher.
+    if (!this->sendCtrlCommand(ControlCommand::CONNECT, pub_endpoint))
+    {
+        std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+        this->subscribed_publishers_.erase(pub_info.uuid);
     }
 }
 
@@ -188,21 +324,28 @@ void SubscriberBase::unsubscribe(const std::string &pub_endpoint)
     if(pub_endpoint.empty())
         return;
 
-    // Check if endpoint is subscribed
-    auto it = std::find_if(this->subscribed_publishers_.begin(), this->subscribed_publishers_.end(),
-    [&pub_endpoint](const auto& pair)
-    {
-        return pair.second.endpoint == pub_endpoint;
-    });
+    // Control requests lock.
+    auto req_lock = this->lockCtrlRequests();
 
-    if (it != this->subscribed_publishers_.end())
     {
+        // Control mutex lock.
+        std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+
+        // Check if endpoint is subscribed
+        auto it = std::find_if(this->subscribed_publishers_.begin(), this->subscribed_publishers_.end(),
+        [&pub_endpoint](const auto& pair)
+        {
+            return pair.second.endpoint == pub_endpoint;
+        });
+        if (it == this->subscribed_publishers_.end())
+            return;
+
         // If endpoint is subscribed, erase it.
         this->subscribed_publishers_.erase(it);
-        // If socket is started, then reset to apply the change.
-        if (this->flag_working_)
-            this->resetSocket();
     }
+
+    // If the subscriber is working, disconnect the socket from the publisher.
+    this->sendCtrlCommand(ControlCommand::DISCONNECT, pub_endpoint);
 }
 
 void SubscriberBase::addTopicFilter(const TopicType &filter)
@@ -210,10 +353,22 @@ void SubscriberBase::addTopicFilter(const TopicType &filter)
     // Avoid reserved topic
     if (filter != kReservedTopicExit)
     {
-        auto res = this->topic_filters_.insert(filter);
-        // If filter was applied, reset socket to apply the change if it is working.
-        if (res.second && this->flag_working_)
-            this->resetSocket();
+        // Control requests lock.
+        auto req_lock = this->lockCtrlRequests();
+
+        // Store the filter.
+        {
+            std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+            if (!this->topic_filters_.insert(filter).second)
+                return;
+        }
+
+        // If the subscriber is working, apply it to the socket. If it fails, discard the filter.
+        if (!this->sendCtrlCommand(ControlCommand::SUBSCRIBE, filter))
+        {
+            std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+            this->topic_filters_.erase(filter);
+        }
     }
 }
 
@@ -222,12 +377,238 @@ void SubscriberBase::removeTopicFilter(const TopicType &filter)
     // Avoid reserved topic
     if (filter != kReservedTopicExit)
     {
-        auto res = this->topic_filters_.erase(filter);
-        // If filter was applied, reset socket to apply the change if it is working.
-        if (res > 0 && this->flag_working_)
-            this->resetSocket();
+        // Control requests lock.
+        auto req_lock = this->lockCtrlRequests();
+
+        // Remove the filter.
+        {
+            std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+            if (this->topic_filters_.erase(filter) == 0)
+                return;
+        }
+
+        // If the subscriber is working, remove it from the socket.
+        this->sendCtrlCommand(ControlCommand::UNSUBSCRIBE, filter);
+    }
+}
+
+void SubscriberBase::cleanTopicFilters()
+{
+    // Control requests lock.
+    auto req_lock = this->lockCtrlRequests();
+
+    // Remove all the filters.
+    std::set<TopicType> filters;
+    {
+        std::lock_guard<std::mutex> lock(this->ctrl_mtx_);
+        filters.swap(this->topic_filters_);
+    }
+
+    // If the subscriber is working, remove them from the socket.
+    for (const auto& filter : filters)
+        this->sendCtrlCommand(ControlCommand::UNSUBSCRIBE, filter);
+}
+
+void SubscriberBase::setDispatchWorkers(unsigned workers)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->dispatch_workers_ = workers;
+}
+
+void SubscriberBase::setEnabledHooks(std::uint32_t hooks)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->enabled_hooks_ = hooks;
+}
+
+unsigned SubscriberBase::getDispatchWorkers() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->dispatch_workers_;
+}
+
+void SubscriberBase::setDispatchQueuePolicy(DispatchQueuePolicy policy, std::size_t max_depth)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the values if the subscriber is stopped. A bounded queue needs a maximum depth.
+    if (this->flag_working_ || (DispatchQueuePolicy::DROP_OLDEST == policy && 0 == max_depth))
+        return;
+    this->dispatch_policy_ = policy;
+    this->dispatch_max_depth_ = (DispatchQueuePolicy::UNBOUNDED == policy) ? 0 : max_depth;
+}
+
+DispatchQueuePolicy SubscriberBase::getDispatchQueuePolicy() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->dispatch_policy_;
+}
+
+std::size_t SubscriberBase::getDispatchQueueMaxDepth() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->dispatch_max_depth_;
+}
+
+void SubscriberBase::setReceiveHWM(int hwm)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->rcv_hwm_ = hwm;
+}
+
+int SubscriberBase::getReceiveHWM() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->rcv_hwm_;
+}
+
+void SubscriberBase::setSocketOptions(const SocketOptions& options)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->socket_options_ = options;
+}
+
+SocketOptions SubscriberBase::getSocketOptions() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->socket_options_;
+}
+
+SocketOptions SubscriberBase::getAppliedSocketOptions() const
+{
+    // The socket is created in the worker with the control mutex.
+    std::unique_lock<std::mutex> lock(this->ctrl_mtx_);
+    return this->applied_socket_options_;
+}
+
+void SubscriberBase::setReactor(std::shared_ptr<ZMQReactor> reactor)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->reactor_ = std::move(reactor);
+}
+
+std::shared_ptr<ZMQReactor> SubscriberBase::getReactor() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->reactor_;
+}
+
+void SubscriberBase::setWorkerThreadConfig(const utils::ThreadConfig &config)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the value if the subscriber is stopped.
+    if (!this->flag_working_)
+        this->thread_config_ = config;
+}
+
+utils::ThreadConfig SubscriberBase::getWorkerThreadConfig() const
+{
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+    return this->thread_config_;
+}
+
+std::chrono::nanoseconds SubscriberBase::getWorkerCpuTime() const
+{
+    return this->worker_cpu_clock_.elapsed();
+}
+
+SubscriberDispatchStats SubscriberBase::getDispatchStats() const
+{
+    // Safe mutex lock
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Stats container.
+    SubscriberDispatchStats stats;
+
+    // Get the stats of each dispatch worker. Each topic is always processed by the same worker.
+    auto now = std::chrono::system_clock::now();
+    for (const auto& shard : this->dispatch_shards_)
+    {
+        std::lock_guard<std::mutex> shard_lock(shard->mtx);
+        stats.queue_depths.push_back(shard->queue.size());
+        stats.max_queue_depths.push_back(shard->max_queue_depth);
+        stats.dropped_msgs.push_back(shard->dropped_msgs);
+        stats.queue_lags.push_back(shard->queue.empty() ? std::chrono::nanoseconds(0) :
+                                       std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                           now - shard->queue.front().msg.recv_tp));
+        stats.cpu_times.push_back(shard->cpu_clock.elapsed());
+        for (const auto& topic_stats : shard->topic_stats)
+            stats.topics.insert(topic_stats);
+    }
+
+    // Return the stats.
+    return stats;
+}
+
+std::map<utils::UUID, PublisherSequenceStats> SubscriberBase::getSequenceStats() const
+{
+    std::lock_guard<std::mutex> lock(this->seq_mtx_);
+    return this->seq_stats_;
+}
+
+void SubscriberBase::resetSequenceStats()
+{
+    std::lock_guard<std::mutex> lock(this->seq_mtx_);
+    this->seq_stats_.clear();
+}
+
+void SubscriberBase::setLatencyStatsEnabled(bool enabled, std::chrono::milliseconds period)
+{
+    // Safe mutex lock
+    std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Only update the values if the subscriber is stopped.
+    if (!this->flag_working_)
+    {
+        this->flag_latency_stats_ = enabled;
+        this->latency_stats_period_ = period;
+    }
+}
+
+std::map<TopicType, TopicLatencyStats> SubscriberBase::getLatencyStats() const
+{
+    // Stats container.
+    std::map<TopicType, TopicLatencyStats> stats;
+
+    // Merge the statistics of each thread.
+    std::lock_guard<std::mutex> lock(this->latency_mtx_);
+    for (const auto& sink : this->latency_sinks_)
+    {
+        std::lock_guard<std::mutex> sink_lock(sink->mtx);
+        for (const auto& topic_stats : sink->stats)
+        {
+            TopicLatencyStats& merged = stats[topic_stats.first];
+            merged.queueing.merge(topic_stats.second.queueing);
+            merged.wire.merge(topic_stats.second.wire);
+            merged.dispatch.merge(topic_stats.second.dispatch);
+        }
     }
 
+    // Return the stats.
+    return stats;
 }
 
 std::string SubscriberBase::operationResultToString(OperationResult result)
@@ -259,58 +640,72 @@ void SubscriberBase::internalStopSubscriber()
     // Set the shared working flag to false (is atomic).
     this->flag_working_ = false;
 
+    // Wait for the control requests in progress, which are still served by the worker. The new requests will see the
+    // working flag, so they will never use the control socket after this point.
+    {
+        std::lock_guard<std::mutex> req_lock(this->ctrl_req_mtx_);
+    }
+
     // If the worker is active.
     if(this->fut_worker_.valid() &&
         this->fut_worker_.wait_for(std::chrono::seconds(0)) == std::future_status::timeout)
     {
-        // Message for closing.
-
-        // Serializer.
-        serializer::BinarySerializer serializer;
-
-        // Prepare the topic. This must come plain, since it is used by ZMQ topic filtering.
-        zmq::message_t msg_topic{TopicType(kReservedTopicExit)};
-
-        // Prepare the close socket uuid.
-        size_t uuid_size = serializer.write(this->socket_close_uuid_.getBytes());
-        zmq::message_t msg_uuid(serializer.release(), uuid_size, serializer::del_byte_ptr);
-
-        // Prepare the timestamp.
-        size_t ts_size = serializer.write(utils::currentISO8601Date(true, false, true));
-        zmq::message_t msg_ts(serializer.release(), ts_size, serializer::del_byte_ptr);
-
-        // Information is empty.
-        zmq::message_t msg_info;
-
-        // Prepare the multipart msg.
-        zmq::multipart_t multipart_msg;
-        multipart_msg.add(std::move(msg_topic));
-        multipart_msg.add(std::move(msg_uuid));
-        multipart_msg.add(std::move(msg_ts));
-        multipart_msg.add(std::move(msg_info));
-
-        // Send the message.
-        multipart_msg.send(*this->socket_pub_close_);
+        if (this->reactor_)
+        {
+            // Unregister the sockets from the reactor loop (directly, if the loop is not running).
+            this->reactor_->execute([this]{ this->detachFromReactor(); });
+        }
+        else
+        {
+            // Send the exit command through the control socket. The worker does not reply to this command.
+            std::lock_guard<std::mutex> req_lock(this->ctrl_req_mtx_);
+            zmq::multipart_t ctrl_msg;
+            ctrl_msg.addtyp(ControlCommand::EXIT);
+            ctrl_msg.addtyp(std::uint64_t(0));
+            ctrl_msg.addstr(std::string());
+            ctrl_msg.send(*this->req_ctrl_socket_);
+        }
 
         // Wait the future.
         this->fut_worker_.wait();
     }
 
-    // Delete the sockets.
+    // Wait until the reactor executors have processed the pending messages.
+    {
+        std::unique_lock<std::mutex> strand_lock(this->strand_mtx_);
+        this->strand_cv_.wait(strand_lock, [this]{ return !this->strand_scheduled_; });
+    }
+
+    // Delete the sockets. From now on, no thread is the worker thread.
+    this->deleteSockets();
+    this->worker_th_id_ = std::thread::id();
+}
+
+void SubscriberBase::deleteSockets()
+{
     if(this->socket_)
     {
         delete this->socket_;
         this->socket_ = nullptr;
     }
 
-    if (this->socket_pub_close_)
+    if(this->dish_socket_)
+    {
+        delete this->dish_socket_;
+        this->dish_socket_ = nullptr;
+    }
+
+    if (this->recv_ctrl_socket_)
     {
-        delete this->socket_pub_close_;
-        this->socket_pub_close_ = nullptr;
+        delete this->recv_ctrl_socket_;
+        this->recv_ctrl_socket_ = nullptr;
     }
 
-    // Safe sleep.
-    //std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    if (this->req_ctrl_socket_)
+    {
+        delete this->req_ctrl_socket_;
+        this->req_ctrl_socket_ = nullptr;
+    }
 }
 
 SubscriberBase::~SubscriberBase()
@@ -319,54 +714,353 @@ SubscriberBase::~SubscriberBase()
     // Warning: In this case the onSubscriberStop callback can't be executed.
     std::unique_lock<std::shared_mutex> lock(this->sub_mtx_);
     this->internalStopSubscriber();
+    this->stopDispatchWorkers();
     this->subscribed_publishers_.clear();
     this->topic_filters_.clear();
 }
 
-void SubscriberBase::subscriberWorker()
+void SubscriberBase::startDispatchWorkers()
 {
-    // Containers.
-    OperationResult result;
-    PublishedMessage msg;
+    // Delete the shards of the previous execution.
+    this->dispatch_shards_.clear();
+
+    // Create the shards and launch one worker for each one.
+    for (unsigned i = 0; i < this->dispatch_workers_; i++)
+        this->dispatch_shards_.push_back(std::make_unique<DispatchShard>());
+    for (std::size_t i = 0; i < this->dispatch_shards_.size(); i++)
+        this->dispatch_shards_[i]->worker_th = std::thread(&SubscriberBase::dispatchWorker, this,
+                                                           std::ref(*this->dispatch_shards_[i]), i);
+}
 
-    // Start subscriber socket
-    this->resetSocket();
+void SubscriberBase::stopDispatchWorkers()
+{
+    // Notify all the workers. They will finish after processing the pending messages.
+    for (auto& shard : this->dispatch_shards_)
+    {
+        std::lock_guard<std::mutex> lock(shard->mtx);
+        shard->stop = true;
+        shard->cv.notify_one();
+    }
+
+    // Wait the workers.
+    for (auto& shard : this->dispatch_shards_)
+    {
+        if (shard->worker_th.joinable())
+            shard->worker_th.join();
+    }
+}
+
+void SubscriberBase::dispatchWorker(DispatchShard& shard, std::size_t index)
+{
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_, "/" + std::to_string(index)))
+        this->onSubscriberError(zmq::error_t(), this->kScope + " The thread configuration of the dispatch worker " +
+                                std::to_string(index) + " was not fully applied.");
+    auto cpu_attachment = shard.cpu_clock.attach();
 
     // Worker loop.
-    while(this->flag_working_ && this->socket_)
+    while (true)
     {
-        // Receive the data.
-        result = this->recvFromSocket(msg);
+        // Wait for a new msg in the queue or the stop request.
+        std::unique_lock<std::mutex> lock(shard.mtx);
+        shard.cv.wait(lock, [&shard]{return shard.stop || !shard.queue.empty();});
+
+        // Stop the worker case (only when all the pending messages are processed).
+        if (shard.queue.empty())
+            break;
+
+        // Get the msg.
+        DispatchShard::DispatchItem item = std::move(shard.queue.front());
+        shard.queue.pop_front();
+        lock.unlock();
+
+        // Process the msg measuring the time spent in the callbacks.
+        auto start = std::chrono::steady_clock::now();
+        this->processMsg(item.msg, item.result, item.route, index + 1);
+        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+        // Update the topic stats.
+        lock.lock();
+        TopicDispatchStats& stats = shard.topic_stats[item.msg.topic];
+        stats.processed_msgs++;
+        stats.total_clbk_time += elapsed;
+        stats.last_clbk_time = elapsed;
+        stats.max_clbk_time = std::max(stats.max_clbk_time, elapsed);
+    }
+}
+
+void SubscriberBase::dispatchMsg(PublishedMessage&& msg, OperationResult result, const MsgRoute& route)
+{
+    // Select the shard using the topic, so the order of the messages of each topic is preserved. The hash of the
+    // topics received as identifiers is already cached.
+    std::size_t hash = route.resolved ? route.topic_hash : std::hash<TopicType>{}(msg.topic);
+    std::size_t idx = hash % this->dispatch_shards_.size();
+    DispatchShard& shard = *this->dispatch_shards_[idx];
 
-        // Process the data.
-        if(result == OperationResult::OPERATION_OK && !this->flag_working_)
+    // Enqueue the message. This never waits for the user code, only for the queue access.
+    {
+        std::lock_guard<std::mutex> lock(shard.mtx);
+
+        // Conflate policy. If there is a pending message of the same topic, it is replaced by the new one.
+        if (DispatchQueuePolicy::CONFLATE == this->dispatch_policy_ && OperationResult::OPERATION_OK == result)
         {
-            // In this case, we will close the subscriber.
+            auto it = std::find_if(shard.queue.begin(), shard.queue.end(), [&msg](const DispatchShard::DispatchItem& item)
+            {
+                return OperationResult::OPERATION_OK == item.result && item.msg.topic == msg.topic;
+            });
+            if (it != shard.queue.end())
+            {
+                it->msg = std::move(msg);
+                it->route = route;
+                shard.dropped_msgs++;
+                shard.topic_stats[it->msg.topic].dropped_msgs++;
+                return;
+            }
         }
-        else if (result != OperationResult::OPERATION_OK)
+
+        // Bounded queue. If it is full, the oldest message is dropped.
+        if (this->dispatch_max_depth_ > 0 && shard.queue.size() >= this->dispatch_max_depth_)
         {
-            // Internal callback.
+            shard.dropped_msgs++;
+            shard.topic_stats[shard.queue.front().msg.topic].dropped_msgs++;
+            shard.queue.pop_front();
+        }
+
+        // Enqueue the new message.
+        shard.queue.push_back({std::move(msg), result, route});
+        shard.max_queue_depth = std::max(shard.max_queue_depth, shard.queue.size());
+    }
+
+    // Notify the worker.
+    shard.cv.notify_one();
+}
+
+void SubscriberBase::processMsg(const PublishedMessage &msg, OperationResult result, const MsgRoute& route,
+                                std::size_t latency_sink)
+{
+    // Invalid message case.
+    if (result != OperationResult::OPERATION_OK)
+    {
+        // Internal callback.
+        if (this->isHookEnabled(SubscriberHook::INVALID_MSG_RECEIVED))
             this->onInvalidMsgReceived(msg, result);
+        return;
+    }
+
+    // Find the functor (already resolved for the topics received as identifiers).
+    const ProcessFunction* func = route.resolved ? route.func : this->process_fnc_map_.find(msg.topic);
+
+    // Update the result value.
+    result = func ? OperationResult::OPERATION_OK : OperationResult::NOT_IMPLEMENTED;
+
+    // Update the latency statistics. Each thread has its own sink, so the lock is only shared with the merge.
+    if (this->flag_latency_stats_ && msg.recv_tp != StampTimePoint() && latency_sink < this->latency_sinks_.size())
+    {
+        auto dispatch_tp = std::chrono::system_clock::now();
+        LatencySink& sink = *this->latency_sinks_[latency_sink];
+        std::lock_guard<std::mutex> lock(sink.mtx);
+        TopicLatencyStats& stats = sink.stats[msg.topic];
+        stats.queueing.addSample(msg.send_tp - msg.enqueue_tp);
+        stats.wire.addSample(msg.recv_tp - msg.send_tp);
+        stats.dispatch.addSample(dispatch_tp - msg.recv_tp);
+    }
+
+    // Call callback for msg received.
+    if (this->isHookEnabled(SubscriberHook::MSG_RECEIVED))
+        this->onMsgReceived(msg, result);
+
+    // Invoke the function if implemented.
+    if(func)
+        (*func)(msg);
+}
+
+void SubscriberBase::subscriberWorker()
+{
+    // Apply the thread configuration and measure the CPU time of the worker.
+    if (!utils::applyThreadConfig(this->thread_config_))
+        this->onSubscriberError(zmq::error_t(), this->kScope + " The thread configuration was not fully applied.");
+    auto cpu_attachment = this->worker_cpu_clock_.attach();
+
+    // Start subscriber socket
+    this->resetSocket();
+
+    // Check the sockets.
+    if (!this->flag_working_ || !this->socket_)
+        return;
+
+    // Poller items for the subscriber socket, the control socket and the dish socket (if it exists). The dish
+    // socket can be created by a control command, so the items are updated in each iteration.
+    std::array<zmq::pollitem_t, 3> items;
+
+    // Periodic latency statistics callback configuration.
+    const bool latency_clbk = this->flag_latency_stats_ && this->latency_stats_period_.count() > 0;
+    auto next_latency_clbk = std::chrono::steady_clock::now() + this->latency_stats_period_;
+
+    // Worker loop. It finishes only with the exit command, so pending control commands are always answered.
+    while(true)
+    {
+        // Wait for data or control commands.
+        try
+        {
+            items[0] = { static_cast<void*>(*this->socket_),           0, ZMQ_POLLIN, 0 };
+            items[1] = { static_cast<void*>(*this->recv_ctrl_socket_), 0, ZMQ_POLLIN, 0 };
+            if (this->dish_socket_)
+                items[2] = { static_cast<void*>(*this->dish_socket_),  0, ZMQ_POLLIN, 0 };
+            std::chrono::milliseconds timeout(-1);
+            if (latency_clbk)
+                timeout = std::max(std::chrono::milliseconds(0),
+                                   std::chrono::duration_cast<std::chrono::milliseconds>(
+                                       next_latency_clbk - std::chrono::steady_clock::now()));
+            zmq::poll(items.data(), this->dish_socket_ ? 3 : 2, timeout);
         }
-        else if (result == OperationResult::OPERATION_OK)
+        catch(const zmq::error_t& error)
         {
-            // Fin the functor.
-            auto iter = process_fnc_map_.find(msg.topic);
+            // Interrupted system call, try again.
+            if (error.num() == EINTR)
+                continue;
 
-            // Update the result value.
-            result = (iter == process_fnc_map_.end()) ? OperationResult::NOT_IMPLEMENTED : OperationResult::OPERATION_OK;
+            // Else, call to error callback and finish the worker.
+            this->onSubscriberError(error, this->kScope + " Error while polling the sockets.");
+            break;
+        }
 
-            // Call callback for msg received.
-            this->onMsgReceived(msg, result);
+        // Process the control commands. They are always executed in this thread, which owns the sockets.
+        if ((items[1].revents & ZMQ_POLLIN) && this->processCtrlCommand())
+            break;
 
-            // Invoke the function if implemented.
-            if(iter != process_fnc_map_.end())
-                iter->second(msg);
+        // Periodic latency statistics callback.
+        if (latency_clbk && std::chrono::steady_clock::now() >= next_latency_clbk)
+        {
+            this->onLatencyStats(this->getLatencyStats());
+            next_latency_clbk += this->latency_stats_period_;
         }
+
+        // Check if there is data (in the subscriber socket or in the dish socket).
+        zmq::socket_t* data_socket = nullptr;
+        if (items[0].revents & ZMQ_POLLIN)
+            data_socket = this->socket_;
+        else if (this->dish_socket_ && (items[2].revents & ZMQ_POLLIN))
+            data_socket = this->dish_socket_;
+        else
+            continue;
+
+        // Receive and process the data.
+        this->processSocketData(*data_socket);
+
     } // Finish the worker.
 }
 
-OperationResult SubscriberBase::recvFromSocket(PublishedMessage& msg)
+void SubscriberBase::processSocketData(zmq::socket_t &socket)
+{
+    // Message container (it can be moved to the dispatch workers).
+    PublishedMessage msg;
+    MsgRoute route;
+    bool discard = false;
+
+    // Receive the data.
+    OperationResult result = this->recvFromSocket(socket, msg, discard, route);
+
+    // Internal messages are not processed.
+    if (discard)
+        return;
+
+    // Process the data.
+    if(result == OperationResult::OPERATION_OK && !this->flag_working_)
+    {
+        // In this case, we will close the subscriber.
+    }
+    else if (this->dispatch_workers_ > 0)
+    {
+        // Hand the message to the dispatch workers.
+        this->dispatchMsg(std::move(msg), result, route);
+    }
+    else if (this->reactor_ && this->reactor_->getExecutorThreads() > 0)
+    {
+        // Hand the message to the reactor executors.
+        this->strandMsg(std::move(msg), result, route);
+    }
+    else
+    {
+        // Process the message in this thread.
+        this->processMsg(msg, result, route, 0);
+    }
+}
+
+void SubscriberBase::attachToReactor()
+{
+    // Subscriber socket and control socket.
+    if (0 == this->data_handler_id_)
+        this->data_handler_id_ = this->reactor_->addSocket(*this->socket_,
+                                                           [this]{ this->processSocketData(*this->socket_); });
+    if (0 == this->ctrl_handler_id_)
+        this->ctrl_handler_id_ = this->reactor_->addSocket(*this->recv_ctrl_socket_, [this]
+        {
+            if (this->processCtrlCommand())
+                this->detachFromReactor();
+        });
+
+    // Dish socket (it can be created later by a control command).
+    if (this->dish_socket_ && 0 == this->dish_handler_id_)
+        this->dish_handler_id_ = this->reactor_->addSocket(*this->dish_socket_,
+                                                           [this]{ this->processSocketData(*this->dish_socket_); });
+
+    // Periodic latency statistics callback.
+    if (this->flag_latency_stats_ && this->latency_stats_period_.count() > 0 && 0 == this->latency_timer_id_)
+        this->latency_timer_id_ = this->reactor_->addTimer(this->latency_stats_period_,
+                                                           [this]{ this->onLatencyStats(this->getLatencyStats()); });
+}
+
+void SubscriberBase::detachFromReactor()
+{
+    // Unregister every socket and timer.
+    for (ZMQReactor::HandlerId* id : {&this->data_handler_id_, &this->dish_handler_id_, &this->ctrl_handler_id_})
+    {
+        this->reactor_->removeSocket(*id);
+        *id = 0;
+    }
+    this->reactor_->removeTimer(this->latency_timer_id_);
+    this->latency_timer_id_ = 0;
+
+    // Finish the worker.
+    this->reactor_promise_.set_value();
+}
+
+void SubscriberBase::strandMsg(PublishedMessage &&msg, OperationResult result, const MsgRoute& route)
+{
+    // Queue the message. If the strand is not scheduled, schedule it.
+    {
+        std::lock_guard<std::mutex> lock(this->strand_mtx_);
+        this->strand_queue_.push_back({std::move(msg), result, route});
+        if (this->strand_scheduled_)
+            return;
+        this->strand_scheduled_ = true;
+    }
+    this->reactor_->submit([this]{ this->strandWorker(); });
+}
+
+void SubscriberBase::strandWorker()
+{
+    // Process the pending messages in order. Only one strand task exists at a time.
+    while (true)
+    {
+        PendingMsg item;
+        {
+            std::lock_guard<std::mutex> lock(this->strand_mtx_);
+            if (this->strand_queue_.empty())
+            {
+                this->strand_scheduled_ = false;
+                this->strand_cv_.notify_all();
+                return;
+            }
+            item = std::move(this->strand_queue_.front());
+            this->strand_queue_.pop_front();
+        }
+        this->processMsg(item.msg, item.result, item.route, 0);
+    }
+}
+
+OperationResult SubscriberBase::recvFromSocket(zmq::socket_t& socket, PublishedMessage& msg, bool& discard,
+                                               MsgRoute& route)
 {
     // Result variable.
     OperationResult result = OperationResult::OPERATION_OK;
@@ -374,12 +1068,26 @@ OperationResult SubscriberBase::recvFromSocket(PublishedMessage& msg)
     // Containers.
     bool recv_result;
     zmq::multipart_t multipart_msg;
+    const bool is_dish = (&socket == this->dish_socket_);
 
     // Try to receive data. If an execption is thrown, receiving fails and an error code is generated.
     try
     {
         // Wait the command.
-        recv_result = multipart_msg.recv(*(this->socket_));
+        if (is_dish)
+        {
+            // The dish messages are single datagrams with the packed parts.
+            zmq::message_t packed;
+            recv_result = socket.recv(packed).has_value();
+            msg.recv_tp = std::chrono::system_clock::now();
+            if (recv_result && !internal_helpers::zmq_helpers::unpackMultipart(packed, multipart_msg))
+                return OperationResult::INVALID_PARTS;
+        }
+        else
+        {
+            recv_result = multipart_msg.recv(socket);
+            msg.recv_tp = std::chrono::system_clock::now();
+        }
     }
     catch(zmq::error_t& error)
     {
@@ -397,106 +1105,216 @@ OperationResult SubscriberBase::recvFromSocket(PublishedMessage& msg)
     if (multipart_msg.empty())
         return OperationResult::EMPTY_MSG;
 
-    // Check the multipart msg size.
-    if (recv_result && (multipart_msg.size() == 4 || multipart_msg.size() == 5))
-    {
-        // Get the multipart data.
-        zmq::message_t msg_topic = multipart_msg.pop();
-        zmq::message_t msg_uuid = multipart_msg.pop();
-        zmq::message_t msg_time = multipart_msg.pop();
+    // Check the reception.
+    if (!recv_result)
+        return OperationResult::INVALID_PARTS;
 
-        // Get the topic. Topic is not serialized using BinarySerializer, since it must come plain.
-        msg.topic = msg_topic.to_string();
+    // Decode the message frames.
+    TopicId topic_id;
+    bool is_topic_id;
+    result = SubscriberBase::decodeMessage(multipart_msg, msg, is_topic_id, topic_id);
+    if (result != OperationResult::OPERATION_OK && result != OperationResult::EMPTY_PARAMS)
+        return result;
 
-        // Get the publisher uuid data.
-        if (msg_uuid.size() == utils::UUID::kUUIDSize + sizeof(serializer::SizeUnit)*2)
+    // Resolve the topic identifier using the table announced by the publisher.
+    if (is_topic_id)
+    {
+        auto it = this->topic_ids_cache_.find(msg.publisher_uuid);
+        if (it == this->topic_ids_cache_.end() || topic_id >= it->second.size() || it->second[topic_id].name.empty())
+            return OperationResult::UNKNOWN_TOPIC_ID;
+
+        // Apply the topic filters to the resolved topic. The identifiers frames can be shared by several publishers,
+        // so the socket subscription is not enough.
+        TopicIdEntry& entry = it->second[topic_id];
+        if (!entry.allowed)
         {
-            std::array<std::byte, 16> uuid_bytes;
-            serializer::BinarySerializer::fastDeserialization(msg_uuid.data(), msg_uuid.size(), uuid_bytes);
-            msg.publisher_uuid = utils::UUID(uuid_bytes);
+            discard = true;
+            return OperationResult::OPERATION_OK;
         }
-        else
-            return OperationResult::INVALID_PUB_UUID;
 
-        // If exit topic was issued, check if uuid matches the close publisher and return.
-        // No more info is necessary.
-        if (kReservedTopicExit == msg.topic)
+        // Resolve the process function only if the registered functions changed (only possible between runs).
+        if (entry.func_gen != this->process_fnc_gen_)
         {
-            if (this->socket_close_uuid_ == msg.publisher_uuid)
-                return OperationResult::OPERATION_OK;
-            else
-                return OperationResult::INVALID_PARTS;
+            entry.func = this->process_fnc_map_.find(entry.name);
+            entry.func_gen = this->process_fnc_gen_;
         }
+        route.func = entry.func;
+        route.topic_hash = entry.topic_hash;
+        route.resolved = true;
+        msg.topic = entry.name;
+    }
 
-        // Get the timestamp.
-        serializer::BinarySerializer::fastDeserialization(msg_time.data(), msg_time.size(), msg.timestamp);
+    // The reserved exit topic can't be used by the publishers.
+    if (kReservedTopicExit == msg.topic)
+        return OperationResult::INVALID_PARTS;
 
-        // TODO WARNING: WE CANT UPDATE THE STORED INFO BECAUSE IN ZMQ YOU CANT KNOW WHAT PUBLISHER SENDS THE MSG. IN
-        // THIS CASE MAYBE YOU CAN PUBLISH A PUBLISHER INFORMATION TOPIC FOR ASSOCIATE THE UUID WITH SPECIFIC
-        // PUBLISHER INFORMATION IN THE PUBLISHERS MAP.
+    // The dish groups are truncated, so the topic filters must be checked again for the dish messages.
+    if (is_dish && !is_topic_id && kReservedTopicTopicIds != msg.topic &&
+        std::none_of(this->worker_filters_.begin(), this->worker_filters_.end(),
+                     [&msg](const TopicType& filter){return msg.topic.compare(0, filter.size(), filter) == 0;}))
+    {
+        discard = true;
+        return OperationResult::OPERATION_OK;
+    }
 
-        // If there is still one more part, it is the message data.
-        if (multipart_msg.size() == 1)
-        {
-            // Get the message and the size.
-            zmq::message_t message_data = multipart_msg.pop();
+    // Track the sequence numbers.
+    this->trackSequences(msg);
 
-            // Check the parameters.
-            if(message_data.size() > 0)
-            {
-                // Get and store the parameters data.
-                serializer::BinarySerializer serializer(message_data.data(), message_data.size());
-                msg.data.size = serializer.moveUnique(msg.data.bytes);
-            }
-            else
-                return OperationResult::EMPTY_PARAMS;
-        }
+    // TODO WARNING: WE CANT UPDATE THE STORED INFO BECAUSE IN ZMQ YOU CANT KNOW WHAT PUBLISHER SENDS THE MSG. IN
+    // THIS CASE MAYBE YOU CAN PUBLISH A PUBLISHER INFORMATION TOPIC FOR ASSOCIATE THE UUID WITH SPECIFIC
+    // PUBLISHER INFORMATION IN THE PUBLISHERS MAP.
+
+    // Topic identifiers announcements case.
+    if (kReservedTopicTopicIds == msg.topic)
+    {
+        this->processTopicIdsAnnouncement(msg);
+        discard = true;
     }
-    else
-        return OperationResult::INVALID_PARTS;
 
     // Return the result.
     return result;
 }
 
-void SubscriberBase::resetSocket()
+OperationResult SubscriberBase::decodeMessage(zmq::multipart_t &frames, PublishedMessage &msg, bool &is_topic_id,
+                                              TopicId &topic_id)
 {
-    // Auxiliar variables.
-    const zmq::error_t* last_error;
+    // Check the multipart msg size.
+    is_topic_id = false;
+    if (frames.size() != 4 && frames.size() != 5)
+        return OperationResult::INVALID_PARTS;
 
-    // Stop the socket.
-    this->internalStopSubscriber();
+    // Get the multipart data.
+    zmq::message_t msg_topic = frames.pop();
+    zmq::message_t msg_uuid = frames.pop();
+    zmq::message_t msg_time = frames.pop();
+    zmq::message_t msg_seq = frames.pop();
+
+    // Get the topic. Topic is not serialized using BinarySerializer, since it must come plain. It can also be an
+    // interned topic identifier, that must be resolved by the caller when the publisher uuid is known.
+    is_topic_id = parseTopicIdFrame(msg_topic.to_string_view(), topic_id);
+    if (!is_topic_id)
+        msg.topic = msg_topic.to_string();
+
+    // Get the publisher uuid data.
+    if (msg_uuid.size() == utils::UUID::kUUIDSize + sizeof(serializer::SizeUnit)*2)
+    {
+        std::array<std::byte, 16> uuid_bytes;
+        serializer::BinarySerializer::fastDeserialization(msg_uuid.data(), msg_uuid.size(), uuid_bytes);
+        msg.publisher_uuid = utils::UUID(uuid_bytes);
+    }
+    else
+        return OperationResult::INVALID_PUB_UUID;
+
+    // Get the timestamp.
+    serializer::BinarySerializer::fastDeserialization(msg_time.data(), msg_time.size(), msg.timestamp);
+
+    // Get the header (sequence numbers and binary time stamps).
+    if (msg_seq.size() == (sizeof(SequenceType) + sizeof(std::int64_t) + sizeof(serializer::SizeUnit) * 2) * 2)
+    {
+        std::int64_t enqueue_ns, send_ns;
+        serializer::BinarySerializer::fastDeserialization(msg_seq.data(), msg_seq.size(),
+                                                          msg.sequence, msg.topic_sequence, enqueue_ns, send_ns);
+        msg.enqueue_tp = StampTimePoint(std::chrono::duration_cast<StampTimePoint::duration>(
+            std::chrono::nanoseconds(enqueue_ns)));
+        msg.send_tp = StampTimePoint(std::chrono::duration_cast<StampTimePoint::duration>(
+            std::chrono::nanoseconds(send_ns)));
+    }
+    else
+        return OperationResult::INVALID_PARTS;
+
+    // If there is still one more part, it is the message data.
+    if (frames.size() == 1)
+    {
+        // Get the message and the size.
+        zmq::message_t message_data = frames.pop();
+
+        // Check the parameters.
+        if(message_data.size() > 0)
+        {
+            // Get and store the parameters data.
+            serializer::BinarySerializer serializer(message_data.data(), message_data.size());
+            msg.data.size = serializer.moveUnique(msg.data.bytes);
+        }
+        else
+            return OperationResult::EMPTY_PARAMS;
+    }
+
+    // All ok.
+    return OperationResult::OPERATION_OK;
+}
+
+void SubscriberBase::injectMsg(PublishedMessage &&msg)
+{
+    // Safe mutex lock (the dispatch workers can't be stopped meanwhile).
+    std::shared_lock<std::shared_mutex> lock(this->sub_mtx_);
+
+    // Hand the message to the dispatch workers or process it in this thread.
+    if (this->flag_working_ && !this->dispatch_shards_.empty())
+        this->dispatchMsg(std::move(msg), OperationResult::OPERATION_OK, MsgRoute());
+    else
+        this->processMsg(msg, OperationResult::OPERATION_OK, MsgRoute(), 0);
+}
+
+void SubscriberBase::resetSocket()
+{
+    // Delete the previous sockets.
+    this->deleteSockets();
 
     // Try creating a new socket.
     try
     {
+        // Control mutex lock (publishers and filters).
+        std::unique_lock<std::mutex> ctrl_lock(this->ctrl_mtx_);
+
         // Create the ZMQ sub socket.
-        auto close_endpoint = "inproc://" + this->sub_info_.uuid.toRFC4122String();
         this->socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::sub);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
         this->socket_->set(zmq::sockopt::linger, 0);
-        this->socket_->connect(close_endpoint);
-        std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        this->socket_->set(zmq::sockopt::subscribe, kReservedTopicExit);
+        applySocketOptions(*this->socket_, this->socket_options_);
+        if (this->rcv_hwm_ >= 0)
+            this->socket_->set(zmq::sockopt::rcvhwm, this->rcv_hwm_);
+        this->applied_socket_options_ = readSocketOptions(*this->socket_);
 
-        // Connect to subscribed publishers
+        // Connect to subscribed publishers (the UDP endpoints are bound later in the dish socket).
         for (const auto& publishers : this->subscribed_publishers_)
         {
-            this->socket_->connect(publishers.second.endpoint);
-            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            if (!internal_helpers::zmq_helpers::isUdpEndpoint(publishers.second.endpoint))
+                this->socket_->connect(publishers.second.endpoint);
         }
 
         // Set all topic filters
         for (const auto& topic: this->topic_filters_)
-        {
             this->socket_->set(zmq::sockopt::subscribe, topic);
+
+        // Set the topic identifiers announcements filter. The identifiers frames are subscribed one by one when
+        // their names are announced.
+        this->socket_->set(zmq::sockopt::subscribe, kReservedTopicTopicIds);
+        this->subscribed_topic_ids_.clear();
+        this->worker_filters_ = this->topic_filters_;
+        this->updateTopicIdFilters();
+
+        // Bind the dish socket to the UDP endpoints.
+        for (const auto& publishers : this->subscribed_publishers_)
+        {
+            if (internal_helpers::zmq_helpers::isUdpEndpoint(publishers.second.endpoint))
+            {
+                this->createDishSocket();
+                this->dish_socket_->bind(publishers.second.endpoint);
+            }
         }
 
-        this->socket_pub_close_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pub);
-        this->socket_pub_close_->bind(close_endpoint);
-        this->socket_pub_close_->set(zmq::sockopt::linger, 0);
+        // Create the internal control sockets. Later changes will be sent to this worker through them.
+        auto ctrl_endpoint = "inproc://ctrl" + this->sub_info_.uuid.toRFC4122String();
+        this->recv_ctrl_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pair);
+        this->recv_ctrl_socket_->set(zmq::sockopt::linger, 0);
+        this->recv_ctrl_socket_->bind(ctrl_endpoint);
+        this->req_ctrl_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::pair);
+        this->req_ctrl_socket_->set(zmq::sockopt::linger, 0);
+        this->req_ctrl_socket_->set(zmq::sockopt::rcvtimeo, kSubscriberCtrlTimeoutMsec);
+        this->req_ctrl_socket_->connect(ctrl_endpoint);
 
-        this->socket_close_uuid_ = utils::UUIDGenerator::getInstance().generateUUIDv4();
+        // Store the worker thread id.
+        this->worker_th_id_ = std::this_thread::get_id();
+        ctrl_lock.unlock();
 
         // Update the working flag and calls to the callback.
         this->onSubscriberStart();
@@ -505,30 +1323,312 @@ void SubscriberBase::resetSocket()
     }
     catch (const zmq::error_t& error)
     {
-        // Delete the sockets and store the last error.
-        if (this->socket_)
+        // Delete the sockets.
+        this->deleteSockets();
+
+        // Update the working flag and calls to the callback.
+        this->onSubscriberError(error, this->kScope + " Error during socket creation.");
+        this->flag_working_ = false;
+        this->cv_worker_depl_.notify_all();
+        return;
+    }
+}
+
+bool SubscriberBase::isWorkerThread() const
+{
+    return std::this_thread::get_id() == this->worker_th_id_.load();
+}
+
+std::unique_lock<std::mutex> SubscriberBase::lockCtrlRequests()
+{
+    // The worker thread (for example, inside a process function) must never wait for a request of other thread,
+    // since that request is waiting for the worker.
+    if (this->isWorkerThread())
+        return std::unique_lock<std::mutex>();
+    return std::unique_lock<std::mutex>(this->ctrl_req_mtx_);
+}
+
+bool SubscriberBase::sendCtrlCommand(ControlCommand command, const std::string &arg)
+{
+    // If the subscriber is not working, the change will be applied when starting.
+    if (!this->flag_working_)
+        return true;
+
+    // If we are in the worker thread (for example, inside a process function), apply the change directly.
+    if (this->isWorkerThread())
+        return this->applyCtrlCommand(command, arg);
+
+    // Send the command to the worker and wait for the result.
+    try
+    {
+        // Each request has its own identifier, so a late reply of a timed out request is discarded.
+        const std::uint64_t req_id = ++this->ctrl_req_id_;
+        zmq::multipart_t ctrl_msg;
+        ctrl_msg.addtyp(command);
+        ctrl_msg.addtyp(req_id);
+        ctrl_msg.addstr(arg);
+        ctrl_msg.send(*this->req_ctrl_socket_);
+
+        // Wait for the reply (with timeout).
+        zmq::multipart_t ctrl_reply;
+        do
+        {
+            if (!ctrl_reply.recv(*this->req_ctrl_socket_))
+            {
+                this->onSubscriberError(zmq::error_t(EAGAIN),
+                                        this->kScope + " Timeout while waiting for a control command.");
+                return false;
+            }
+        } while (ctrl_reply.poptyp<std::uint64_t>() != req_id);
+        return ctrl_reply.poptyp<bool>();
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->onSubscriberError(error, this->kScope + " Error while sending a control command.");
+        return false;
+    }
+}
+
+bool SubscriberBase::processCtrlCommand()
+{
+    // Containers.
+    zmq::multipart_t ctrl_msg;
+    bool result = false;
+
+    // Receive the command. The messages come from our own control socket, so they are always well formed.
+    ctrl_msg.recv(*this->recv_ctrl_socket_);
+    ControlCommand command = ctrl_msg.poptyp<ControlCommand>();
+    std::uint64_t req_id = ctrl_msg.poptyp<std::uint64_t>();
+    std::string arg = ctrl_msg.popstr();
+
+    // Exit command case. No reply is necessary.
+    if (ControlCommand::EXIT == command)
+        return true;
+
+    // Apply the command and send the result.
+    result = this->applyCtrlCommand(command, arg);
+    zmq::multipart_t ctrl_reply;
+    ctrl_reply.addtyp(req_id);
+    ctrl_reply.addtyp(result);
+    ctrl_reply.send(*this->recv_ctrl_socket_);
+
+    // Continue working.
+    return false;
+}
+
+void SubscriberBase::trackSequences(const PublishedMessage &msg)
+{
+    // Containers.
+    std::uint64_t pub_lost = 0;
+    std::uint64_t topic_lost = 0;
+
+    // Update the statistics. The publisher sequence is only complete if we receive every topic.
+    {
+        std::lock_guard<std::mutex> lock(this->seq_mtx_);
+        PublisherSequenceStats& pub_stats = this->seq_stats_[msg.publisher_uuid];
+        if (this->worker_filters_.find(TopicType()) != this->worker_filters_.end())
+            pub_lost = pub_stats.publisher.track(msg.sequence);
+        if (msg.topic_sequence != 0)
+            topic_lost = pub_stats.topics[msg.topic].track(msg.topic_sequence);
+    }
+
+    // Call to the internal callbacks.
+    if (!this->isHookEnabled(SubscriberHook::MESSAGES_LOST))
+        return;
+    if (pub_lost > 0)
+        this->onMessagesLost(msg.publisher_uuid, TopicType(), pub_lost);
+    if (topic_lost > 0)
+        this->onMessagesLost(msg.publisher_uuid, msg.topic, topic_lost);
+}
+
+void SubscriberBase::processTopicIdsAnnouncement(const PublishedMessage &msg)
+{
+    // Get the announced names.
+    TopicId first_id;
+    std::vector<TopicType> names;
+    if (!parseTopicIdsAnnouncement(msg, first_id, names))
+        return;
+
+    // Store the unknown names. The identifiers are immutable, so the periodic announcements usually change nothing.
+    std::vector<TopicIdEntry>& entries = this->topic_ids_cache_[msg.publisher_uuid];
+    bool changed = false;
+    if (entries.size() < first_id + names.size())
+        entries.resize(first_id + names.size());
+    for (std::size_t i = 0; i < names.size(); i++)
+    {
+        TopicIdEntry& entry = entries[first_id + i];
+        if (entry.name.empty() && !names[i].empty())
         {
-            delete this->socket_;
-            this->socket_ = nullptr;
+            entry.topic_hash = std::hash<TopicType>{}(names[i]);
+            entry.name = std::move(names[i]);
+            changed = true;
         }
+    }
 
-        if (this->socket_pub_close_)
+    // Update the filters.
+    if (!changed)
+        return;
+    try
+    {
+        this->updateTopicIdFilters();
+    }
+    catch(zmq::error_t& error)
+    {
+        this->onSubscriberError(error, this->kScope + " Error while subscribing to the topic identifiers.");
+    }
+}
+
+void SubscriberBase::updateTopicIdFilters()
+{
+    // Check each known topic against the filters (ZMQ prefix semantic).
+    std::set<TopicId> allowed_ids;
+    for (auto& publisher_ids : this->topic_ids_cache_)
+    {
+        for (std::size_t id = 0; id < publisher_ids.second.size(); id++)
         {
-            delete this->socket_pub_close_;
-            this->socket_pub_close_ = nullptr;
+            TopicIdEntry& entry = publisher_ids.second[id];
+            entry.allowed = !entry.name.empty() &&
+                            std::any_of(this->worker_filters_.begin(), this->worker_filters_.end(),
+                                        [&entry](const TopicType& filter)
+                                        {return entry.name.compare(0, filter.size(), filter) == 0;});
+            if (entry.allowed)
+                allowed_ids.insert(static_cast<TopicId>(id));
         }
-        last_error = &error;
+    }
 
-        // Update the working flag and calls to the callback.
-        this->onSubscriberError(*last_error, this->kScope + " Error during socket creation.");
-        this->flag_working_ = false;
-        this->cv_worker_depl_.notify_all();
+    // Subscribe to the frames of the new allowed identifiers and unsubscribe from the rest.
+    for (TopicId id : allowed_ids)
+    {
+        if (this->subscribed_topic_ids_.find(id) == this->subscribed_topic_ids_.end())
+            this->socket_->set(zmq::sockopt::subscribe, makeTopicIdFrame(id));
+    }
+    for (TopicId id : this->subscribed_topic_ids_)
+    {
+        if (allowed_ids.find(id) == allowed_ids.end())
+            this->socket_->set(zmq::sockopt::unsubscribe, makeTopicIdFrame(id));
+    }
+    this->subscribed_topic_ids_ = std::move(allowed_ids);
+}
+
+bool SubscriberBase::applyCtrlCommand(ControlCommand command, const std::string &arg)
+{
+    try
+    {
+        switch (command)
+        {
+        case ControlCommand::SUBSCRIBE:
+            this->socket_->set(zmq::sockopt::subscribe, arg);
+            if (this->worker_filters_.find(arg) == this->worker_filters_.end())
+                this->updateDishGroup(arg, true);
+            this->worker_filters_.insert(arg);
+            this->updateTopicIdFilters();
+            break;
+        case ControlCommand::UNSUBSCRIBE:
+            this->socket_->set(zmq::sockopt::unsubscribe, arg);
+            if (this->worker_filters_.erase(arg) > 0)
+                this->updateDishGroup(arg, false);
+            this->updateTopicIdFilters();
+            break;
+        case ControlCommand::CONNECT:
+            if (internal_helpers::zmq_helpers::isUdpEndpoint(arg))
+            {
+                this->createDishSocket();
+                this->dish_socket_->bind(arg);
+
+                // Poll the new dish socket in the reactor loop.
+                if (this->reactor_ && this->ctrl_handler_id_ != 0)
+                    this->attachToReactor();
+            }
+            else
+                this->socket_->connect(arg);
+            break;
+        case ControlCommand::DISCONNECT:
+            if (internal_helpers::zmq_helpers::isUdpEndpoint(arg))
+            {
+                if (this->dish_socket_)
+                    this->dish_socket_->unbind(arg);
+            }
+            else
+                this->socket_->disconnect(arg);
+            break;
+        case ControlCommand::EXIT:
+            break;
+        }
+    }
+    catch (const zmq::error_t& error)
+    {
+        this->onSubscriberError(error, this->kScope + " Error while applying a control command.");
+        return false;
+    }
+
+    // All ok.
+    return true;
+}
+
+void SubscriberBase::createDishSocket()
+{
+#ifdef ZMQ_BUILD_DRAFT_API
+    // Check if the socket already exists.
+    if (this->dish_socket_)
         return;
+
+    // Create the ZMQ dish socket.
+    this->dish_socket_ = new zmq::socket_t(*this->getContext().get(), zmq::socket_type::dish);
+    this->dish_socket_->set(zmq::sockopt::linger, 0);
+    applySocketOptions(*this->dish_socket_, this->socket_options_);
+    if (this->rcv_hwm_ >= 0)
+        this->dish_socket_->set(zmq::sockopt::rcvhwm, this->rcv_hwm_);
+
+    // Join the groups of the topic filters and the topic identifiers announcements.
+    std::set<std::string> groups = {internal_helpers::zmq_helpers::topicToGroup(kReservedTopicTopicIds)};
+    for (const auto& filter : this->worker_filters_)
+    {
+        if (!filter.empty())
+            groups.insert(internal_helpers::zmq_helpers::topicToGroup(filter));
     }
+    for (const auto& group : groups)
+        this->dish_socket_->join(group.c_str());
+#else
+    // Without the draft API the UDP endpoints are rejected in the subscribe function.
+    throw zmq::error_t();
+#endif
+}
+
+void SubscriberBase::updateDishGroup(const TopicType &filter, bool join)
+{
+#ifdef ZMQ_BUILD_DRAFT_API
+    // Check the socket and the filter (the empty filter can't be used as group).
+    if (!this->dish_socket_ || filter.empty())
+        return;
+
+    // The groups are truncated, so several filters can share the same group.
+    std::string group = internal_helpers::zmq_helpers::topicToGroup(filter);
+    bool shared = (group == internal_helpers::zmq_helpers::topicToGroup(kReservedTopicTopicIds)) ||
+                  std::any_of(this->worker_filters_.begin(), this->worker_filters_.end(),
+                              [&filter, &group](const TopicType& other)
+                              {return other != filter && internal_helpers::zmq_helpers::topicToGroup(other) == group;});
+
+    // Join or leave the group.
+    if (shared)
+        return;
+    if (join)
+        this->dish_socket_->join(group.c_str());
+    else
+        this->dish_socket_->leave(group.c_str());
+#else
+    (void)filter;
+    (void)join;
+#endif
 }
 
 void SubscriberBase::onMsgReceived(const PublishedMessage&, OperationResult)
 {}
 
+void SubscriberBase::onMessagesLost(const utils::UUID&, const TopicType&, std::uint64_t)
+{}
+
+void SubscriberBase::onLatencyStats(const std::map<TopicType, TopicLatencyStats>&)
+{}
+
 }} // END NAMESPACES.
 // =====================================================================================================================
@@ -56,20 +56,36 @@ namespace utils{
 
 void CallbackHandler::removeCallback(CallbackId id)
 {
-    std::lock_guard<std::mutex> lock(this->mtx_);
-    this->callback_map_.erase(id);
+    this->updateCallbacks([id](CallbackMap& callbacks){callbacks.erase(id);});
 }
 
 bool CallbackHandler::hasCallback(CallbackId id) const
 {
-    std::lock_guard<std::mutex> lock(this->mtx_);
-    return this->callback_map_.find(id) != this->callback_map_.end();
+    const ReadGuard guard(*this);
+    return guard.callbacks().find(id) != guard.callbacks().end();
 }
 
 void CallbackHandler::clearCallbacks()
 {
-    std::lock_guard<std::mutex> lock(this->mtx_);
-    this->callback_map_.clear();
+    this->updateCallbacks([](CallbackMap& callbacks){callbacks.clear();});
+}
+
+void CallbackHandler::updateCallbacks(const std::function<void(CallbackMap&)>& modification)
+{
+    // Only one writer at a time, so no update is lost. The readers never take this mutex.
+    std::lock_guard<std::mutex> lock(this->update_mtx_);
+
+    // Copy the current table, modify the copy and publish it. The old table can still be used by the readers.
+    auto callbacks = std::make_unique<CallbackMap>(*this->table_);
+    modification(*callbacks);
+    this->retired_.push_back(std::move(this->table_));
+    this->table_ = std::move(callbacks);
+    this->callbacks_.store(this->table_.get(), std::memory_order_seq_cst);
+
+    // The readers announce themselves before loading the table, so if there is no reader after the publication, the
+    // next ones will load the new table and the old ones can be released.
+    if (this->readers_.load(std::memory_order_seq_cst) == 0)
+        this->retired_.clear();
 }
 
 // =====================================================================================================================
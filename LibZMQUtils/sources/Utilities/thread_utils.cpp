@@ -0,0 +1,224 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+
+/** ********************************************************************************************************************
+ * @file thread_utils.cpp
+ * @brief This file contains the implementation of the utilities for configuring the library worker threads.
+ * @author Degoras Project Team
+ * @copyright EUPL License
+***********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <algorithm>
+// =====================================================================================================================
+
+// PLATFORM INCLUDES
+// =====================================================================================================================
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <time.h>
+#endif
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include "LibZMQUtils/Utilities/thread_utils.h"
+// =====================================================================================================================
+
+// ZMQUTILS NAMESPACES
+// =====================================================================================================================
+namespace zmqutils{
+namespace utils{
+// =====================================================================================================================
+
+bool applyThreadConfig(const ThreadConfig &config, const std::string &suffix)
+{
+    bool result = true;
+
+#ifdef _WIN32
+
+    // Affinity (only the first 64 CPUs can be used with this API).
+    if (!config.cpus.empty())
+    {
+        DWORD_PTR mask = 0;
+        for (unsigned cpu : config.cpus)
+            if (cpu < sizeof(DWORD_PTR) * 8)
+                mask |= (static_cast<DWORD_PTR>(1) << cpu);
+        result = (mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0) && result;
+    }
+
+    // Priority. The real-time policies are mapped to the time critical priority.
+    if (config.sched_policy != ThreadSchedPolicy::DEFAULT)
+        result = (SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL) != 0) && result;
+
+    // Name. SetThreadDescription only exists since Windows 10 (1607), so it is loaded at runtime. In the older
+    // versions the name is skipped, as it is only informative.
+    if (!config.name.empty())
+    {
+        using SetThreadDescriptionFunc = HRESULT(WINAPI*)(HANDLE, PCWSTR);
+        HMODULE kernel = GetModuleHandleW(L"kernel32.dll");
+        FARPROC proc = kernel ? GetProcAddress(kernel, "SetThreadDescription") : nullptr;
+        if (proc)
+        {
+            const std::string name = config.name + suffix;
+            const int size = MultiByteToWideChar(CP_UTF8, 0, name.c_str(), -1, nullptr, 0);
+            std::wstring wide_name(static_cast<std::size_t>(std::max(size, 1)), L'\0');
+            const bool converted = size > 0 &&
+                                   MultiByteToWideChar(CP_UTF8, 0, name.c_str(), -1, wide_name.data(), size) > 0;
+            auto set_description = reinterpret_cast<SetThreadDescriptionFunc>(reinterpret_cast<void*>(proc));
+            result = converted && SUCCEEDED(set_description(GetCurrentThread(), wide_name.c_str())) && result;
+        }
+    }
+
+#else
+
+    // Name. Linux limits the names to 15 characters, so the suffix is always kept.
+    if (!config.name.empty())
+    {
+        const std::size_t max_size = 15;
+        std::string name = config.name.substr(0, max_size - std::min(suffix.size(), max_size)) + suffix;
+        name.resize(std::min(name.size(), max_size));
+#if defined(__APPLE__)
+        result = (pthread_setname_np(name.c_str()) == 0) && result;
+#else
+        result = (pthread_setname_np(pthread_self(), name.c_str()) == 0) && result;
+#endif
+    }
+
+    // Affinity.
+    if (!config.cpus.empty())
+    {
+#if defined(__linux__)
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        for (unsigned cpu : config.cpus)
+            if (cpu < CPU_SETSIZE)
+                CPU_SET(cpu, &cpu_set);
+        result = (pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set) == 0) && result;
+#else
+        result = false;
+#endif
+    }
+
+    // Scheduling policy and priority.
+    if (config.sched_policy != ThreadSchedPolicy::DEFAULT)
+    {
+        sched_param param{};
+        param.sched_priority = config.sched_priority;
+        int policy = (config.sched_policy == ThreadSchedPolicy::FIFO) ? SCHED_FIFO : SCHED_RR;
+        result = (pthread_setschedparam(pthread_self(), policy, &param) == 0) && result;
+    }
+
+#endif
+
+    return result;
+}
+
+bool lockProcessMemory()
+{
+#ifdef _WIN32
+    return false;
+#else
+    return mlockall(MCL_CURRENT | MCL_FUTURE) == 0;
+#endif
+}
+
+std::chrono::nanoseconds currentThreadCpuTime()
+{
+#ifdef _WIN32
+    return std::chrono::nanoseconds(0);
+#else
+    timespec ts{};
+    if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &ts) != 0)
+        return std::chrono::nanoseconds(0);
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#endif
+}
+
+ThreadCpuClock::Attachment::Attachment(ThreadCpuClock &clock) :
+    clock_(clock)
+{}
+
+ThreadCpuClock::Attachment::~Attachment()
+{
+    // Store the final CPU time while the thread is still alive.
+    std::lock_guard<std::mutex> lock(this->clock_.mtx_);
+    this->clock_.final_ = this->clock_.readClock();
+    this->clock_.attached_ = false;
+}
+
+ThreadCpuClock::ThreadCpuClock() :
+    attached_(false),
+    clock_id_(0),
+    final_(0)
+{}
+
+ThreadCpuClock::Attachment ThreadCpuClock::attach()
+{
+    std::lock_guard<std::mutex> lock(this->mtx_);
+#ifndef _WIN32
+    clockid_t clock_id;
+    this->attached_ = (pthread_getcpuclockid(pthread_self(), &clock_id) == 0);
+    this->clock_id_ = this->attached_ ? static_cast<std::int64_t>(clock_id) : 0;
+#endif
+    this->final_ = std::chrono::nanoseconds(0);
+    return Attachment(*this);
+}
+
+std::chrono::nanoseconds ThreadCpuClock::elapsed() const
+{
+    std::lock_guard<std::mutex> lock(this->mtx_);
+    return this->attached_ ? this->readClock() : this->final_;
+}
+
+std::chrono::nanoseconds ThreadCpuClock::readClock() const
+{
+#ifdef _WIN32
+    return std::chrono::nanoseconds(0);
+#else
+    timespec ts{};
+    if (!this->attached_ || clock_gettime(static_cast<clockid_t>(this->clock_id_), &ts) != 0)
+        return this->final_;
+    return std::chrono::seconds(ts.tv_sec) + std::chrono::nanoseconds(ts.tv_nsec);
+#endif
+}
+
+}} // END NAMESPACES.
+// =====================================================================================================================
@@ -42,8 +42,9 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
-#include <cmath>
+#include <ctime>
 #include <iomanip>
+#include <limits>
 #include <sstream>
 // =====================================================================================================================
 
@@ -64,6 +65,142 @@ using std::chrono::duration_cast;
 using std::chrono::time_point_cast;
 // =====================================================================================================================
 
+// Anonymous namespace for the ISO 8601 helpers.
+namespace{
+
+// Two digits of each number from 0 to 99.
+constexpr char kDigitPairs[] =
+    "0001020304050607080910111213141516171819"
+    "2021222324252627282930313233343536373839"
+    "4041424344454647484950515253545556575859"
+    "6061626364656667686970717273747576777879"
+    "8081828384858687888990919293949596979899";
+
+// Cached date and time of the last formatted second.
+struct Iso8601Cache
+{
+    long long secs = std::numeric_limits<long long>::min();  ///< Cached second (since epoch).
+    char prefix[19];                                          ///< Date and time (YYYY-MM-DDTHH:MM:SS).
+    char zone[6];                                             ///< Zone designator (Z or +HH:MM).
+    std::size_t zone_size = 0;                                ///< Size of the zone designator.
+};
+
+inline char* writeTwoDigits(char* out, unsigned value)
+{
+    std::memcpy(out, &kDigitPairs[value * 2], 2);
+    return out + 2;
+}
+
+inline bool readDigits(const char*& it, const char* end, int count, int& value)
+{
+    if (end - it < count)
+        return false;
+    value = 0;
+    for (int i = 0; i < count; i++, it++)
+    {
+        if (*it < '0' || *it > '9')
+            return false;
+        value = value * 10 + (*it - '0');
+    }
+    return true;
+}
+
+// Civil date from the days since 1970-01-01 (inverse of daysFromCivil).
+void civilFromDays(long long days, int& y, unsigned& m, unsigned& d)
+{
+    days += 719468;
+    const long long era = (days >= 0 ? days : days - 146096) / 146097;
+    const unsigned doe = static_cast<unsigned>(days - era * 146097);             // [0, 146096]
+    const unsigned yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;       // [0, 399]
+    const unsigned doy = doe - (365*yoe + yoe/4 - yoe/100);                      // [0, 365]
+    const unsigned mp = (5*doy + 2)/153;                                         // [0, 11]
+    d = doy - (153*mp + 2)/5 + 1;                                                // [1, 31]
+    m = mp < 10 ? mp + 3 : mp - 9;                                               // [1, 12]
+    y = static_cast<int>(yoe + era * 400) + (m <= 2);
+}
+
+// Fills the cache with the date, time and zone of a second.
+bool updateIso8601Cache(Iso8601Cache& cache, long long secs, bool utc)
+{
+    int y;
+    unsigned mon, d, h, min, sec;
+    long long offset_secs = 0;
+
+    if (utc)
+    {
+        long long days = secs / 86400;
+        long long sod = secs % 86400;
+        if (sod < 0)
+        {
+            sod += 86400;
+            days--;
+        }
+        civilFromDays(days, y, mon, d);
+        h = static_cast<unsigned>(sod / 3600);
+        min = static_cast<unsigned>(sod % 3600 / 60);
+        sec = static_cast<unsigned>(sod % 60);
+    }
+    else
+    {
+        const std::time_t t = static_cast<std::time_t>(secs);
+        std::tm tm_local;
+#if defined(__MINGW32__) || defined(_MSC_VER)
+        if (localtime_s(&tm_local, &t) != 0)
+            return false;
+#else
+        if (!localtime_r(&t, &tm_local))
+            return false;
+#endif
+        y = tm_local.tm_year + 1900;
+        mon = static_cast<unsigned>(tm_local.tm_mon + 1);
+        d = static_cast<unsigned>(tm_local.tm_mday);
+        h = static_cast<unsigned>(tm_local.tm_hour);
+        min = static_cast<unsigned>(tm_local.tm_min);
+        sec = static_cast<unsigned>(tm_local.tm_sec);
+        offset_secs = daysFromCivil(y, mon, d) * 86400 + h * 3600 + min * 60 + sec - secs;
+    }
+
+    // Check the year range.
+    if (y < 0 || y > 9999)
+        return false;
+
+    // Date and time.
+    char* out = cache.prefix;
+    out = writeTwoDigits(out, static_cast<unsigned>(y / 100));
+    out = writeTwoDigits(out, static_cast<unsigned>(y % 100));
+    *out++ = '-';
+    out = writeTwoDigits(out, mon);
+    *out++ = '-';
+    out = writeTwoDigits(out, d);
+    *out++ = 'T';
+    out = writeTwoDigits(out, h);
+    *out++ = ':';
+    out = writeTwoDigits(out, min);
+    *out++ = ':';
+    writeTwoDigits(out, sec);
+
+    // Zone designator.
+    if (utc)
+    {
+        cache.zone[0] = 'Z';
+        cache.zone_size = 1;
+    }
+    else
+    {
+        const long long offset_min = (offset_secs < 0 ? -offset_secs : offset_secs) / 60;
+        cache.zone[0] = offset_secs < 0 ? '-' : '+';
+        writeTwoDigits(cache.zone + 1, static_cast<unsigned>(offset_min / 60 % 100));
+        cache.zone[3] = ':';
+        writeTwoDigits(cache.zone + 4, static_cast<unsigned>(offset_min % 60));
+        cache.zone_size = 6;
+    }
+
+    cache.secs = secs;
+    return true;
+}
+
+} // END ANONYMOUS NAMESPACE
+
 std::string timePointToString(const TimePointStd &tp, const std::string &format, bool add_ms, bool add_ns, bool utc)
 {
     // Stream to hold the formatted string and the return container.
@@ -95,44 +232,9 @@ std::string timePointToString(const TimePointStd &tp, const std::string &format,
 
 std::string timePointToIso8601(const TimePointStd &tp, bool add_ms, bool add_ns, bool utc)
 {
-    // Format the ISO 8601 datetime without UTC offset.
-    std::string iso8601_datetime = timePointToString(tp, "%Y-%m-%dT%H:%M:%S", add_ms, add_ns, true);
-
-    if (!utc)
-    {
-        // Get the offsets.
-        std::ostringstream ss;
-        TimePointStd::duration dur = tp.time_since_epoch();
-        const time_t secs = duration_cast<std::chrono::seconds>(dur).count();
-        const std::tm *tm_local = std::localtime(&secs);
-        if(!tm_local)
-            return std::string();
-        const int hh_local = tm_local->tm_hour;
-        const int mm_local = tm_local->tm_min;
-        const std::tm *tm_utc = std::gmtime(&secs);
-        if(!tm_utc)
-            return std::string();
-        int offset_hours = hh_local - tm_utc->tm_hour;
-        int offset_minutes = mm_local - tm_utc->tm_min;
-
-        // Format the UTC offset as [+/-]HH:MM.
-        std::ostringstream offset_ss;
-        offset_ss << std::setfill('0');
-        offset_ss << (offset_hours >= 0 ? '+' : '-');
-        offset_ss << std::setw(2) << std::abs(offset_hours);
-        offset_ss << ':';
-        offset_ss << std::setw(2) << std::abs(offset_minutes);
-
-        // Append the UTC offset to the ISO 8601 datetime.
-        iso8601_datetime += offset_ss.str();
-    }
-    else
-    {
-        // Add 'Z' to indicate UTC.
-        iso8601_datetime += "Z";
-    }
-
-    return iso8601_datetime;
+    char buffer[kIso8601BufferSize];
+    const std::size_t size = formatIso8601(tp, buffer, sizeof(buffer), add_ms, add_ns, utc);
+    return std::string(buffer, size);
 }
 
 std::string currentISO8601Date(bool add_ms, bool add_ns, bool utc)
@@ -143,51 +245,13 @@ std::string currentISO8601Date(bool add_ms, bool add_ns, bool utc)
 
 HRTimePointStd iso8601DatetimeToTimePoint(const std::string &datetime)
 {
-    // TODO: use LibDegorasBase
-    int y, m, d, h, M, s;
-    std::smatch match;
-    std::regex iso8601_regex_extended(R"(^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.(\d+))?(Z)?$)");
-    std::regex iso8601_regex_basic(R"(^(\d{4})(\d{2})(\d{2})T(\d{2})(\d{2})(\d{2})(?:\.(\d+))?(Z)?$)");
+    HRTimePointStd t;
+    bool has_zone;
 
-    if (!std::regex_search(datetime, match, iso8601_regex_extended) &&
-        !std::regex_search(datetime, match, iso8601_regex_basic))
-    {
+    if (!parseIso8601Datetime(datetime, t, &has_zone))
         throw std::invalid_argument("[LibZMQUtils,Timing,iso8601DatetimeToTimePoint] Invalid argument: " + datetime);
-    }
-
-    y = std::stoi(match[1].str());
-    m = std::stoi(match[2].str());
-    d = std::stoi(match[3].str());
-    h = std::stoi(match[4].str());
-    M = std::stoi(match[5].str());
-    s = std::stoi(match[6].str());
-    std::string fractional_seconds_str = match[7].str();
-    bool is_utc = match[8].str() == "Z";
-
-    auto days_since_epoch = daysFromCivil(y, static_cast<unsigned>(m), static_cast<unsigned>(d));
-    HRTimePointStd t = HRClock::time_point(std::chrono::duration<int, std::ratio<86400>>(days_since_epoch));
-
-    t += std::chrono::hours(h);
-    t += std::chrono::minutes(M);
-    t += std::chrono::seconds(s);
-
-    if (!fractional_seconds_str.empty()) {
-        long long fractional_seconds = std::stoll(fractional_seconds_str);
-        size_t length = fractional_seconds_str.length();
-
-        if (length == 1) // Normalize to milliseconds
-            t += std::chrono::milliseconds(fractional_seconds * 100);
-        else if (length == 2) // Normalize to milliseconds
-            t += std::chrono::milliseconds(fractional_seconds * 10);
-        else if (length == 3) // Already in milliseconds
-            t += std::chrono::milliseconds(fractional_seconds);
-        else if (length <= 6) // Normalize to microseconds
-            t += std::chrono::microseconds(fractional_seconds * static_cast<long long>(std::pow(10, 6 - length)));
-        else // Normalize to nanoseconds
-            t += std::chrono::nanoseconds(fractional_seconds * static_cast<long long>(std::pow(10, 9 - length)));
-    }
 
-    if (!is_utc) {
+    if (!has_zone) {
         // Adjust for local timezone if 'Z' is not present
         std::time_t now = std::time(nullptr);
         std::tm* now_tm = std::localtime(&now);
@@ -201,17 +265,138 @@ HRTimePointStd iso8601DatetimeToTimePoint(const std::string &datetime)
 
 bool isValidIso8601Datetime(const std::string &datetime)
 {
-    std::smatch match;
+    HRTimePointStd tp;
+    return parseIso8601Datetime(datetime, tp);
+}
+
+std::size_t formatIso8601(const TimePointStd &tp, char *buffer, std::size_t size, bool add_ms, bool add_ns, bool utc)
+{
+    thread_local Iso8601Cache caches[2];
+
+    // Get the second (rounded down) and the fraction.
+    const long long ns_since_epoch = duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count();
+    long long secs = ns_since_epoch / 1000000000LL;
+    long long frac = ns_since_epoch % 1000000000LL;
+    if (frac < 0)
+    {
+        frac += 1000000000LL;
+        secs--;
+    }
+
+    // Update the cache if the second changes.
+    Iso8601Cache& cache = caches[utc ? 0 : 1];
+    if (cache.secs != secs && !updateIso8601Cache(cache, secs, utc))
+        return 0;
+
+    // Check the buffer size.
+    const std::size_t frac_size = add_ns ? 10 : (add_ms ? 4 : 0);
+    const std::size_t total = sizeof(cache.prefix) + frac_size + cache.zone_size;
+    if (size <= total)
+        return 0;
+
+    // Write the datetime.
+    char* out = buffer;
+    std::memcpy(out, cache.prefix, sizeof(cache.prefix));
+    out += sizeof(cache.prefix);
+    if (add_ns)
+    {
+        const unsigned ns = static_cast<unsigned>(frac);
+        *out++ = '.';
+        *out++ = static_cast<char>('0' + ns / 100000000);
+        out = writeTwoDigits(out, ns / 1000000 % 100);
+        out = writeTwoDigits(out, ns / 10000 % 100);
+        out = writeTwoDigits(out, ns / 100 % 100);
+        out = writeTwoDigits(out, ns % 100);
+    }
+    else if (add_ms)
+    {
+        const unsigned ms = static_cast<unsigned>(frac / 1000000);
+        *out++ = '.';
+        *out++ = static_cast<char>('0' + ms / 100);
+        out = writeTwoDigits(out, ms % 100);
+    }
+    std::memcpy(out, cache.zone, cache.zone_size);
+    out += cache.zone_size;
+    *out = '\0';
+
+    return total;
+}
+
+bool parseIso8601Datetime(std::string_view datetime, HRTimePointStd &tp, bool *has_zone)
+{
+    const char* it = datetime.data();
+    const char* const end = it + datetime.size();
+    int y, m, d, h, M, s;
+
+    // Date (extended format if the year is followed by '-').
+    if (!readDigits(it, end, 4, y))
+        return false;
+    const bool extended = it != end && *it == '-';
+    if ((extended && *it++ != '-') || !readDigits(it, end, 2, m) ||
+        (extended && (it == end || *it++ != '-')) || !readDigits(it, end, 2, d))
+        return false;
+
+    // Time.
+    if (it == end || *it++ != 'T' || !readDigits(it, end, 2, h) ||
+        (extended && (it == end || *it++ != ':')) || !readDigits(it, end, 2, M) ||
+        (extended && (it == end || *it++ != ':')) || !readDigits(it, end, 2, s))
+        return false;
+
+    // Check the ranges (the second 60 is allowed for leap seconds).
+    if (m < 1 || m > 12 || d < 1 || d > 31 || h > 23 || M > 59 || s > 60)
+        return false;
+
+    // Fraction of second (only the first 9 digits are used).
+    long long ns = 0;
+    if (it != end && *it == '.')
+    {
+        it++;
+        int digits = 0;
+        for (; it != end && *it >= '0' && *it <= '9'; it++, digits++)
+        {
+            if (digits < 9)
+                ns = ns * 10 + (*it - '0');
+        }
+        if (digits == 0)
+            return false;
+        for (; digits < 9; digits++)
+            ns *= 10;
+    }
+
+    // Zone designator.
+    long long offset_secs = 0;
+    bool zone = false;
+    if (it != end && *it == 'Z')
+    {
+        it++;
+        zone = true;
+    }
+    else if (it != end && (*it == '+' || *it == '-'))
+    {
+        const bool negative = *it++ == '-';
+        int off_h, off_m;
+        if (!readDigits(it, end, 2, off_h))
+            return false;
+        if (it != end && *it == ':')
+            it++;
+        if (!readDigits(it, end, 2, off_m) || off_h > 23 || off_m > 59)
+            return false;
+        offset_secs = (negative ? -1 : 1) * (off_h * 3600LL + off_m * 60LL);
+        zone = true;
+    }
 
-    // Regex.
-    const std::regex iso8601_regex_extended(
-        R"(^(\d{4})-(\d{2})-(\d{2})T(\d{2}):(\d{2}):(\d{2})(?:\.(\d+))?(?:(Z)|((\+|\-)(\d{2}):(\d{2})))?$)");
-    const std::regex iso8601_regex_basic(
-        R"(^(\d{4})(\d{2})(\d{2})T(\d{2})(\d{2})(\d{2})(?:\.(\d+))?(?:(Z)|((\+|\-)(\d{2}):(\d{2})))?$)");
+    // Check the end.
+    if (it != end)
+        return false;
 
-    // Check if datetime matches one of ISO datetime patterns.
-    return std::regex_search(datetime, match, iso8601_regex_extended) ||
-           std::regex_search(datetime, match, iso8601_regex_basic);
+    // Store the results.
+    const long long secs = daysFromCivil(y, static_cast<unsigned>(m), static_cast<unsigned>(d)) * 86400LL +
+                           h * 3600LL + M * 60LL + s - offset_secs;
+    tp = HRTimePointStd(duration_cast<HRTimePointStd::duration>(std::chrono::seconds(secs) +
+                                                                std::chrono::nanoseconds(ns)));
+    if (has_zone)
+        *has_zone = zone;
+    return true;
 }
 
 long long daysFromCivil(int y, unsigned int m, unsigned int d)
@@ -43,14 +43,10 @@
 // C++ INCLUDES
 // =====================================================================================================================
 #include <cstddef>
-#include <iostream>
-#include <mutex>
+#include <cstdint>
 #include <random>
-#include <sstream>
-#include <iomanip>
+#include <ostream>
 #include <array>
-#include <memory>
-#include <set>
 #include <chrono>
 #include <thread>
 // =====================================================================================================================
@@ -66,25 +62,86 @@ namespace zmqutils{
 namespace utils{
 // =====================================================================================================================
 
-UUIDGenerator::UUIDGenerator() :
-    rd_(std::random_device()),
-    gen_(std::mt19937_64{std::random_device{}()})
+// Anonymous namespace for the thread local generation state.
+namespace{
+
+// Random engine and Version 7 state of each thread.
+struct UUIDThreadState
+{
+    UUIDThreadState()
+    {
+        // The time and the thread identifier are always mixed with the random device, so the threads never share the
+        // same sequence even if the random device is deterministic.
+        std::random_device rd;
+        auto now = static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+        auto tid = static_cast<std::uint64_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        std::seed_seq seq{rd(), rd(), rd(), rd(),
+                          static_cast<std::uint32_t>(now), static_cast<std::uint32_t>(now >> 32),
+                          static_cast<std::uint32_t>(tid), static_cast<std::uint32_t>(tid >> 32)};
+        this->gen.seed(seq);
+    }
+
+    std::mt19937_64 gen;           ///< Random engine of the thread.
+    std::uint64_t last_ms = 0;     ///< Last Version 7 time stamp.
+    std::uint16_t counter = 0;     ///< Version 7 counter within the last time stamp.
+};
+
+UUIDThreadState& threadState()
 {
-    // Safe mutex lock.
-    std::unique_lock<std::mutex> lock(this->mtx_);
+    thread_local UUIDThreadState state;
+    return state;
+}
 
-    // Check the entropy.
-    if(this->rd_.entropy() == 0.0)
+// Lowercase hexadecimal pairs of each byte value.
+constexpr char kHexPairs[] =
+    "000102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f"
+    "202122232425262728292a2b2c2d2e2f303132333435363738393a3b3c3d3e3f"
+    "404142434445464748494a4b4c4d4e4f505152535455565758595a5b5c5d5e5f"
+    "606162636465666768696a6b6c6d6e6f707172737475767778797a7b7c7d7e7f"
+    "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f"
+    "a0a1a2a3a4a5a6a7a8a9aaabacadaeafb0b1b2b3b4b5b6b7b8b9babbbcbdbebf"
+    "c0c1c2c3c4c5c6c7c8c9cacbcccdcecfd0d1d2d3d4d5d6d7d8d9dadbdcdddedf"
+    "e0e1e2e3e4e5e6e7e8e9eaebecedeeeff0f1f2f3f4f5f6f7f8f9fafbfcfdfeff";
+
+// Value of each hexadecimal character (0xFF for the rest of characters).
+constexpr std::uint8_t kHexValues[256] =
+{
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+// Positions of the hyphens and of the first character of each byte in the RFC 4122 representation.
+constexpr std::size_t kHyphenPositions[4] = {8, 13, 18, 23};
+constexpr std::size_t kBytePositions[UUID::kUUIDSize] = {0, 2, 4, 6, 9, 11, 14, 16, 19, 21, 24, 26, 28, 30, 32, 34};
+
+// Helper for building an UUID from two big-endian 64-bit words.
+UUID uuidFromWords(std::uint64_t high, std::uint64_t low)
+{
+    std::array<std::byte, UUID::kUUIDSize> bytes;
+    for (std::size_t i = 0; i < 8; i++)
     {
-        auto now = std::chrono::high_resolution_clock::now();
-        auto now_int = std::chrono::time_point_cast<std::chrono::nanoseconds>(now).time_since_epoch().count();
-        std::uint_fast64_t seed = std::hash<decltype(now_int)>{}(now_int);
-        this->gen_ = std::mt19937_64(seed);
+        bytes[i] = static_cast<std::byte>(high >> (56 - 8 * i));
+        bytes[8 + i] = static_cast<std::byte>(low >> (56 - 8 * i));
     }
-    else
-        this->gen_ = std::mt19937_64(this->rd_());
+    return UUID(bytes);
 }
 
+} // END ANONYMOUS NAMESPACE
+
 UUIDGenerator &UUIDGenerator::getInstance()
 {
     // Guaranteed to be destroyed, instantiated on first use.
@@ -94,37 +151,51 @@ UUIDGenerator &UUIDGenerator::getInstance()
 
 UUID UUIDGenerator::generateUUIDv4()
 {
-    // Auxiliar containers.
-    std::array<std::byte, 16> bytes;
-    std::uniform_int_distribution<> distrib(0, 255);
-    UUID uuid;
+    UUIDThreadState& state = threadState();
 
-    // Generate the uuid.
-    do
-    {
-        // Random generation.
-        for(auto& byte : bytes)
-            byte = static_cast<std::byte>(distrib(this->gen_));
+    // Random generation.
+    std::uint64_t high = state.gen();
+    std::uint64_t low = state.gen();
 
-        // Set the version to 4 (random)
-        bytes[6] = static_cast<std::byte>((static_cast<std::uint8_t>(bytes[6]) & 0x0F) | 0x40);
+    // Set the version to 4 (random).
+    high = (high & 0xFFFFFFFFFFFF0FFFULL) | 0x0000000000004000ULL;
 
-        // Set the variant to 1 (RFC4122)
-        bytes[8] = static_cast<std::byte>((static_cast<std::uint8_t>(bytes[8]) & 0x3F) | 0x80);
+    // Set the variant to 1 (RFC4122).
+    low = (low & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
 
-        // Generate the UUID.
-        uuid = UUID(bytes);
+    // Return the generated uuid.
+    return uuidFromWords(high, low);
+}
 
-    } while(generated_uuids_.find(uuid) != generated_uuids_.end());
+UUID UUIDGenerator::generateUUIDv7()
+{
+    UUIDThreadState& state = threadState();
 
-    // Safe mutex lock.
-    std::unique_lock<std::mutex> lock(this->mtx_);
+    // Unix time stamp in milliseconds.
+    auto now_ms = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count());
 
-    // Insert the generated uuid.
-    generated_uuids_.insert(uuid);
+    // New millisecond: restart the counter at a random value, leaving room for increments. In the same millisecond
+    // (or if the clock goes backwards), increment the counter, advancing the time stamp if it overflows.
+    if (now_ms > state.last_ms)
+    {
+        state.last_ms = now_ms;
+        state.counter = static_cast<std::uint16_t>(state.gen() & 0x7FF);
+    }
+    else if (++state.counter > 0xFFF)
+    {
+        state.last_ms++;
+        state.counter = static_cast<std::uint16_t>(state.gen() & 0x7FF);
+    }
+
+    // Time stamp (48 bits), version 7 and counter (12 bits).
+    std::uint64_t high = ((state.last_ms & 0xFFFFFFFFFFFFULL) << 16) | 0x7000ULL | state.counter;
+
+    // Variant 1 (RFC4122) and random bits.
+    std::uint64_t low = (state.gen() & 0x3FFFFFFFFFFFFFFFULL) | 0x8000000000000000ULL;
 
     // Return the generated uuid.
-    return uuid;
+    return uuidFromWords(high, low);
 }
 
 UUID::UUID()
@@ -138,34 +209,54 @@ UUID::UUID(const std::array<std::byte, 16> &bytes):
 
 std::string UUID::toRFC4122String() const
 {
-    std::stringstream ss;
-    ss << std::hex << std::setfill('0');
-
-    // time-low
-    for (size_t i = 0; i < 4; i++)
-        ss << std::setw(2) << static_cast<int>(this->bytes_[i]);
-    ss << '-';
-
-    // time-mid
-    for (size_t i = 4; i < 6; i++)
-        ss << std::setw(2) << static_cast<int>(this->bytes_[i]);
-    ss << '-';
+    std::string str(kRFC4122StringSize, '-');
+    this->toRFC4122Chars(str.data());
+    return str;
+}
 
-    // time-high-and-version
-    for (size_t i = 6; i < 8; i++)
-        ss << std::setw(2) << static_cast<int>(this->bytes_[i]);
-    ss << '-';
+void UUID::toRFC4122Chars(char *buffer) const
+{
+    for (std::size_t i = 0; i < kUUIDSize; i++)
+    {
+        const char* pair = &kHexPairs[static_cast<std::size_t>(this->bytes_[i]) * 2];
+        buffer[kBytePositions[i]] = pair[0];
+        buffer[kBytePositions[i] + 1] = pair[1];
+    }
+    for (std::size_t pos : kHyphenPositions)
+        buffer[pos] = '-';
+}
 
-    // clock-seq-and-reserved and clock-seq-low
-    for (size_t i = 8; i < 10; i++)
-        ss << std::setw(2) << static_cast<int>(this->bytes_[i]);
-    ss << '-';
+bool UUID::fromRFC4122String(std::string_view str, UUID &uuid)
+{
+    if (str.size() != kRFC4122StringSize)
+        return false;
+
+    // Check the hyphens.
+    bool valid = true;
+    for (std::size_t pos : kHyphenPositions)
+        valid &= str[pos] == '-';
+
+    // Decode all the bytes (without early exits, so the loop has no branches), accumulating the invalid characters.
+    std::array<std::byte, kUUIDSize> bytes;
+    std::uint8_t invalid = 0;
+    for (std::size_t i = 0; i < kUUIDSize; i++)
+    {
+        const std::uint8_t high = kHexValues[static_cast<unsigned char>(str[kBytePositions[i]])];
+        const std::uint8_t low = kHexValues[static_cast<unsigned char>(str[kBytePositions[i] + 1])];
+        invalid |= (high | low) & 0xF0;
+        bytes[i] = static_cast<std::byte>((high << 4) | (low & 0x0F));
+    }
 
-    // node
-    for (size_t i = 10; i < 16; i++)
-        ss << std::setw(2) << static_cast<int>(this->bytes_[i]);
+    if (!valid || invalid)
+        return false;
+    uuid = UUID(bytes);
+    return true;
+}
 
-    return ss.str();
+bool UUID::isValidRFC4122String(std::string_view str)
+{
+    UUID uuid;
+    return UUID::fromRFC4122String(str, uuid);
 }
 
 const std::array<std::byte, 16> &UUID::getBytes() const
@@ -208,6 +299,13 @@ bool operator!=(const UUID &a, const UUID &b)
     return a.getBytes() != b.getBytes();
 }
 
+std::ostream &operator<<(std::ostream &os, const UUID &uuid)
+{
+    char buffer[UUID::kRFC4122StringSize];
+    uuid.toRFC4122Chars(buffer);
+    return os.write(buffer, UUID::kRFC4122StringSize);
+}
+
 
 }} // END NAMESPACES.
 // =====================================================================================================================
@@ -0,0 +1,502 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/CommandServerClient>
+#include <LibZMQUtils/Modules/Testing>
+// =====================================================================================================================
+
+// Basic tests.
+M_DECLARE_UNIT_TEST(CommandServerClient, ProcessFunctionsTable)
+M_DECLARE_UNIT_TEST(CommandServerClient, CommandServerHooks)
+M_DECLARE_UNIT_TEST(CommandServerClient, SocketOptionsDeadServer)
+M_DECLARE_UNIT_TEST(CommandServerClient, CommandSignatureCall)
+M_DECLARE_UNIT_TEST(CommandServerClient, ReactorAutoAlive)
+
+
+// Test helpers.
+
+// Custom commands used in the tests.
+enum class TestCommand : zmqutils::reqrep::CommandType
+{
+    REQ_FUNCTION = 51,                                                   ///< Process function.
+    REQ_GAP      = 52,                                                   ///< Gap in the table (not registered).
+    REQ_CALLBACK = 53,                                                   ///< Callback with return value.
+    REQ_INPUTS   = 54,                                                   ///< Signature with only inputs.
+    REQ_OUTPUTS  = 55,                                                   ///< Signature with return and outputs.
+    REQ_VOID     = 56,                                                   ///< Signature without data.
+    REQ_UNKNOWN  = 60,                                                   ///< Beyond the table (not registered).
+    REQ_FAR      = zmqutils::reqrep::kMaxProcessFunctionsTableSize + 10  ///< Outside the table (overflow map).
+};
+
+// Client with empty callbacks.
+class TestClient : public zmqutils::reqrep::CommandClientBase
+{
+public:
+
+    using zmqutils::reqrep::CommandClientBase::CommandClientBase;
+    using zmqutils::reqrep::CommandClientBase::executeCommand;
+    using zmqutils::reqrep::CommandClientBase::call;
+
+private:
+
+    inline void onClientStart() override {}
+    inline void onClientStop() override {}
+    inline void onWaitingReply() override {}
+    inline void onDeadServer(const zmqutils::reqrep::CommandServerInfo&) override {}
+    inline void onConnected(const zmqutils::reqrep::CommandServerInfo&) override {}
+    inline void onDisconnected(const zmqutils::reqrep::CommandServerInfo&) override {}
+    inline void onBadOperation(const zmqutils::reqrep::CommandReply&) override {}
+    inline void onReplyReceived(const zmqutils::reqrep::CommandReply&) override {}
+    inline void onSendingCommand(const zmqutils::reqrep::CommandRequest&) override {}
+    inline void onClientError(const zmq::error_t&, const std::string&) override {}
+};
+
+
+// Implementations.
+
+M_DEFINE_UNIT_TEST(CommandServerClient, ProcessFunctionsTable)
+{
+    using zmqutils::reqrep::OperationResult;
+
+    class TestServer : public zmqutils::reqrep::CommandServer<TestServer,
+                                                              zmqutils::reqrep::CommandServerPolicies<false>,
+                                                              zmqutils::reqrep::ClbkCommandServerBase>
+    {
+    public:
+
+        using CommandServer::CommandServer;
+        using CommandServer::registerReqProcFunc;
+
+        inline int getValue() { return 42; }
+    };
+
+    // Auxiliar lambda for the process functions.
+    auto proc_func_ok = [](const zmqutils::reqrep::CommandRequest&, zmqutils::reqrep::CommandReply& reply)
+    {
+        reply.result = OperationResult::COMMAND_OK;
+    };
+
+    // Instanciate the server and register the functions.
+    TestServer server(9999, "*", "TEST SERVER", "1.1.1", "This is the TEST server");
+    M_EXPECTED_EQ(server.registerReqProcFunc(TestCommand::REQ_FUNCTION, proc_func_ok), true)
+    M_EXPECTED_EQ(server.registerReqProcFunc(TestCommand::REQ_FAR, proc_func_ok), true)
+    M_EXPECTED_EQ(server.registerCbAndReqProcFunc<std::function<int()>>(
+                      TestCommand::REQ_CALLBACK, &server, &TestServer::getValue), true)
+
+    // Start the server.
+    if(!server.startServer())
+    {
+        std::cout << "Server start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // The dispatch table is frozen while the server is working.
+    M_EXPECTED_EQ(server.registerReqProcFunc(TestCommand::REQ_GAP, proc_func_ok), false)
+    M_EXPECTED_EQ(server.removeCallback(static_cast<zmqutils::reqrep::ServerCommand>(TestCommand::REQ_CALLBACK)),
+                  false)
+
+    // Start and connect the client.
+    TestClient client("tcp://127.0.0.1:9999", "", "TEST CLIENT", "1.1.1", "This is the TEST client");
+    if(!client.startClient() || client.doConnect() != OperationResult::COMMAND_OK)
+    {
+        std::cout << "Client connection failed!!" << std::endl;
+        server.stopServer();
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Auxiliar lambda for sending the commands.
+    auto send = [&client](TestCommand command)
+    {
+        zmqutils::reqrep::CommandReply reply;
+        return client.sendCommand(command, reply);
+    };
+
+    // Check the dispatch.
+    int value = 0;
+    M_EXPECTED_EQ(send(TestCommand::REQ_FUNCTION), OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(send(TestCommand::REQ_GAP), OperationResult::NOT_IMPLEMENTED)
+    M_EXPECTED_EQ(send(TestCommand::REQ_UNKNOWN), OperationResult::NOT_IMPLEMENTED)
+    M_EXPECTED_EQ(send(TestCommand::REQ_FAR), OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(client.executeCommand(TestCommand::REQ_CALLBACK, value), OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(value, 42)
+
+    // Remove the callback with the server stopped.
+    client.stopClient();
+    server.stopServer();
+    M_EXPECTED_EQ(server.removeCallback(static_cast<zmqutils::reqrep::ServerCommand>(TestCommand::REQ_CALLBACK)),
+                  true)
+    M_EXPECTED_EQ(server.hasCallback(static_cast<zmqutils::reqrep::ServerCommand>(TestCommand::REQ_CALLBACK)),
+                  false)
+
+    // Restart all.
+    if(!server.startServer() || !client.startClient() || client.doConnect() != OperationResult::COMMAND_OK)
+    {
+        std::cout << "Restart failed!!" << std::endl;
+        client.stopClient();
+        server.stopServer();
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check the removed callback and the rest of the table.
+    M_EXPECTED_EQ(send(TestCommand::REQ_CALLBACK), OperationResult::EMPTY_EXT_CALLBACK)
+    M_EXPECTED_EQ(send(TestCommand::REQ_FUNCTION), OperationResult::COMMAND_OK)
+
+    // Stop all.
+    client.stopClient();
+    server.stopServer();
+}
+
+M_DEFINE_UNIT_TEST(CommandServerClient, CommandServerHooks)
+{
+    using zmqutils::reqrep::OperationResult;
+
+    // Server that only defines two of the per request callbacks (private, without declaring the adapter as friend).
+    class TestServer : public zmqutils::reqrep::CommandServer<TestServer,
+                                                              zmqutils::reqrep::CommandServerPolicies<false>>
+    {
+    public:
+
+        using CommandServer::CommandServer;
+        using CommandServer::registerReqProcFunc;
+        using CommandServer::getEnabledHooks;
+        using CommandServer::ServerHook;
+
+        std::atomic_uint commands_received_ = 0;
+        std::atomic_uint responses_sent_ = 0;
+
+    private:
+
+        inline void onCommandReceived(const zmqutils::reqrep::CommandRequest&) final { this->commands_received_++; }
+
+        inline void onSendingResponse(const zmqutils::reqrep::CommandReply&) final { this->responses_sent_++; }
+    };
+
+    // Further derived server. Its callbacks are not detected, so they must never be called.
+    class DerivedTestServer : public TestServer
+    {
+    public:
+
+        using TestServer::TestServer;
+
+        std::atomic_uint waiting_commands_ = 0;
+        std::atomic_uint custom_commands_received_ = 0;
+
+    private:
+
+        inline void onWaitingCommand() override { this->waiting_commands_++; }
+
+        inline void onCustomCommandReceived(zmqutils::reqrep::CommandRequest&) override
+        {
+            this->custom_commands_received_++;
+        }
+    };
+
+    // Instanciate the server and check the detected callbacks.
+    DerivedTestServer server(9999, "*", "TEST SERVER", "1.1.1", "This is the TEST server");
+    const std::uint32_t expected_hooks =
+        static_cast<std::uint32_t>(TestServer::ServerHook::COMMAND_RECEIVED) |
+        static_cast<std::uint32_t>(TestServer::ServerHook::SENDING_RESPONSE);
+    M_EXPECTED_EQ(server.getEnabledHooks(), expected_hooks)
+
+    // Register a custom command.
+    server.registerReqProcFunc(TestCommand::REQ_FUNCTION,
+                               [](const zmqutils::reqrep::CommandRequest&, zmqutils::reqrep::CommandReply& reply)
+    {
+        reply.result = OperationResult::COMMAND_OK;
+    });
+
+    // Start the server.
+    if(!server.startServer())
+    {
+        std::cout << "Server start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Start and connect the client, and send the custom command.
+    TestClient client("tcp://127.0.0.1:9999", "", "TEST CLIENT", "1.1.1", "This is the TEST client");
+    zmqutils::reqrep::CommandReply reply;
+    const bool connected = client.startClient() && client.doConnect() == OperationResult::COMMAND_OK;
+    const OperationResult result = client.sendCommand(TestCommand::REQ_FUNCTION, reply);
+
+    // Stop all.
+    client.stopClient();
+    server.stopServer();
+
+    // Check the results (the connection and the custom command).
+    M_EXPECTED_EQ(connected, true)
+    M_EXPECTED_EQ(result, OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(server.commands_received_.load(), 2u)
+    M_EXPECTED_EQ(server.responses_sent_.load(), 2u)
+    M_EXPECTED_EQ(server.waiting_commands_.load(), 0u)
+    M_EXPECTED_EQ(server.custom_commands_received_.load(), 0u)
+}
+
+M_DEFINE_UNIT_TEST(CommandServerClient, SocketOptionsDeadServer)
+{
+    using zmqutils::reqrep::OperationResult;
+
+    // Client with the low latency preset (it includes ZMQ_IMMEDIATE) and without server.
+    TestClient client("tcp://127.0.0.1:9999", "", "TEST CLIENT", "1.1.1", "This is the TEST client");
+    client.setSocketOptions(zmqutils::SocketOptions::lowLatency());
+    client.setServerAliveTimeout(std::chrono::milliseconds(200));
+
+    // Start the client.
+    if(!client.startClient())
+    {
+        std::cout << "Client start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // The request must not block in the send, it must reach the reply timeout.
+    const OperationResult result = client.doConnect();
+    client.stopClient();
+
+    // Check the result.
+    M_EXPECTED_EQ(result, OperationResult::TIMEOUT_REACHED)
+}
+
+M_DEFINE_UNIT_TEST(CommandServerClient, CommandSignatureCall)
+{
+    using zmqutils::reqrep::OperationResult;
+    using zmqutils::reqrep::CommandSignature;
+
+    // Signatures shared by the server and the client.
+    using InputsSignature = CommandSignature<std::function<void(const int&, const std::string&)>,
+                                             std::tuple<int, std::string>>;
+    using OutputsSignature = CommandSignature<std::function<int(const int&, double&, std::string&)>,
+                                              std::tuple<int>, std::tuple<double, std::string>>;
+    using VoidSignature = CommandSignature<std::function<void()>>;
+
+    // Signature that does not match the reply of the outputs command.
+    using WrongSignature = CommandSignature<std::function<std::int8_t(const int&)>, std::tuple<int>>;
+
+    class TestServer : public zmqutils::reqrep::CommandServer<TestServer,
+                                                              zmqutils::reqrep::CommandServerPolicies<false>,
+                                                              zmqutils::reqrep::ClbkCommandServerBase>
+    {
+    public:
+
+        using CommandServer::CommandServer;
+
+        inline void setValues(const int& number, const std::string& text)
+        {
+            this->number_ = number;
+            this->text_ = text;
+        }
+
+        inline int compute(const int& input, double& half, std::string& text)
+        {
+            half = input / 2.0;
+            text = "value " + std::to_string(input);
+            return input * 2;
+        }
+
+        inline void touch() { this->touches_++; }
+
+        std::atomic_uint touches_ = 0;
+        int number_ = 0;
+        std::string text_;
+    };
+
+    // Instanciate the server and register the callbacks with the signatures.
+    TestServer server(9999, "*", "TEST SERVER", "1.1.1", "This is the TEST server");
+    server.registerCbAndReqProcFunc<InputsSignature>(TestCommand::REQ_INPUTS, &server, &TestServer::setValues);
+    server.registerCbAndReqProcFunc<OutputsSignature>(TestCommand::REQ_OUTPUTS, &server, &TestServer::compute);
+    server.registerCbAndReqProcFunc<VoidSignature>(TestCommand::REQ_VOID, &server, &TestServer::touch);
+
+    // Start the server, and start and connect the client.
+    TestClient client("tcp://127.0.0.1:9999", "", "TEST CLIENT", "1.1.1", "This is the TEST client");
+    if(!server.startServer() || !client.startClient() || client.doConnect() != OperationResult::COMMAND_OK)
+    {
+        std::cout << "Start failed!!" << std::endl;
+        client.stopClient();
+        server.stopServer();
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Call the commands.
+    int result = 0;
+    double half = 0.0;
+    std::string text;
+    std::int8_t wrong_result = 0;
+    const OperationResult inputs_res = client.call<InputsSignature>(TestCommand::REQ_INPUTS, 7, std::string("seven"));
+    const OperationResult outputs_res = client.call<OutputsSignature>(TestCommand::REQ_OUTPUTS, 21, result, half, text);
+    const OperationResult void_res = client.call<VoidSignature>(TestCommand::REQ_VOID);
+    const OperationResult wrong_res = client.call<WrongSignature>(TestCommand::REQ_OUTPUTS, 21, wrong_result);
+
+    // Stop all.
+    client.stopClient();
+    server.stopServer();
+
+    // Check the inputs only command.
+    M_EXPECTED_EQ(inputs_res, OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(server.number_, 7)
+    M_EXPECTED_EQ(server.text_, std::string("seven"))
+
+    // Check the command with return value and output parameters.
+    M_EXPECTED_EQ(outputs_res, OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(result, 42)
+    M_EXPECTED_EQ(half, 10.5)
+    M_EXPECTED_EQ(text, std::string("value 21"))
+
+    // Check the void command.
+    M_EXPECTED_EQ(void_res, OperationResult::COMMAND_OK)
+    M_EXPECTED_EQ(server.touches_.load(), 1u)
+
+    // Check the reply that can't be deserialized.
+    M_EXPECTED_EQ(wrong_res, OperationResult::BAD_PARAMETERS)
+}
+
+M_DEFINE_UNIT_TEST(CommandServerClient, ReactorAutoAlive)
+{
+    using zmqutils::reqrep::OperationResult;
+    using zmqutils::reqrep::ServerCommand;
+
+    class TestServer : public zmqutils::reqrep::CommandServer<TestServer,
+                                                              zmqutils::reqrep::CommandServerPolicies<false>,
+                                                              zmqutils::reqrep::ClbkCommandServerBase>
+    {
+    public:
+
+        using CommandServer::CommandServer;
+    };
+
+    // Client that counts the alive replies and the dead server events.
+    class AliveClient : public zmqutils::reqrep::CommandClientBase
+    {
+    public:
+
+        using zmqutils::reqrep::CommandClientBase::CommandClientBase;
+
+        std::atomic_uint alive_replies_ = 0;
+        std::atomic_uint dead_servers_ = 0;
+        std::atomic_uint errors_ = 0;
+
+    private:
+
+        inline void onClientStart() override {}
+        inline void onClientStop() override {}
+        inline void onWaitingReply() override {}
+        inline void onDeadServer(const zmqutils::reqrep::CommandServerInfo&) override { this->dead_servers_++; }
+        inline void onConnected(const zmqutils::reqrep::CommandServerInfo&) override {}
+        inline void onDisconnected(const zmqutils::reqrep::CommandServerInfo&) override {}
+        inline void onBadOperation(const zmqutils::reqrep::CommandReply&) override {}
+        inline void onSendingCommand(const zmqutils::reqrep::CommandRequest&) override {}
+        inline void onClientError(const zmq::error_t&, const std::string&) override { this->errors_++; }
+
+        inline void onReplyReceived(const zmqutils::reqrep::CommandReply& reply) override
+        {
+            if (reply.command == ServerCommand::REQ_ALIVE)
+                this->alive_replies_++;
+        }
+    };
+
+    // Shared reactor for the auto alive of the client.
+    auto reactor = std::make_shared<zmqutils::ZMQReactor>();
+    if (!reactor->start())
+    {
+        std::cout << "Reactor start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Instanciate the server and the client, with fast alive messages.
+    TestServer server(9999, "*", "TEST SERVER", "1.1.1", "This is the TEST server");
+    AliveClient client("tcp://127.0.0.1:9999", "", "TEST CLIENT", "1.1.1", "This is the TEST client");
+    client.setReactor(reactor);
+    client.setAliveCallbacksEnabled(true);
+    client.setSendAlivePeriod(std::chrono::milliseconds(50));
+    client.setServerAliveTimeout(std::chrono::milliseconds(200));
+
+    // Start the server, and start and connect the client with auto alive.
+    if(!server.startServer() || !client.startClient() || client.doConnect(true) != OperationResult::COMMAND_OK)
+    {
+        std::cout << "Start failed!!" << std::endl;
+        client.stopClient();
+        server.stopServer();
+        reactor->stop();
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Let the reactor send some alive messages, then stop the server and wait for the alive timeout.
+    std::this_thread::sleep_for(std::chrono::milliseconds(400));
+    const unsigned alive_replies = client.alive_replies_;
+    server.stopServer();
+    std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+    // Stop all (the client before the reactor).
+    client.stopClient();
+    reactor->stop();
+
+    // Check the results.
+    M_EXPECTED_EQ(client.getReactor() == reactor, true)
+    M_EXPECTED_EQ(alive_replies >= 3, true)
+    M_EXPECTED_EQ(client.dead_servers_.load(), 1u)
+    M_EXPECTED_EQ(client.errors_.load(), 0u)
+    M_EXPECTED_EQ(client.getWorkerCpuTime() == std::chrono::nanoseconds(0), true)
+}
+
+int main()
+{
+    // Start of the session.
+    M_START_UNIT_TEST_SESSION("LibZMQUtils CommandServerClient Session")
+
+    // Register the tests.
+    M_REGISTER_UNIT_TEST(CommandServerClient, ProcessFunctionsTable)
+    M_REGISTER_UNIT_TEST(CommandServerClient, CommandServerHooks)
+    M_REGISTER_UNIT_TEST(CommandServerClient, SocketOptionsDeadServer)
+    M_REGISTER_UNIT_TEST(CommandServerClient, CommandSignatureCall)
+    M_REGISTER_UNIT_TEST(CommandServerClient, ReactorAutoAlive)
+
+    // Run the unit tests.
+    M_RUN_UNIT_TESTS()
+}
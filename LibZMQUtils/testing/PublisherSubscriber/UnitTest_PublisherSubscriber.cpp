@@ -34,25 +34,148 @@
 
 // C++ INCLUDES
 // =====================================================================================================================
+#include <cstdio>
 #include <iostream>
 #include <vector>
 #include <omp.h>
 // =====================================================================================================================
 
+// PLATFORM INCLUDES
+// =====================================================================================================================
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+// =====================================================================================================================
+
 // ZMQUTILS INCLUDES
 // =====================================================================================================================
 #include <LibZMQUtils/Modules/PublisherSubscriber>
 #include <LibZMQUtils/Modules/Testing>
 // =====================================================================================================================
 
+// Typed topics used in the tests.
+M_DECLARE_PUBSUB_TOPIC(TestTypedTopic, "TEST_TYPED_TOPIC", std::string)
+
 // Basic tests.
 M_DECLARE_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
 M_DECLARE_UNIT_TEST(PublisherSubscriber, RegisterCbAndReqProcFunc)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, TypedTopicPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, DirectSendPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, ReactorPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, DedicatedContextPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, SocketOptionsPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, DispatchWorkersPublishSubscribe)
+#ifdef __linux__
+M_DECLARE_UNIT_TEST(PublisherSubscriber, ThreadConfigPublishSubscribe)
+#endif
+M_DECLARE_UNIT_TEST(PublisherSubscriber, ConflatedDispatchQueue)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, TopicDispatchTrie)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, TopicIdsPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, SharedDataPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, BrokerPublishSubscribe)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, JournalPublishReplay)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, RuntimeFilterChanges)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, SubscribeFromCallback)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, SequenceTracking)
+M_DECLARE_UNIT_TEST(PublisherSubscriber, LatencyHistogram)
+#ifdef ZMQ_BUILD_DRAFT_API
+M_DECLARE_UNIT_TEST(PublisherSubscriber, UdpRadioDishPublishSubscribe)
+#endif
 
 // Advanced tests.
 M_DECLARE_UNIT_TEST(PublisherSubscriber, MultithreadPublishSubscribe)
 
 
+// Common fixture of the tests.
+
+// Endpoint and topic used by the common fixture.
+const std::string kTestEndpoint = "tcp://127.0.0.1:9999";
+const std::string kTestTopic = "TEST_TOPIC";
+
+// Publisher bound to the test endpoint.
+class TestPublisher : public zmqutils::pubsub::PublisherBase
+{
+public:
+
+    inline TestPublisher() :
+        zmqutils::pubsub::PublisherBase(9999, "*", "TEST PUBLISHER", "1.1.1", "This is the TEST publisher")
+    {}
+};
+
+// Subscriber with empty callbacks.
+class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+{
+public:
+
+    inline TestSubscriber() :
+        zmqutils::pubsub::ClbkSubscriberBase("TEST SUBSCRIBER", "1.1.1", "This is the TEST subscriber.")
+    {}
+
+private:
+
+    inline void onSubscriberStart() override {}
+
+    inline void onSubscriberStop() override {}
+
+    inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+};
+
+// Callback handler that stores the received values until the expected number arrives.
+class ValuesHandler
+{
+private:
+
+    std::promise<void> promise_;
+    unsigned expected_;
+
+public:
+
+    inline ValuesHandler(unsigned expected) :
+        expected_(expected), future_(promise_.get_future()) {}
+
+    inline void handleMsg(const unsigned &value)
+    {
+        this->values_.push_back(value);
+        if (this->values_.size() == this->expected_)
+            this->promise_.set_value();
+    }
+
+    inline bool waitValues()
+    {
+        return this->future_.wait_for(std::chrono::milliseconds(5000)) == std::future_status::ready;
+    }
+
+    inline bool valuesInOrder() const
+    {
+        for (unsigned i = 0; i < this->values_.size(); i++)
+            if (this->values_[i] != i)
+                return false;
+        return this->values_.size() == this->expected_;
+    }
+
+    std::vector<unsigned> values_;
+    std::future<void> future_;
+};
+
+// Subscribe to the test topic with the handler and start the subscriber.
+inline bool startTestSubscriber(TestSubscriber& subscriber, ValuesHandler& handler)
+{
+    subscriber.subscribe(kTestEndpoint);
+    subscriber.addTopicFilter(kTestTopic);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const unsigned&)>>(
+        kTestTopic, &handler, &ValuesHandler::handleMsg);
+    return subscriber.startSubscriber();
+}
+
+// Publish the values [first, last) in the test topic.
+inline void publishTestValues(zmqutils::pubsub::PublisherBase& publisher, unsigned first, unsigned last)
+{
+    for (unsigned i = first; i < last; i++)
+        publisher.enqueueMsg(kTestTopic, zmqutils::pubsub::MessagePriority::NormalPriority, i);
+}
+
+
 // Implementations.
 
 M_DEFINE_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
@@ -130,7 +253,7 @@ M_DEFINE_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
     subscriber.addTopicFilter(test_topic);
 
     // Register the callback.
-    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+    bool registered = subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
         test_topic, &handler, &SubscriberCallbackHandler::handleMsg);
 
     // Start the subscriber.
@@ -144,6 +267,10 @@ M_DEFINE_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
         return;
     }
 
+    // The process functions can't be registered while the subscriber is working.
+    bool registered_working = subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "OTHER_TOPIC", &handler, &SubscriberCallbackHandler::handleMsg);
+
     // Send and get the test msg.
     publisher.enqueueMsg(test_topic, zmqutils::pubsub::MessagePriority::NormalPriority, std::move(test_string));
     handler.future_.wait();
@@ -154,6 +281,9 @@ M_DEFINE_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
     subscriber.stopSubscriber();
 
     // Check results.
+    M_EXPECTED_EQ(registered, true)
+    M_EXPECTED_EQ(registered_working, false)
+    M_EXPECTED_EQ(subscriber.hasCallback("OTHER_TOPIC"), false)
     M_EXPECTED_EQ(received_string, test_string)
 }
 
@@ -307,6 +437,1558 @@ M_DEFINE_UNIT_TEST(PublisherSubscriber, RegisterCbAndReqProcFunc)
     M_EXPECTED_EQ_F(received_publication.data.test_number_, test_number, 0.000001)
 }
 
+M_DEFINE_UNIT_TEST(PublisherSubscriber, TypedTopicPublishSubscribe)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<std::string> promise_;
+
+    public:
+
+        inline SubscriberCallbackHandler() : future_(promise_.get_future()) {}
+
+        inline void handleMsg(const std::string &msg)
+        {
+            this->promise_.set_value(msg);
+        }
+
+        std::future<std::string> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+
+    // Test data.
+    std::string test_string = "HOLA MUNDO";
+    std::string received_string;
+    std::future_status fut_status;
+
+    // Instanciate the publisher.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+
+    // Start the publisher.
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler;
+
+    // Configure the subscriber.
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter(std::string(TestTypedTopic::kName));
+
+    // Register the typed callback.
+    subscriber.registerTypedCallback<TestTypedTopic, &SubscriberCallbackHandler::handleMsg>(&handler);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Send and get the test msg.
+    publisher.enqueueTypedMsg<TestTypedTopic>(zmqutils::pubsub::MessagePriority::NormalPriority, test_string);
+    fut_status = handler.future_.wait_for(std::chrono::milliseconds(5000));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check the future.
+    if(fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results.
+    received_string = handler.future_.get();
+    M_EXPECTED_EQ(received_string, test_string)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, DirectSendPublishSubscribe)
+{
+    // Test data.
+    const unsigned messages = 100;
+
+    // Publisher with the direct send mode, and subscriber.
+    TestPublisher publisher;
+    TestSubscriber subscriber;
+    ValuesHandler handler(messages);
+    publisher.setDirectSendEnabled(true);
+
+    // Start all.
+    if(!publisher.startPublisher() || !startTestSubscriber(subscriber, handler))
+    {
+        std::cout << "Start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the subscription (the direct sends don't wait for the worker thread).
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Send the data first from another thread and then from the test thread.
+    std::thread producer([&publisher]{ publishTestValues(publisher, 0, messages / 2); });
+    producer.join();
+    publishTestValues(publisher, messages / 2, messages);
+
+    // Wait all finish and stop all.
+    const bool received = handler.waitValues();
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check results. The order must be preserved.
+    M_EXPECTED_EQ(received, true)
+    M_EXPECTED_EQ(publisher.getDirectSendEnabled(), true)
+    M_EXPECTED_EQ(handler.valuesInOrder(), true)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, ReactorPublishSubscribe)
+{
+    // Test data.
+    const unsigned messages = 100;
+
+    // Shared reactor with two executors for the subscriber callbacks.
+    auto reactor = std::make_shared<zmqutils::ZMQReactor>(2);
+    if (!reactor->start())
+    {
+        std::cout << "Reactor start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Publisher and two subscribers, all of them in the reactor loop.
+    TestPublisher publisher;
+    TestSubscriber subscriber_1;
+    TestSubscriber subscriber_2;
+    ValuesHandler handler_1(messages);
+    ValuesHandler handler_2(messages);
+    publisher.setReactor(reactor);
+    subscriber_1.setReactor(reactor);
+    subscriber_2.setReactor(reactor);
+
+    // Start all.
+    if(!publisher.startPublisher() || !startTestSubscriber(subscriber_1, handler_1) ||
+       !startTestSubscriber(subscriber_2, handler_2))
+    {
+        std::cout << "Start failed!!" << std::endl;
+        publisher.stopPublisher();
+        subscriber_1.stopSubscriber();
+        reactor->stop();
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the subscription and send the data.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    publishTestValues(publisher, 0, messages);
+
+    // Wait all finish.
+    const bool received_1 = handler_1.waitValues();
+    const bool received_2 = handler_2.waitValues();
+
+    // Stop all (the components before the reactor).
+    publisher.stopPublisher();
+    subscriber_1.stopSubscriber();
+    subscriber_2.stopSubscriber();
+    reactor->stop();
+
+    // Check results. The order must be preserved in each subscriber.
+    M_EXPECTED_EQ(received_1, true)
+    M_EXPECTED_EQ(received_2, true)
+    M_EXPECTED_EQ(subscriber_1.getReactor() == reactor, true)
+    M_EXPECTED_EQ(handler_1.valuesInOrder(), true)
+    M_EXPECTED_EQ(handler_2.valuesInOrder(), true)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, DedicatedContextPublishSubscribe)
+{
+    // Test data.
+    const unsigned messages = 100;
+
+    // The global context can't be configured while other components exist.
+    zmqutils::ZMQContextConfig config;
+    config.io_threads = 2;
+
+    // Publisher with its own context, and subscriber in the global context.
+    TestPublisher publisher;
+    TestSubscriber subscriber;
+    ValuesHandler handler(messages);
+    M_EXPECTED_EQ(publisher.setDedicatedContext(config), true)
+    M_EXPECTED_EQ(zmqutils::ZMQContextHandler::setGlobalContextConfig(config), false)
+
+    // Start the publisher.
+    if(!publisher.startPublisher())
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // The context of a working publisher can't be replaced.
+    M_EXPECTED_EQ(publisher.clearDedicatedContext(), false)
+    M_EXPECTED_EQ(publisher.setDedicatedContext(config), false)
+
+    // Start the subscriber.
+    if(!startTestSubscriber(subscriber, handler))
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the subscription and send the data.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    publishTestValues(publisher, 0, messages);
+
+    // Wait all finish and stop all.
+    const bool received = handler.waitValues();
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check results.
+    M_EXPECTED_EQ(received, true)
+    M_EXPECTED_EQ(publisher.hasDedicatedContext(), true)
+    M_EXPECTED_EQ(subscriber.hasDedicatedContext(), false)
+    M_EXPECTED_EQ(handler.valuesInOrder(), true)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, SocketOptionsPublishSubscribe)
+{
+    // Test data.
+    const unsigned messages = 1000;
+
+    // Publisher with the bulk preset.
+    TestPublisher publisher;
+    publisher.setSocketOptions(zmqutils::SocketOptions::bulk());
+
+    // Subscriber with the low latency preset, but without reception limit (the own setter has priority).
+    TestSubscriber subscriber;
+    ValuesHandler handler(messages);
+    subscriber.setSocketOptions(zmqutils::SocketOptions::lowLatency());
+    subscriber.setReceiveHWM(0);
+
+    // Start all.
+    if(!publisher.startPublisher() || !startTestSubscriber(subscriber, handler))
+    {
+        std::cout << "Start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // The options can't be changed while the publisher is working.
+    publisher.setSocketOptions(zmqutils::SocketOptions());
+
+    // Wait for the subscription and send the data.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    publishTestValues(publisher, 0, messages);
+
+    // Wait all finish and stop all.
+    const bool received = handler.waitValues();
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Options read back from the real sockets.
+    const zmqutils::SocketOptions bulk = zmqutils::SocketOptions::bulk();
+    const zmqutils::SocketOptions low_latency = zmqutils::SocketOptions::lowLatency();
+    const zmqutils::SocketOptions pub_options = publisher.getAppliedSocketOptions();
+    const zmqutils::SocketOptions sub_options = subscriber.getAppliedSocketOptions();
+
+    // Check results.
+    M_EXPECTED_EQ(received, true)
+    M_EXPECTED_EQ(handler.valuesInOrder(), true)
+    M_EXPECTED_EQ(publisher.getSocketOptions().snd_buf, bulk.snd_buf)
+    M_EXPECTED_EQ(pub_options.snd_hwm, bulk.snd_hwm)
+    M_EXPECTED_EQ(pub_options.snd_buf, bulk.snd_buf)
+    M_EXPECTED_EQ(pub_options.rcv_buf, bulk.rcv_buf)
+    M_EXPECTED_EQ(pub_options.backlog, bulk.backlog)
+    M_EXPECTED_EQ(pub_options.tos, bulk.tos)
+    M_EXPECTED_EQ(sub_options.rcv_hwm, 0)
+    M_EXPECTED_EQ(sub_options.snd_hwm, low_latency.snd_hwm)
+    M_EXPECTED_EQ(sub_options.immediate, low_latency.immediate)
+    M_EXPECTED_EQ(sub_options.tcp_keepalive, low_latency.tcp_keepalive)
+    M_EXPECTED_EQ(sub_options.tcp_keepalive_idle, low_latency.tcp_keepalive_idle)
+    M_EXPECTED_EQ(sub_options.tcp_keepalive_intvl, low_latency.tcp_keepalive_intvl)
+    M_EXPECTED_EQ(sub_options.tcp_keepalive_cnt, low_latency.tcp_keepalive_cnt)
+    M_EXPECTED_EQ(sub_options.tos, low_latency.tos)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, DispatchWorkersPublishSubscribe)
+{
+    // Callback handler with a slow and a fast topic.
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleSlowMsg(const unsigned& n_msg)
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            this->slow_v_.push_back(n_msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        inline void handleFastMsg(const unsigned& n_msg)
+        {
+            this->fast_v_.push_back(n_msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        std::vector<unsigned> slow_v_;
+        std::vector<unsigned> fast_v_;
+        std::future<void> future_;
+    };
+
+    // Test data.
+    const std::string slow_topic = "TEST_SLOW_TOPIC";
+    const std::string fast_topic = "TEST_FAST_TOPIC";
+    const unsigned messages_per_topic = 100;
+
+    // Publisher, and subscriber with two dispatch workers.
+    TestPublisher publisher;
+    TestSubscriber subscriber;
+    SubscriberCallbackHandler handler(2 * messages_per_topic);
+    subscriber.setDispatchWorkers(2);
+    subscriber.subscribe(kTestEndpoint);
+    subscriber.addTopicFilter(slow_topic);
+    subscriber.addTopicFilter(fast_topic);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const unsigned&)>>(
+        slow_topic, &handler, &SubscriberCallbackHandler::handleSlowMsg);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const unsigned&)>>(
+        fast_topic, &handler, &SubscriberCallbackHandler::handleFastMsg);
+
+    // Start all.
+    if(!publisher.startPublisher() || !subscriber.startSubscriber())
+    {
+        std::cout << "Start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Send the data interleaving both topics.
+    for (unsigned i = 0; i < messages_per_topic; i++)
+    {
+        publisher.enqueueMsg(slow_topic, zmqutils::pubsub::MessagePriority::NormalPriority, i);
+        publisher.enqueueMsg(fast_topic, zmqutils::pubsub::MessagePriority::NormalPriority, i);
+    }
+
+    // Wait all finish and stop all.
+    const bool received = handler.future_.wait_for(std::chrono::milliseconds(5000)) == std::future_status::ready;
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Get the dispatch stats (they remain available after stopping).
+    zmqutils::pubsub::SubscriberDispatchStats stats = subscriber.getDispatchStats();
+
+    // Check results. The order of each topic must be preserved.
+    M_EXPECTED_EQ(received, true)
+    M_EXPECTED_EQ(handler.slow_v_.size(), static_cast<size_t>(messages_per_topic))
+    M_EXPECTED_EQ(handler.fast_v_.size(), static_cast<size_t>(messages_per_topic))
+    for (unsigned i = 0; i < handler.slow_v_.size(); i++)
+        M_EXPECTED_EQ(handler.slow_v_[i], i)
+    for (unsigned i = 0; i < handler.fast_v_.size(); i++)
+        M_EXPECTED_EQ(handler.fast_v_[i], i)
+
+    // Check the stats.
+    M_EXPECTED_EQ(stats.queue_depths.size(), static_cast<size_t>(2))
+    M_EXPECTED_EQ(stats.cpu_times.size(), static_cast<size_t>(2))
+    M_EXPECTED_EQ(stats.topics[slow_topic].processed_msgs, static_cast<std::uint64_t>(messages_per_topic))
+    M_EXPECTED_EQ(stats.topics[fast_topic].processed_msgs, static_cast<std::uint64_t>(messages_per_topic))
+}
+
+#ifdef __linux__
+M_DEFINE_UNIT_TEST(PublisherSubscriber, ThreadConfigPublishSubscribe)
+{
+    // Subscriber that counts the errors (for example, a thread configuration that was not applied).
+    class ThreadSubscriber : public TestSubscriber
+    {
+    public:
+
+        std::atomic_uint errors_ = 0;
+
+    private:
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {this->errors_++;}
+    };
+
+    // Callback handler that reads the name and the affinity of the thread that runs the callbacks.
+    class ThreadHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        bool done_ = false;
+
+    public:
+
+        inline ThreadHandler() : future_(promise_.get_future()) {}
+
+        inline void handleMsg(const unsigned &)
+        {
+            if (this->done_)
+                return;
+
+            char name[16] = {};
+            pthread_getname_np(pthread_self(), name, sizeof(name));
+            this->name_ = name;
+
+            cpu_set_t cpu_set;
+            CPU_ZERO(&cpu_set);
+            pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+            for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++)
+                if (CPU_ISSET(cpu, &cpu_set))
+                    this->cpus_.push_back(cpu);
+
+            this->done_ = true;
+            this->promise_.set_value();
+        }
+
+        std::string name_;
+        std::vector<unsigned> cpus_;
+        std::future<void> future_;
+    };
+
+    // Use the first CPU allowed for the process.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed);
+    unsigned first_cpu = 0;
+    while (first_cpu < CPU_SETSIZE && !CPU_ISSET(first_cpu, &allowed))
+        first_cpu++;
+
+    // Publisher, and subscriber whose worker (which runs the callbacks) is pinned to the CPU.
+    TestPublisher publisher;
+    ThreadSubscriber subscriber;
+    ThreadHandler handler;
+    const std::string default_name = subscriber.getWorkerThreadConfig().name;
+    zmqutils::utils::ThreadConfig config;
+    config.name = "test-sub";
+    config.cpus = {first_cpu};
+    subscriber.setWorkerThreadConfig(config);
+    subscriber.subscribe(kTestEndpoint);
+    subscriber.addTopicFilter(kTestTopic);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const unsigned&)>>(
+        kTestTopic, &handler, &ThreadHandler::handleMsg);
+
+    // Start all.
+    if(!publisher.startPublisher() || !subscriber.startSubscriber())
+    {
+        std::cout << "Start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Publish until the callback runs.
+    bool received = false;
+    for (unsigned i = 0; i < 50 && !received; i++)
+    {
+        publishTestValues(publisher, i, i + 1);
+        received = handler.future_.wait_for(std::chrono::milliseconds(100)) == std::future_status::ready;
+    }
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check results.
+    M_EXPECTED_EQ(default_name, std::string("zmq-sub"))
+    M_EXPECTED_EQ(received, true)
+    M_EXPECTED_EQ(handler.name_, std::string("test-sub"))
+    M_EXPECTED_EQ(handler.cpus_, std::vector<unsigned>{first_cpu})
+    M_EXPECTED_EQ(subscriber.errors_.load(), 0u)
+}
+#endif
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, ConflatedDispatchQueue)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        unsigned last_value_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned last_value) :
+            last_value_(last_value), future_(promise_.get_future()) {}
+
+        inline void handleSlowMsg(const unsigned &value)
+        {
+            // Emulate a slow consumer.
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            this->values_.push_back(value);
+            if (value == this->last_value_)
+                this->promise_.set_value();
+        }
+
+        std::vector<unsigned> values_;
+        std::future<void> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+
+    // Test data.
+    const std::string slow_topic = "TEST_SLOW_TOPIC";
+    const unsigned messages = 200;
+    std::future_status fut_status;
+
+    // Instanciate the publisher.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+
+    // Start the publisher.
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler(messages - 1);
+
+    // Configure the subscriber with one dispatch worker that keeps only the newest message of each topic.
+    subscriber.setDispatchWorkers(1);
+    subscriber.setDispatchQueuePolicy(zmqutils::pubsub::DispatchQueuePolicy::CONFLATE);
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter(slow_topic);
+
+    // Register the callback.
+    subscriber.registerCbAndReqProcFunc<std::function<void(const unsigned&)>>(
+        slow_topic, &handler, &SubscriberCallbackHandler::handleSlowMsg);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Send the data faster than the subscriber can process it.
+    for (unsigned i = 0; i < messages; i++)
+        publisher.enqueueMsg(slow_topic, zmqutils::pubsub::MessagePriority::NormalPriority, i);
+
+    // Wait the last message.
+    fut_status = handler.future_.wait_for(std::chrono::milliseconds(5000));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Get the dispatch stats.
+    zmqutils::pubsub::SubscriberDispatchStats stats = subscriber.getDispatchStats();
+
+    // Check the future.
+    if(fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results. The processed values must be increasing, and every message must be processed or conflated.
+    for (std::size_t i = 1; i < handler.values_.size(); i++)
+        M_EXPECTED_EQ(handler.values_[i] > handler.values_[i-1], true)
+    M_EXPECTED_EQ(stats.max_queue_depths[0], static_cast<size_t>(1))
+    M_EXPECTED_EQ(stats.topics[slow_topic].processed_msgs + stats.topics[slow_topic].dropped_msgs,
+                  static_cast<std::uint64_t>(messages))
+    M_EXPECTED_EQ(stats.dropped_msgs[0] > 0, true)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, TopicDispatchTrie)
+{
+    // Trie with exact, single-level and multi-level patterns.
+    zmqutils::pubsub::TopicDispatchTrie<int> trie;
+    trie.insert("amelas/mount/az", 1);
+    trie.insert("amelas/mount/#", 2);
+    trie.insert("amelas/+/az", 3);
+    trie.insert("#", 4);
+
+    // Auxiliar lambda for the lookup.
+    auto lookup = [&trie](std::string_view topic)
+    {
+        const int* value = trie.find(topic);
+        return value ? *value : -1;
+    };
+
+    // Check the priorities.
+    M_EXPECTED_EQ(lookup("amelas/mount/az"), 1)
+    M_EXPECTED_EQ(lookup("amelas/mount/el/speed"), 2)
+    M_EXPECTED_EQ(lookup("amelas/mount"), 2)
+    M_EXPECTED_EQ(lookup("amelas/dome/az"), 3)
+    M_EXPECTED_EQ(lookup("amelas/dome/el"), 4)
+    M_EXPECTED_EQ(trie.size(), static_cast<size_t>(4))
+
+    // Check the removal.
+    M_EXPECTED_EQ(trie.erase("#"), true)
+    M_EXPECTED_EQ(trie.erase("#"), false)
+    M_EXPECTED_EQ(lookup("amelas/dome/el"), -1)
+    M_EXPECTED_EQ(trie.contains("amelas/+/az"), true)
+    M_EXPECTED_EQ(trie.contains("amelas/mount"), false)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, TopicIdsPublishSubscribe)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleMsg(const std::string& msg)
+        {
+            this->received_v_.push_back(msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        std::vector<std::string> received_v_;
+        std::future<void> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+
+    // Test data.
+    std::future_status fut_status;
+
+    // Instanciate the publisher with the topic identifiers enabled.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+    publisher.setTopicIdsEnabled(true);
+
+    // Start the publisher.
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler(4);
+
+    // Configure the subscriber. The "amelas/dome" topic must be discarded by the filter.
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter("amelas/mount/");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "amelas/#", &handler, &SubscriberCallbackHandler::handleMsg);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the connection.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Send the test msgs. Each new topic is announced and sent plain during one announcement period.
+    publisher.enqueueMsg("amelas/dome/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("dome"));
+    publisher.enqueueMsg("amelas/mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az"));
+    publisher.enqueueMsg("amelas/mount/el", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("el"));
+
+    // Send the test msgs again after the announcement period, using the identifiers frames.
+    std::this_thread::sleep_for(zmqutils::pubsub::kTopicIdsAnnouncePeriod + std::chrono::milliseconds(200));
+    publisher.enqueueMsg("amelas/dome/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("dome"));
+    publisher.enqueueMsg("amelas/mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az"));
+    publisher.enqueueMsg("amelas/mount/el", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("el"));
+    fut_status = handler.future_.wait_for(std::chrono::seconds(2));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check the future.
+    if (fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results.
+    M_EXPECTED_EQ(handler.received_v_.size(), static_cast<size_t>(4))
+    M_EXPECTED_EQ(handler.received_v_[0], std::string("az"))
+    M_EXPECTED_EQ(handler.received_v_[1], std::string("el"))
+    M_EXPECTED_EQ(handler.received_v_[2], std::string("az"))
+    M_EXPECTED_EQ(handler.received_v_[3], std::string("el"))
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, BrokerPublishSubscribe)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleMsg(const std::string& msg)
+        {
+            this->received_v_.push_back(msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        std::vector<std::string> received_v_;
+        std::future<void> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+
+    // Broker configuration variables.
+    unsigned broker_port = 9998;
+    std::string broker_endpoint = "tcp://127.0.0.1:9998";
+
+    // Test data.
+    std::future_status fut_status;
+
+    // Instanciate the publisher.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+
+    // Start the publisher.
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Instanciate and start the broker.
+    zmqutils::pubsub::BrokerBase broker(broker_port);
+    broker.addPublisher(publisher_endpoint);
+    if(!broker.startBroker())
+    {
+        std::cout << "Broker start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler(2);
+
+    // Configure the subscriber through the broker. The "amelas/dome" topic must be discarded by the filter.
+    subscriber.subscribe(broker_endpoint);
+    subscriber.addTopicFilter("amelas/mount/");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "amelas/#", &handler, &SubscriberCallbackHandler::handleMsg);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the connections and the subscriptions forwarding.
+    std::this_thread::sleep_for(std::chrono::milliseconds(300));
+
+    // Send the test msgs.
+    publisher.enqueueMsg("amelas/dome/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("dome"));
+    publisher.enqueueMsg("amelas/mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az"));
+    publisher.enqueueMsg("amelas/mount/el", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("el"));
+    fut_status = handler.future_.wait_for(std::chrono::seconds(2));
+
+    // Stop all and get the broker statistics.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+    broker.stopBroker();
+    zmqutils::pubsub::BrokerStats stats = broker.getStats();
+
+    // Check the future.
+    if (fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results.
+    M_EXPECTED_EQ(handler.received_v_.size(), static_cast<size_t>(2))
+    M_EXPECTED_EQ(handler.received_v_[0], std::string("az"))
+    M_EXPECTED_EQ(handler.received_v_[1], std::string("el"))
+    M_EXPECTED_EQ(stats.msgs, static_cast<std::uint64_t>(2))
+    M_EXPECTED_EQ(stats.topics["amelas/mount/az"].msgs, static_cast<std::uint64_t>(1))
+    M_EXPECTED_EQ(stats.topics["amelas/mount/"].subscriptions, static_cast<std::uint64_t>(1))
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, SharedDataPublishSubscribe)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleMsg(const std::string& msg)
+        {
+            this->received_v_.push_back(msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        std::vector<std::string> received_v_;
+        std::future<void> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+
+    // Test data.
+    std::future_status fut_status;
+
+    // Instanciate the publisher.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+
+    // Start the publisher.
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler(3);
+
+    // Configure the subscriber.
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter("amelas/");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "amelas/#", &handler, &SubscriberCallbackHandler::handleMsg);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the connection.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Send the same shared data on several topics, and publish it again.
+    auto data = zmqutils::pubsub::SharedPublishedData::create(std::string("frame"));
+    std::vector<zmqutils::pubsub::TopicType> topics = {"amelas/cam1", "amelas/cam2"};
+    publisher.enqueueSharedMsg(topics, zmqutils::pubsub::MessagePriority::NormalPriority, data);
+    publisher.enqueueSharedMsg("amelas/cam3", zmqutils::pubsub::MessagePriority::NormalPriority, data);
+    fut_status = handler.future_.wait_for(std::chrono::seconds(2));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check the future.
+    if (fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results. Only our reference to the shared data must remain.
+    M_EXPECTED_EQ(handler.received_v_.size(), static_cast<size_t>(3))
+    M_EXPECTED_EQ(handler.received_v_[0], std::string("frame"))
+    M_EXPECTED_EQ(handler.received_v_[2], std::string("frame"))
+    M_EXPECTED_EQ(data.bytes.use_count(), 1L)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, JournalPublishReplay)
+{
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string journal_prefix = "unittest_journal";
+
+    // Remove the segments of previous executions.
+    for (int i = 0; i < 3; i++)
+        std::remove(("./" + journal_prefix + "_00000" + std::to_string(i) + ".zmqj").c_str());
+
+    // Instanciate the publisher with the journal enabled (small segments for testing several segments).
+    zmqutils::pubsub::PublisherBase publisher(publisher_port);
+    M_EXPECTED_EQ(publisher.enableJournal(".", journal_prefix, 256), true)
+
+    // Start the publisher.
+    if(!publisher.startPublisher())
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Send the test msgs (they are stored in the journal even without subscribers).
+    publisher.enqueueMsg("amelas/mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az1"));
+    publisher.enqueueMsg("amelas/mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az2"));
+    publisher.enqueueMsg("amelas/mount/el", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("el"));
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    publisher.stopPublisher();
+    publisher.flushJournal();
+    publisher.disableJournal();
+
+    // Replay the journal from the second message.
+    std::vector<std::string> replayed;
+    std::vector<zmqutils::pubsub::SequenceType> sequences;
+    zmqutils::pubsub::JournalReplayConfig config;
+    config.first_sequence = 2;
+    zmqutils::pubsub::PublicationJournalReader reader(".", journal_prefix);
+    std::size_t count = reader.replay(config, [&](zmqutils::pubsub::PublishedMessage&& msg)
+    {
+        std::string data;
+        zmqutils::serializer::BinarySerializer::fastDeserialization(msg.data.bytes.get(), msg.data.size, data);
+        replayed.push_back(msg.topic + ":" + data);
+        sequences.push_back(msg.sequence);
+    });
+
+    // Remove the segments.
+    for (int i = 0; i < 3; i++)
+        std::remove(("./" + journal_prefix + "_00000" + std::to_string(i) + ".zmqj").c_str());
+
+    // Check results.
+    M_EXPECTED_EQ(count, static_cast<std::size_t>(2))
+    M_EXPECTED_EQ(replayed.size(), static_cast<std::size_t>(2))
+    M_EXPECTED_EQ(replayed[0], std::string("amelas/mount/az:az2"))
+    M_EXPECTED_EQ(replayed[1], std::string("amelas/mount/el:el"))
+    M_EXPECTED_EQ(sequences[1], static_cast<zmqutils::pubsub::SequenceType>(3))
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, RuntimeFilterChanges)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleMsg(const std::string& msg)
+        {
+            this->received_v_.push_back(msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        inline void handleOtherMsg(const std::string&)
+        {}
+
+        std::vector<std::string> received_v_;
+        std::future<void> future_;
+    };
+
+    // Configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_endpoint = "tcp://127.0.0.1:9999";
+    const unsigned msgs_number = 200;
+
+    // Test data.
+    std::future_status fut_status;
+    std::vector<std::string> expected_v;
+
+    // Instanciate and start the publisher.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port);
+    if(!publisher.startPublisher())
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber;
+    SubscriberCallbackHandler handler(msgs_number);
+
+    // Configure the subscriber.
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter("TEST_TOPIC");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "TEST_TOPIC", &handler, &SubscriberCallbackHandler::handleMsg);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "OTHER_TOPIC", &handler, &SubscriberCallbackHandler::handleOtherMsg);
+
+    // Start the subscriber.
+    if(!subscriber.startSubscriber())
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the connection.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Publish the messages while the filters of other topics are changed.
+    std::thread publisher_th([&publisher, msgs_number]
+    {
+        for (unsigned i = 0; i < msgs_number; i++)
+        {
+            publisher.enqueueMsg("TEST_TOPIC", zmqutils::pubsub::MessagePriority::NormalPriority, std::to_string(i));
+            publisher.enqueueMsg("OTHER_TOPIC", zmqutils::pubsub::MessagePriority::NormalPriority, std::to_string(i));
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    });
+    for (unsigned i = 0; i < 50; i++)
+    {
+        subscriber.addTopicFilter("OTHER_TOPIC");
+        subscriber.subscribe("tcp://127.0.0.1:9998");
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        subscriber.removeTopicFilter("OTHER_TOPIC");
+        subscriber.unsubscribe("tcp://127.0.0.1:9998");
+    }
+    publisher_th.join();
+    fut_status = handler.future_.wait_for(std::chrono::seconds(5));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check the future.
+    if (fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results. Every message of the unchanged topic must be received in order.
+    for (unsigned i = 0; i < msgs_number; i++)
+        expected_v.push_back(std::to_string(i));
+    M_EXPECTED_EQ(handler.received_v_, expected_v)
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, SubscribeFromCallback)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> trigger_promise_;
+        std::promise<void> second_promise_;
+
+    public:
+
+        inline SubscriberCallbackHandler(TestSubscriber& subscriber) :
+            subscriber_(subscriber),
+            trigger_future_(trigger_promise_.get_future()),
+            second_future_(second_promise_.get_future())
+        {}
+
+        inline void handleTrigger(const std::string&)
+        {
+            // Let the main thread send a control request meanwhile, then change the subscriber from the worker.
+            this->trigger_promise_.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(50));
+            this->subscriber_.subscribe("tcp://127.0.0.1:9998");
+            this->subscriber_.addTopicFilter("SECOND_TOPIC");
+        }
+
+        inline void handleSecond(const std::string& msg)
+        {
+            this->second_msg_ = msg;
+            this->second_promise_.set_value();
+        }
+
+        TestSubscriber& subscriber_;
+        std::string second_msg_;
+        std::future<void> trigger_future_;
+        std::future<void> second_future_;
+    };
+
+    // Test data.
+    std::future_status fut_status;
+
+    // Instanciate and start the publishers.
+    zmqutils::pubsub::PublisherBase publisher(9999);
+    zmqutils::pubsub::PublisherBase second_publisher(9998);
+    if(!publisher.startPublisher() || !second_publisher.startPublisher())
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber;
+    SubscriberCallbackHandler handler(subscriber);
+
+    // Configure the subscriber. The messages are processed in the worker thread.
+    subscriber.subscribe("tcp://127.0.0.1:9999");
+    subscriber.addTopicFilter("TRIGGER_TOPIC");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "TRIGGER_TOPIC", &handler, &SubscriberCallbackHandler::handleTrigger);
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "SECOND_TOPIC", &handler, &SubscriberCallbackHandler::handleSecond);
+
+    // Start the subscriber.
+    if(!subscriber.startSubscriber())
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the connection and trigger the callback.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    publisher.enqueueMsg("TRIGGER_TOPIC", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("go"));
+
+    // Send a control request while the worker is inside the callback.
+    handler.trigger_future_.wait();
+    subscriber.addTopicFilter("OTHER_TOPIC");
+
+    // Publish with the publisher subscribed from the callback.
+    std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    second_publisher.enqueueMsg("SECOND_TOPIC", zmqutils::pubsub::MessagePriority::NormalPriority,
+                                std::string("second"));
+    fut_status = handler.second_future_.wait_for(std::chrono::seconds(2));
+
+    // Stop all.
+    publisher.stopPublisher();
+    second_publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check results.
+    M_EXPECTED_EQ(fut_status, std::future_status::ready)
+    M_EXPECTED_EQ(handler.second_msg_, std::string("second"))
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, SequenceTracking)
+{
+    // Gap case. The missing sequences are counted as lost.
+    zmqutils::pubsub::SequenceStats stats;
+    M_EXPECTED_EQ(stats.track(1), std::uint64_t(0))
+    M_EXPECTED_EQ(stats.track(2), std::uint64_t(0))
+    M_EXPECTED_EQ(stats.track(5), std::uint64_t(2))
+    M_EXPECTED_EQ(stats.lost_msgs, std::uint64_t(2))
+    M_EXPECTED_EQ(stats.last_sequence, zmqutils::pubsub::SequenceType(5))
+
+    // Reorder case. A late message is no longer lost.
+    M_EXPECTED_EQ(stats.track(3), std::uint64_t(0))
+    M_EXPECTED_EQ(stats.reordered_msgs, std::uint64_t(1))
+    M_EXPECTED_EQ(stats.lost_msgs, std::uint64_t(1))
+    M_EXPECTED_EQ(stats.last_sequence, zmqutils::pubsub::SequenceType(5))
+
+    // Duplicate cases (the last sequence and an older one already received).
+    stats.track(5);
+    stats.track(3);
+    M_EXPECTED_EQ(stats.duplicated_msgs, std::uint64_t(2))
+    M_EXPECTED_EQ(stats.reordered_msgs, std::uint64_t(1))
+    M_EXPECTED_EQ(stats.lost_msgs, std::uint64_t(1))
+
+    // The last missing message arrives.
+    stats.track(4);
+    M_EXPECTED_EQ(stats.reordered_msgs, std::uint64_t(2))
+    M_EXPECTED_EQ(stats.lost_msgs, std::uint64_t(0))
+
+    // Restart case. A sequence older than the window starts the tracking again.
+    stats.track(1000);
+    M_EXPECTED_EQ(stats.lost_msgs, std::uint64_t(994))
+    M_EXPECTED_EQ(stats.track(1), std::uint64_t(0))
+    M_EXPECTED_EQ(stats.track(2), std::uint64_t(0))
+    M_EXPECTED_EQ(stats.restarts, std::uint64_t(1))
+    M_EXPECTED_EQ(stats.last_sequence, zmqutils::pubsub::SequenceType(2))
+    M_EXPECTED_EQ(stats.reordered_msgs, std::uint64_t(2))
+    M_EXPECTED_EQ(stats.duplicated_msgs, std::uint64_t(2))
+    M_EXPECTED_EQ(stats.received_msgs, std::uint64_t(10))
+}
+
+M_DEFINE_UNIT_TEST(PublisherSubscriber, LatencyHistogram)
+{
+    using std::chrono::nanoseconds;
+    using std::chrono::microseconds;
+    using std::chrono::milliseconds;
+
+    // Empty histogram.
+    zmqutils::pubsub::LatencyHistogram histogram;
+    M_EXPECTED_EQ(histogram.mean().count(), nanoseconds(0).count())
+    M_EXPECTED_EQ(histogram.percentile(50).count(), nanoseconds(0).count())
+
+    // Buckets (bit length of the microseconds). The negative samples are stored as zero.
+    histogram.addSample(nanoseconds(500));
+    histogram.addSample(microseconds(1));
+    histogram.addSample(microseconds(3));
+    histogram.addSample(microseconds(100));
+    histogram.addSample(nanoseconds(-20));
+    M_EXPECTED_EQ(histogram.count, std::uint64_t(5))
+    M_EXPECTED_EQ(histogram.buckets[0], std::uint64_t(2))
+    M_EXPECTED_EQ(histogram.buckets[1], std::uint64_t(1))
+    M_EXPECTED_EQ(histogram.buckets[2], std::uint64_t(1))
+    M_EXPECTED_EQ(histogram.buckets[7], std::uint64_t(1))
+    M_EXPECTED_EQ(histogram.min.count(), nanoseconds(0).count())
+    M_EXPECTED_EQ(histogram.max.count(), nanoseconds(microseconds(100)).count())
+    M_EXPECTED_EQ(histogram.mean().count(), nanoseconds(20900).count())
+
+    // Percentiles (upper limit of the bucket, limited to the maximum sample).
+    M_EXPECTED_EQ(histogram.percentile(40).count(), nanoseconds(microseconds(1)).count())
+    M_EXPECTED_EQ(histogram.percentile(60).count(), nanoseconds(microseconds(2)).count())
+    M_EXPECTED_EQ(histogram.percentile(80).count(), nanoseconds(microseconds(4)).count())
+    M_EXPECTED_EQ(histogram.percentile(100).count(), nanoseconds(microseconds(100)).count())
+
+    // Merge (as done with the histograms of each dispatch worker).
+    zmqutils::pubsub::LatencyHistogram other;
+    other.addSample(milliseconds(10));
+    histogram.merge(other);
+    histogram.merge(zmqutils::pubsub::LatencyHistogram());
+    M_EXPECTED_EQ(histogram.count, std::uint64_t(6))
+    M_EXPECTED_EQ(histogram.buckets[14], std::uint64_t(1))
+    M_EXPECTED_EQ(histogram.min.count(), nanoseconds(0).count())
+    M_EXPECTED_EQ(histogram.max.count(), nanoseconds(milliseconds(10)).count())
+    M_EXPECTED_EQ(histogram.percentile(100).count(), nanoseconds(milliseconds(10)).count())
+    M_EXPECTED_EQ(histogram.percentile(50).count(), nanoseconds(microseconds(2)).count())
+}
+
+#ifdef ZMQ_BUILD_DRAFT_API
+M_DEFINE_UNIT_TEST(PublisherSubscriber, UdpRadioDishPublishSubscribe)
+{
+    class TestSubscriber : public zmqutils::pubsub::ClbkSubscriberBase
+    {
+    private:
+
+        using zmqutils::pubsub::ClbkSubscriberBase::ClbkSubscriberBase;
+
+        inline void onSubscriberStart() override {}
+
+        inline void onSubscriberStop() override {}
+
+        inline void onSubscriberError(const zmq::error_t &, const std::string &) override {}
+    };
+
+    class SubscriberCallbackHandler
+    {
+    private:
+
+        std::promise<void> promise_;
+        std::atomic_uint pending_;
+
+    public:
+
+        inline SubscriberCallbackHandler(unsigned messages_to_receive) :
+            pending_(messages_to_receive),
+            future_(promise_.get_future())
+        {}
+
+        inline void handleMsg(const std::string& msg)
+        {
+            this->received_v_.push_back(msg);
+            if (--this->pending_ == 0)
+                this->promise_.set_value();
+        }
+
+        std::vector<std::string> received_v_;
+        std::future<void> future_;
+    };
+
+    // Publisher configuration variables.
+    unsigned publisher_port = 9999;
+    std::string publisher_iface = "*";
+    std::string publisher_name = "TEST PUBLISHER";
+    std::string publisher_version = "1.1.1";
+    std::string publisher_info = "This is the TEST publisher";
+
+    // Subscriber configuration variables.
+    std::string subscriber_name = "TEST SUBSCRIBER";
+    std::string subscriber_version = "1.1.1";
+    std::string subscriber_info = "This is the TEST subscriber.";
+    std::string publisher_endpoint = "udp://127.0.0.1:9999";
+
+    // Test data.
+    std::future_status fut_status;
+
+    // Instanciate the publisher with the UDP transport.
+    zmqutils::pubsub::PublisherBase publisher(publisher_port, publisher_iface, publisher_name,
+                                              publisher_version, publisher_info);
+    M_EXPECTED_EQ(publisher.setUdpTransport("tcp://127.0.0.1:9999"), false)
+    M_EXPECTED_EQ(publisher.setUdpTransport(publisher_endpoint), true)
+
+    // Start the publisher (it connects the RADIO socket, so the subscriber can be started later).
+    bool started = publisher.startPublisher();
+
+    // Check if started.
+    if(!started)
+    {
+        std::cout << "Publisher start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Subscriber and callback handler.
+    TestSubscriber subscriber(subscriber_name, subscriber_version, subscriber_info);
+    SubscriberCallbackHandler handler(2);
+
+    // Configure the subscriber. The filters are exact groups, so the "dome/az" topic must be discarded.
+    subscriber.subscribe(publisher_endpoint);
+    subscriber.addTopicFilter("mount/az");
+    subscriber.addTopicFilter("mount/el");
+    subscriber.registerCbAndReqProcFunc<std::function<void(const std::string&)>>(
+        "#", &handler, &SubscriberCallbackHandler::handleMsg);
+
+    // Start the subscriber.
+    started = subscriber.startSubscriber();
+
+    // Check if the subscriber starts ok.
+    if(!started)
+    {
+        std::cout << "Subscriber start failed!!" << std::endl;
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Wait for the dish socket.
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Send the test msgs.
+    publisher.enqueueMsg("dome/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("dome"));
+    publisher.enqueueMsg("mount/az", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("az"));
+    publisher.enqueueMsg("mount/el", zmqutils::pubsub::MessagePriority::NormalPriority, std::string("el"));
+    fut_status = handler.future_.wait_for(std::chrono::seconds(2));
+
+    // Stop all.
+    publisher.stopPublisher();
+    subscriber.stopSubscriber();
+
+    // Check the future.
+    if (fut_status != std::future_status::ready)
+    {
+        M_FORCE_FAIL()
+        return;
+    }
+
+    // Check results.
+    M_EXPECTED_EQ(handler.received_v_.size(), static_cast<size_t>(2))
+    M_EXPECTED_EQ(handler.received_v_[0], std::string("az"))
+    M_EXPECTED_EQ(handler.received_v_[1], std::string("el"))
+}
+#endif
+
 M_DEFINE_UNIT_TEST(PublisherSubscriber, MultithreadPublishSubscribe)
 {
     class TestData : public zmqutils::serializer::Serializable
@@ -496,6 +2178,28 @@ int main()
     // Register the tests.
     M_REGISTER_UNIT_TEST(PublisherSubscriber, BasicPublishSubscribe)
     M_REGISTER_UNIT_TEST(PublisherSubscriber, RegisterCbAndReqProcFunc)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, TypedTopicPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, DirectSendPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, ReactorPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, DedicatedContextPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, SocketOptionsPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, DispatchWorkersPublishSubscribe)
+#ifdef __linux__
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, ThreadConfigPublishSubscribe)
+#endif
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, ConflatedDispatchQueue)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, TopicDispatchTrie)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, TopicIdsPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, SharedDataPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, BrokerPublishSubscribe)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, JournalPublishReplay)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, RuntimeFilterChanges)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, SubscribeFromCallback)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, SequenceTracking)
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, LatencyHistogram)
+#ifdef ZMQ_BUILD_DRAFT_API
+    M_REGISTER_UNIT_TEST(PublisherSubscriber, UdpRadioDishPublishSubscribe)
+#endif
     M_REGISTER_UNIT_TEST(PublisherSubscriber, MultithreadPublishSubscribe)
 
     // Run the unit tests.
@@ -39,6 +39,7 @@
 #include <fstream>
 #include <stdio.h>
 #include <chrono>
+#include <random>
 #include <omp.h>
 #if __MINGW64_VERSION_MAJOR > 6
 #include <filesystem>
@@ -76,6 +77,7 @@ M_DECLARE_UNIT_TEST(BinarySerializer, FileWithFilesystem)
 M_DECLARE_UNIT_TEST(BinarySerializer, FileInCustomPath)
 #endif
 M_DECLARE_UNIT_TEST(BinarySerializer, Tuple)
+M_DECLARE_UNIT_TEST(BinarySerializer, FastSerializationExactSize)
 
 // Other tests.
 M_DECLARE_UNIT_TEST(BinarySerializer, TrivialIntensive)
@@ -938,6 +940,55 @@ M_DEFINE_UNIT_TEST(BinarySerializer, Tuple)
     M_EXPECTED_EQ(out_4, std::get<2>(in_4))
 }
 
+M_DEFINE_UNIT_TEST(BinarySerializer, FastSerializationExactSize)
+{
+    // Compile time sizes.
+    using zmqutils::serializer::has_fixed_serialized_size_v;
+    using zmqutils::serializer::fixed_serialized_size_v;
+    static_assert(has_fixed_serialized_size_v<int, double, std::array<float, 3>, std::tuple<char, long>>);
+    static_assert(!has_fixed_serialized_size_v<int, std::string>);
+    static_assert(fixed_serialized_size_v<int, std::array<double, 2>> == 8 + 4 + 8 + 8 + 2 * 8);
+
+    // Data.
+    int in_1 = 42;
+    double in_2 = 3.1415;
+    std::string in_3 = "Hello, World!";
+    std::tuple<int, std::string> in_4(7, "Hi, World!");
+    std::vector<int> in_6 = {1, 2, 3, 4};
+    std::array<double, 3> in_5 = {1.0, 2.0, 3.0};
+    int out_1;
+    double out_2;
+    std::string out_3;
+    std::tuple<int, std::string> out_4;
+    std::vector<int> out_6;
+    std::array<double, 3> out_5;
+
+    // Fixed size serialization.
+    zmqutils::serializer::BytesDataPtr bytes;
+    SizeUnit size = BinarySerializer::fastSerialization(bytes, in_1, in_2, in_5);
+    M_EXPECTED_EQ(size, (fixed_serialized_size_v<int, double, std::array<double, 3>>))
+    M_EXPECTED_EQ(size, BinarySerializer::serializedSize(in_1, in_2, in_5))
+    BinarySerializer::fastDeserialization(bytes.get(), size, out_1, out_2, out_5);
+    M_EXPECTED_EQ(out_1, in_1)
+    M_EXPECTED_EQ(out_2, in_2)
+    M_EXPECTED_EQ(out_5, in_5)
+
+    // Runtime size serialization.
+    size = BinarySerializer::fastSerialization(bytes, in_3, in_6);
+    M_EXPECTED_EQ(size, BinarySerializer::serializedSize(in_3, in_6))
+    BinarySerializer::fastDeserialization(bytes.get(), size, out_3, out_6);
+    M_EXPECTED_EQ(out_3, in_3)
+    M_EXPECTED_EQ(out_6, in_6)
+
+    // Tuple serialization.
+    size = BinarySerializer::fastSerialization(bytes, in_4);
+    M_EXPECTED_EQ(size, BinarySerializer::serializedSize(in_4))
+    M_EXPECTED_EQ(size, BinarySerializer::serializedSize(std::get<0>(in_4), std::get<1>(in_4)))
+    BinarySerializer::fastDeserialization(bytes.get(), size, out_4);
+    M_EXPECTED_EQ(std::get<0>(out_4), std::get<0>(in_4))
+    M_EXPECTED_EQ(std::get<1>(out_4), std::get<1>(in_4))
+}
+
 M_DEFINE_UNIT_TEST(BinarySerializer, TrivialIntensive)
 {
     // WARNING: TEsting the worst case, so this test is not efficient on purpose.
@@ -1045,6 +1096,7 @@ int main()
     M_REGISTER_UNIT_TEST(BinarySerializer, FileInCustomPath)
 #endif
     M_REGISTER_UNIT_TEST(BinarySerializer, Tuple)
+    M_REGISTER_UNIT_TEST(BinarySerializer, FastSerializationExactSize)
     M_REGISTER_UNIT_TEST(BinarySerializer, TrivialIntensive)
     M_REGISTER_UNIT_TEST(BinarySerializer, TrivialIntensiveParrallel)
 
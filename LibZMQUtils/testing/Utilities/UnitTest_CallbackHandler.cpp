@@ -0,0 +1,187 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <atomic>
+#include <functional>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/Utilities>
+#include <LibZMQUtils/Modules/Testing>
+// =====================================================================================================================
+
+// =====================================================================================================================
+using zmqutils::utils::CallbackHandler;
+// =====================================================================================================================
+
+// Helper classes.
+
+class TestHandler : public CallbackHandler
+{};
+
+class TestReceiver
+{
+public:
+
+    TestReceiver(TestHandler& handler) :
+        handler_(handler)
+    {}
+
+    int add(int a, int b)
+    {
+        this->calls_++;
+        return a + b;
+    }
+
+    int registerOther(int value)
+    {
+        // Register another callback and remove itself from inside the callback.
+        this->handler_.registerCallback(2, this, &TestReceiver::add);
+        this->handler_.removeCallback(1);
+        return value;
+    }
+
+    std::atomic_int calls_ = 0;
+
+private:
+
+    TestHandler& handler_;
+};
+
+using AddFunction = std::function<int(int, int)>;
+using RegisterOtherFunction = std::function<int(int)>;
+
+// Basic tests.
+M_DECLARE_UNIT_TEST(CallbackHandler, RegisterInvokeRemove)
+M_DECLARE_UNIT_TEST(CallbackHandler, ReentrantRegistration)
+M_DECLARE_UNIT_TEST(CallbackHandler, ConcurrentInvocation)
+
+// Implementations.
+
+M_DEFINE_UNIT_TEST(CallbackHandler, RegisterInvokeRemove)
+{
+    TestHandler handler;
+    TestReceiver receiver(handler);
+
+    // Registration and invocation.
+    handler.registerCallback(1, &receiver, &TestReceiver::add);
+    M_EXPECTED_EQ(handler.hasCallback(1), true)
+    M_EXPECTED_EQ(handler.hasCallback(2), false)
+    M_EXPECTED_EQ((handler.invokeCallback<AddFunction, int>(1, 2, 3)), 5)
+
+    // Invalid type and unknown identifier.
+    bool bad_type = false;
+    bool bad_id = false;
+    try { handler.invokeCallback<RegisterOtherFunction, int>(1, 2); } catch(const std::exception&) { bad_type = true; }
+    try { handler.invokeCallback<AddFunction, int>(2, 2, 3); } catch(const std::invalid_argument&) { bad_id = true; }
+    M_EXPECTED_EQ(bad_type, true)
+    M_EXPECTED_EQ(bad_id, true)
+
+    // Removal.
+    handler.removeCallback(1);
+    M_EXPECTED_EQ(handler.hasCallback(1), false)
+    handler.registerCallback(1, &receiver, &TestReceiver::add);
+    handler.clearCallbacks();
+    M_EXPECTED_EQ(handler.hasCallback(1), false)
+}
+
+M_DEFINE_UNIT_TEST(CallbackHandler, ReentrantRegistration)
+{
+    TestHandler handler;
+    TestReceiver receiver(handler);
+
+    // The callback modifies the handler while it is running.
+    handler.registerCallback(1, &receiver, &TestReceiver::registerOther);
+    M_EXPECTED_EQ((handler.invokeCallback<RegisterOtherFunction, int>(1, 7)), 7)
+    M_EXPECTED_EQ(handler.hasCallback(1), false)
+    M_EXPECTED_EQ(handler.hasCallback(2), true)
+    M_EXPECTED_EQ((handler.invokeCallback<AddFunction, int>(2, 1, 1)), 2)
+}
+
+M_DEFINE_UNIT_TEST(CallbackHandler, ConcurrentInvocation)
+{
+    const unsigned threads = 4;
+    const unsigned per_thread = 20000;
+
+    TestHandler handler;
+    TestReceiver receiver(handler);
+    handler.registerCallback(1, &receiver, &TestReceiver::add);
+
+    // Invoke from several threads while other thread keeps registering and removing a different callback.
+    std::atomic_bool running = true;
+    std::thread writer([&handler, &receiver, &running]
+    {
+        while (running)
+        {
+            handler.registerCallback(2, &receiver, &TestReceiver::add);
+            handler.removeCallback(2);
+        }
+    });
+
+    std::atomic_uint wrong_results = 0;
+    std::vector<std::thread> readers;
+    for (unsigned t = 0; t < threads; t++)
+        readers.emplace_back([&handler, &wrong_results, t, per_thread]
+        {
+            for (unsigned i = 0; i < per_thread; i++)
+                if (handler.invokeCallback<AddFunction, int>(1, static_cast<int>(t), 1) != static_cast<int>(t) + 1)
+                    wrong_results++;
+        });
+    for (auto& reader : readers)
+        reader.join();
+    running = false;
+    writer.join();
+
+    M_EXPECTED_EQ(wrong_results.load(), 0u)
+    M_EXPECTED_EQ(receiver.calls_.load(), static_cast<int>(threads * per_thread))
+}
+
+int main()
+{
+    // Start of the session.
+    M_START_UNIT_TEST_SESSION("LibZMQUtils CallbackHandler Session")
+
+    // Register the tests.
+    M_REGISTER_UNIT_TEST(CallbackHandler, RegisterInvokeRemove)
+    M_REGISTER_UNIT_TEST(CallbackHandler, ReentrantRegistration)
+    M_REGISTER_UNIT_TEST(CallbackHandler, ConcurrentInvocation)
+
+    // Run the unit tests.
+    M_RUN_UNIT_TESTS()
+}
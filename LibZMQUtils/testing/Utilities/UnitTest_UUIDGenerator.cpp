@@ -0,0 +1,173 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <iostream>
+#include <sstream>
+#include <thread>
+#include <unordered_set>
+#include <vector>
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/Utilities>
+#include <LibZMQUtils/Modules/Testing>
+// =====================================================================================================================
+
+// =====================================================================================================================
+using zmqutils::utils::UUID;
+using zmqutils::utils::UUIDGenerator;
+// =====================================================================================================================
+
+// Basic tests.
+M_DECLARE_UNIT_TEST(UUIDGenerator, VersionAndVariant)
+M_DECLARE_UNIT_TEST(UUIDGenerator, UniqueAcrossThreads)
+M_DECLARE_UNIT_TEST(UUIDGenerator, TimeOrderedV7)
+M_DECLARE_UNIT_TEST(UUIDGenerator, RFC4122String)
+
+// Implementations.
+
+M_DEFINE_UNIT_TEST(UUIDGenerator, VersionAndVariant)
+{
+    UUID uuid_v4 = UUIDGenerator::getInstance().generateUUIDv4();
+    UUID uuid_v7 = UUIDGenerator::getInstance().generateUUIDv7();
+
+    // Version nibble (7th byte) and RFC 4122 variant (9th byte).
+    M_EXPECTED_EQ(static_cast<unsigned>(uuid_v4.getBytes()[6]) >> 4, 4u)
+    M_EXPECTED_EQ(static_cast<unsigned>(uuid_v4.getBytes()[8]) >> 6, 2u)
+    M_EXPECTED_EQ(static_cast<unsigned>(uuid_v7.getBytes()[6]) >> 4, 7u)
+    M_EXPECTED_EQ(static_cast<unsigned>(uuid_v7.getBytes()[8]) >> 6, 2u)
+
+    // String representation.
+    std::string str = uuid_v4.toRFC4122String();
+    M_EXPECTED_EQ(str.size(), static_cast<std::size_t>(36))
+    M_EXPECTED_EQ(str[14], '4')
+
+    // Hash of equal UUIDs.
+    UUID copy = uuid_v4;
+    M_EXPECTED_EQ(std::hash<UUID>{}(copy), std::hash<UUID>{}(uuid_v4))
+    M_EXPECTED_NE(uuid_v4, uuid_v7)
+}
+
+M_DEFINE_UNIT_TEST(UUIDGenerator, UniqueAcrossThreads)
+{
+    const unsigned threads = 4;
+    const unsigned per_thread = 10000;
+
+    // Generate the UUIDs in several threads at the same time.
+    std::vector<std::vector<UUID>> results(threads);
+    std::vector<std::thread> workers;
+    for (unsigned t = 0; t < threads; t++)
+        workers.emplace_back([&results, t, per_thread]
+        {
+            results[t].reserve(per_thread);
+            for (unsigned i = 0; i < per_thread; i++)
+                results[t].push_back(t % 2 ? UUIDGenerator::getInstance().generateUUIDv7() :
+                                             UUIDGenerator::getInstance().generateUUIDv4());
+        });
+    for (auto& worker : workers)
+        worker.join();
+
+    // Check the uniqueness.
+    std::unordered_set<UUID> uuids;
+    for (const auto& result : results)
+        uuids.insert(result.begin(), result.end());
+    M_EXPECTED_EQ(uuids.size(), static_cast<std::size_t>(threads * per_thread))
+}
+
+M_DEFINE_UNIT_TEST(UUIDGenerator, TimeOrderedV7)
+{
+    // The UUIDs of the same thread are strictly increasing, even within the same millisecond.
+    UUID previous = UUIDGenerator::getInstance().generateUUIDv7();
+    bool ordered = true;
+    for (unsigned i = 0; i < 100000; i++)
+    {
+        UUID current = UUIDGenerator::getInstance().generateUUIDv7();
+        ordered = ordered && previous < current;
+        previous = current;
+    }
+    M_EXPECTED_EQ(ordered, true)
+}
+
+M_DEFINE_UNIT_TEST(UUIDGenerator, RFC4122String)
+{
+    // Known representation.
+    std::array<std::byte, UUID::kUUIDSize> bytes;
+    const unsigned char raw[] = {0x55, 0x0e, 0x84, 0x00, 0xe2, 0x9b, 0x41, 0xd4,
+                                 0xa7, 0x16, 0x44, 0x66, 0x55, 0x44, 0x00, 0xff};
+    for (std::size_t i = 0; i < bytes.size(); i++)
+        bytes[i] = static_cast<std::byte>(raw[i]);
+    const UUID known(bytes);
+    const std::string known_str("550e8400-e29b-41d4-a716-4466554400ff");
+    M_EXPECTED_EQ(known.toRFC4122String(), known_str)
+
+    // Stream representation.
+    std::ostringstream ss;
+    ss << known;
+    M_EXPECTED_EQ(ss.str(), known_str)
+
+    // Parsing (case insensitive) and round trip.
+    UUID parsed;
+    M_EXPECTED_EQ(UUID::fromRFC4122String(known_str, parsed), true)
+    M_EXPECTED_EQ(parsed == known, true)
+    M_EXPECTED_EQ(UUID::fromRFC4122String("550E8400-E29B-41D4-A716-4466554400FF", parsed), true)
+    M_EXPECTED_EQ(parsed == known, true)
+    UUID generated = UUIDGenerator::getInstance().generateUUIDv4();
+    M_EXPECTED_EQ(UUID::fromRFC4122String(generated.toRFC4122String(), parsed), true)
+    M_EXPECTED_EQ(parsed == generated, true)
+
+    // Invalid representations.
+    M_EXPECTED_EQ(UUID::isValidRFC4122String("550e8400-e29b-41d4-a716-4466554400f"), false)
+    M_EXPECTED_EQ(UUID::isValidRFC4122String("550e8400-e29b-41d4-a716-4466554400fg"), false)
+    M_EXPECTED_EQ(UUID::isValidRFC4122String("550e8400ae29b-41d4-a716-4466554400ff"), false)
+    M_EXPECTED_EQ(UUID::isValidRFC4122String("{50e8400-e29b-41d4-a716-4466554400f}"), false)
+    M_EXPECTED_EQ(UUID::isValidRFC4122String(""), false)
+}
+
+int main()
+{
+    // Start of the session.
+    M_START_UNIT_TEST_SESSION("LibZMQUtils UUIDGenerator Session")
+
+    // Register the tests.
+    M_REGISTER_UNIT_TEST(UUIDGenerator, VersionAndVariant)
+    M_REGISTER_UNIT_TEST(UUIDGenerator, UniqueAcrossThreads)
+    M_REGISTER_UNIT_TEST(UUIDGenerator, TimeOrderedV7)
+    M_REGISTER_UNIT_TEST(UUIDGenerator, RFC4122String)
+
+    // Run the unit tests.
+    M_RUN_UNIT_TESTS()
+}
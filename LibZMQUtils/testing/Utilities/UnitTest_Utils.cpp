@@ -0,0 +1,185 @@
+/***********************************************************************************************************************
+ *   LibZMQUtils (ZeroMQ High-Level Utilities C++ Library).                                                            *
+ *                                                                                                                     *
+ *   A modern open-source and cross-platform C++ library with high-level utilities based on the well-known ZeroMQ      *
+ *   open-source universal messaging library. Includes a suite of modules that encapsulates the ZMQ communication      *
+ *   patterns as well as automatic binary serialization capabilities, specially designed for system infraestructure.   *
+ *   The library is suited for the quick and easy integration of new and old systems and can be used in different      *
+ *   sectors and disciplines seeking robust messaging and serialization solutions.                                     *
+ *                                                                                                                     *
+ *   Developed as free software within the context of the Degoras Project for the Satellite Laser Ranging Station      *
+ *   (SFEL) at the Spanish Navy Observatory (ROA) in San Fernando, Cádiz. The library is open for use by other SLR     *
+ *   stations and organizations, so we warmly encourage you to give it a try and feel free to contact us anytime!      *
+ *                                                                                                                     *
+ *   Copyright (C) 2024 Degoras Project Team                                                                           *
+ *                      < Ángel Vera Herrera, avera@roa.es - angeldelaveracruz@gmail.com >                             *
+ *                      < Jesús Relinque Madroñal >                                                                    *
+ *                                                                                                                     *
+ *   This file is part of LibZMQUtils.                                                                                 *
+ *                                                                                                                     *
+ *   Licensed under the European Union Public License (EUPL), Version 1.2 or subsequent versions of the EUPL license   *
+ *   as soon they will be approved by the European Commission (IDABC).                                                 *
+ *                                                                                                                     *
+ *   This project is free software: you can redistribute it and/or modify it under the terms of the EUPL license as    *
+ *   published by the IDABC, either Version 1.2 or, at your option, any later version.                                 *
+ *                                                                                                                     *
+ *   This project is distributed in the hope that it will be useful. Unless required by applicable law or agreed to in *
+ *   writing, it is distributed on an "AS IS" basis, WITHOUT ANY WARRANTY OR CONDITIONS OF ANY KIND; without even the  *
+ *   implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the EUPL license to check specific   *
+ *   language governing permissions and limitations and more details.                                                  *
+ *                                                                                                                     *
+ *   You should use this project in compliance with the EUPL license. You should have received a copy of the license   *
+ *   along with this project. If not, see the license at < https://eupl.eu/ >.                                         *
+ **********************************************************************************************************************/
+
+// C++ INCLUDES
+// =====================================================================================================================
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+// =====================================================================================================================
+
+// PLATFORM INCLUDES
+// =====================================================================================================================
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+// =====================================================================================================================
+
+// ZMQUTILS INCLUDES
+// =====================================================================================================================
+#include <LibZMQUtils/Modules/Utilities>
+#include <LibZMQUtils/Modules/Testing>
+// =====================================================================================================================
+
+// =====================================================================================================================
+using zmqutils::utils::TimePointStd;
+using zmqutils::utils::HRTimePointStd;
+// =====================================================================================================================
+
+// Basic tests.
+M_DECLARE_UNIT_TEST(Utils, Iso8601Format)
+M_DECLARE_UNIT_TEST(Utils, Iso8601Parse)
+#ifdef __linux__
+M_DECLARE_UNIT_TEST(Utils, ApplyThreadConfig)
+#endif
+
+// Implementations.
+
+M_DEFINE_UNIT_TEST(Utils, Iso8601Format)
+{
+    // 2025-01-09T18:58:41.870123456Z
+    const TimePointStd tp(std::chrono::duration_cast<TimePointStd::duration>(
+        std::chrono::seconds(1736449121) + std::chrono::nanoseconds(870123456)));
+
+    M_EXPECTED_EQ(zmqutils::utils::timePointToIso8601(tp, false, false), std::string("2025-01-09T18:58:41Z"))
+    M_EXPECTED_EQ(zmqutils::utils::timePointToIso8601(tp), std::string("2025-01-09T18:58:41.870Z"))
+
+    // Buffer formatting, with a buffer too small.
+    char buffer[zmqutils::utils::kIso8601BufferSize];
+    std::size_t size = zmqutils::utils::formatIso8601(tp, buffer, sizeof(buffer), true, true);
+    M_EXPECTED_EQ(std::string(buffer, size), std::string("2025-01-09T18:58:41.870123456Z"))
+    M_EXPECTED_EQ(zmqutils::utils::formatIso8601(tp, buffer, 20, true, false), static_cast<std::size_t>(0))
+
+    // Before the epoch.
+    const TimePointStd old_tp(std::chrono::duration_cast<TimePointStd::duration>(std::chrono::milliseconds(-1)));
+    M_EXPECTED_EQ(zmqutils::utils::timePointToIso8601(old_tp), std::string("1969-12-31T23:59:59.999Z"))
+
+    // The local time must represent the same time point.
+    HRTimePointStd local_tp;
+    std::string local = zmqutils::utils::timePointToIso8601(tp, true, true, false);
+    M_EXPECTED_EQ(zmqutils::utils::parseIso8601Datetime(local, local_tp), true)
+    M_EXPECTED_EQ(std::chrono::duration_cast<std::chrono::nanoseconds>(local_tp.time_since_epoch()).count(),
+                  std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch()).count())
+}
+
+M_DEFINE_UNIT_TEST(Utils, Iso8601Parse)
+{
+    HRTimePointStd tp;
+    bool has_zone = false;
+    auto toNs = [](const HRTimePointStd& tp)
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(tp.time_since_epoch());
+        return static_cast<long long>(ns.count());
+    };
+
+    // Extended and basic formats, with fractions and offsets.
+    M_EXPECTED_EQ(zmqutils::utils::parseIso8601Datetime("2025-01-09T18:58:41.87Z", tp, &has_zone), true)
+    M_EXPECTED_EQ(toNs(tp), static_cast<long long>(1736449121870000000LL))
+    M_EXPECTED_EQ(has_zone, true)
+    M_EXPECTED_EQ(zmqutils::utils::parseIso8601Datetime("20250109T185841.870000000123", tp, &has_zone), true)
+    M_EXPECTED_EQ(toNs(tp), static_cast<long long>(1736449121870000000LL))
+    M_EXPECTED_EQ(has_zone, false)
+    M_EXPECTED_EQ(zmqutils::utils::parseIso8601Datetime("2025-01-09T20:28:41.87+01:30", tp), true)
+    M_EXPECTED_EQ(toNs(tp), static_cast<long long>(1736449121870000000LL))
+
+    // Invalid datetimes.
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime("2025-01-09T18:58:41"), true)
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime("2025-13-09T18:58:41Z"), false)
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime("2025-01-09T18:58:41."), false)
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime("2025-0109T185841Z"), false)
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime("2025-01-09T18:58:41Z "), false)
+    M_EXPECTED_EQ(zmqutils::utils::isValidIso8601Datetime(""), false)
+}
+
+#ifdef __linux__
+M_DEFINE_UNIT_TEST(Utils, ApplyThreadConfig)
+{
+    // Use the first CPU allowed for the process.
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    pthread_getaffinity_np(pthread_self(), sizeof(allowed), &allowed);
+    unsigned first_cpu = 0;
+    while (first_cpu < CPU_SETSIZE && !CPU_ISSET(first_cpu, &allowed))
+        first_cpu++;
+
+    // The name is truncated to 15 characters, keeping the suffix.
+    zmqutils::utils::ThreadConfig config;
+    config.name = "test-thread-config";
+    config.cpus = {first_cpu};
+
+    // Apply the configuration in a new thread and read it back.
+    bool applied = false;
+    std::string name;
+    std::vector<unsigned> cpus;
+    std::thread thread([&config, &applied, &name, &cpus]
+    {
+        applied = zmqutils::utils::applyThreadConfig(config, "/12");
+
+        char buffer[16] = {};
+        pthread_getname_np(pthread_self(), buffer, sizeof(buffer));
+        name = buffer;
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        pthread_getaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+        for (unsigned cpu = 0; cpu < CPU_SETSIZE; cpu++)
+            if (CPU_ISSET(cpu, &cpu_set))
+                cpus.push_back(cpu);
+    });
+    thread.join();
+
+    M_EXPECTED_EQ(applied, true)
+    M_EXPECTED_EQ(name, std::string("test-thread-/12"))
+    M_EXPECTED_EQ(cpus, std::vector<unsigned>{first_cpu})
+}
+#endif
+
+int main()
+{
+    // Start of the session.
+    M_START_UNIT_TEST_SESSION("LibZMQUtils Utils Session")
+
+    // Register the tests.
+    M_REGISTER_UNIT_TEST(Utils, Iso8601Format)
+    M_REGISTER_UNIT_TEST(Utils, Iso8601Parse)
+#ifdef __linux__
+    M_REGISTER_UNIT_TEST(Utils, ApplyThreadConfig)
+#endif
+
+    // Run the unit tests.
+    M_RUN_UNIT_TESTS()
+}